@@ -0,0 +1,108 @@
+#include "../../src/m_rbk.h"
+#include <stdio.h>
+
+#define NUMBER_OF_VALUES 1000
+
+int32_t compare_int(const int *const a, const int *const b) { return *a - *b; }
+
+MRBK_ALL(test, int)
+
+int failed_checks = 0;
+
+void check(int condition, const char *const message) {
+  if (0 == condition) {
+    ++failed_checks;
+    printf("Check failed: %s\n", message);
+  }
+}
+
+int main(void) {
+  FILE *fout = NULL;
+
+  if ((fout = freopen("out_4.txt", "w", stdout)) == NULL) {
+    exit(EXIT_FAILURE);
+  }
+
+  printf("In this example we will move an RBK tree iterator from the past the "
+         "end position\n\n");
+
+  test_mrbk_t my_tree = test_mrbk(&compare_int, NULL);
+
+  if (NULL == my_tree) {
+    printf("RBK tree was not allocated\n");
+    exit(EXIT_FAILURE);
+  }
+
+  test_mrbk_iter_ptr_t iter;
+  int data = 0;
+
+  /* The iterator of an empty tree is always past the end */
+  check(M_OK == test_mrbk_iter_first(my_tree, &iter), "iterator not placed");
+  check(M_NOT_FOUND == test_mrbk_iter_data(&iter, &data), "data found");
+  check(M_NOT_FOUND == test_mrbk_iter_next(&iter, &data), "next found");
+  check(M_NOT_FOUND == test_mrbk_iter_prev(&iter, &data), "prev found");
+
+  check(M_OK == test_mrbk_iter_seek(my_tree, &iter, 10), "iterator not sought");
+  check(M_NOT_FOUND == test_mrbk_iter_prev(&iter, &data), "prev found");
+  check(M_NOT_FOUND == test_mrbk_iter_next(&iter, &data), "next found");
+
+  printf("Empty tree: the iterator stays past the end\n");
+
+  /* Push the even values in a random order */
+  srand(42);
+
+  for (int i = 0; i < 4 * NUMBER_OF_VALUES; ++i) {
+    test_mrbk_push(my_tree, 2 * (rand() % NUMBER_OF_VALUES));
+  }
+
+  for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+    test_mrbk_push(my_tree, 2 * i);
+  }
+
+  int max_value = 2 * (NUMBER_OF_VALUES - 1);
+
+  /* Seeking a value greater than every value leaves the iterator past the end */
+  test_mrbk_iter_seek(my_tree, &iter, max_value + 5);
+  check(M_NOT_FOUND == test_mrbk_iter_data(&iter, &data), "data over max");
+  check((M_OK == test_mrbk_iter_prev(&iter, &data)) && (max_value == data),
+        "prev after seeking past the end is not the maximum");
+
+  test_mrbk_iter_seek(my_tree, &iter, max_value + 5);
+  check((M_OK == test_mrbk_iter_next(&iter, &data)) && (0 == data),
+        "next after seeking past the end is not the minimum");
+
+  /* Moving over both ends goes through the past the end position */
+  test_mrbk_iter_last(my_tree, &iter);
+  check(M_NOT_FOUND == test_mrbk_iter_next(&iter, &data), "next after max");
+  check((M_OK == test_mrbk_iter_next(&iter, &data)) && (0 == data),
+        "next from the past the end position is not the minimum");
+  check(M_NOT_FOUND == test_mrbk_iter_prev(&iter, &data), "prev before min");
+  check((M_OK == test_mrbk_iter_prev(&iter, &data)) && (max_value == data),
+        "prev from the past the end position is not the maximum");
+
+  /* Walk the whole tree backward from the past the end position */
+  int expected = max_value;
+
+  test_mrbk_iter_seek(my_tree, &iter, max_value + 1);
+
+  while (M_OK == test_mrbk_iter_prev(&iter, &data)) {
+    check(expected == data, "wrong value walking backward");
+    expected -= 2;
+  }
+
+  check(-2 == expected, "wrong number of values walking backward");
+
+  printf("Moved the iterator over both ends of the tree\n");
+
+  test_mrbk_free(&my_tree);
+
+  printf("\n%d checks failed\n", failed_checks);
+
+  fclose(fout);
+
+  if (0 != failed_checks) {
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
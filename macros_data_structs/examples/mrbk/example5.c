@@ -0,0 +1,112 @@
+#include "../../src/m_rbk.h"
+#include <stdio.h>
+
+#define NUMBER_OF_VALUES 10000
+
+int32_t compare_int(const int *const a, const int *const b) { return *a - *b; }
+
+MRBK_ALL(test, int)
+
+/* Values in the order of the last traversal */
+int visited[NUMBER_OF_VALUES];
+
+int number_of_visited = 0;
+
+int failed_checks = 0;
+
+void check(int condition, const char *const message) {
+  if (0 == condition) {
+    ++failed_checks;
+    printf("Check failed: %s\n", message);
+  }
+}
+
+void visit(const int *const data) {
+  if (number_of_visited < NUMBER_OF_VALUES) {
+    visited[number_of_visited] = *data;
+  }
+
+  ++number_of_visited;
+}
+
+/* Check that a traversal visited every value once */
+void check_visited(const char *const name) {
+  int seen[NUMBER_OF_VALUES] = {0};
+
+  printf("\n");
+  check(NUMBER_OF_VALUES == number_of_visited, name);
+
+  for (int i = 0; (i < number_of_visited) && (i < NUMBER_OF_VALUES); ++i) {
+    check((visited[i] >= 0) && (visited[i] < NUMBER_OF_VALUES) &&
+              (0 == seen[visited[i]]++),
+          name);
+  }
+}
+
+/* Walk a tree built from sorted values and free it */
+void walk_tree(int ascending) {
+  test_mrbk_t my_tree = test_mrbk(&compare_int, NULL);
+
+  if (NULL == my_tree) {
+    printf("RBK tree was not allocated\n");
+    exit(EXIT_FAILURE);
+  }
+
+  for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+    test_mrbk_push(my_tree, ascending ? i : NUMBER_OF_VALUES - 1 - i);
+  }
+
+  check(NUMBER_OF_VALUES == test_mrbk_size(my_tree), "wrong tree size");
+
+  int root = 0;
+
+  check(M_OK == test_mrbk_root(my_tree, &root), "root not found");
+
+  number_of_visited = 0;
+  check(M_OK == test_mrbk_traverse_inorder(my_tree, &visit), "no inorder");
+  check_visited("wrong inorder traversal");
+
+  for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+    check(i == visited[i], "inorder traversal not sorted");
+  }
+
+  number_of_visited = 0;
+  check(M_OK == test_mrbk_traverse_preorder(my_tree, &visit), "no preorder");
+  check_visited("wrong preorder traversal");
+  check(root == visited[0], "preorder traversal does not start from the root");
+  number_of_visited = 0;
+  check(M_OK == test_mrbk_traverse_postorder(my_tree, &visit), "no postorder");
+  check_visited("wrong postorder traversal");
+  check(root == visited[NUMBER_OF_VALUES - 1],
+        "postorder traversal does not end with the root");
+
+  check(M_OK == test_mrbk_free(&my_tree), "tree not freed");
+  check(NULL == my_tree, "tree not reset");
+
+  printf("%s values: %d nodes walked and freed\n",
+         ascending ? "Ascending" : "Descending", NUMBER_OF_VALUES);
+}
+
+int main(void) {
+  FILE *fout = NULL;
+
+  if ((fout = freopen("out_5.txt", "w", stdout)) == NULL) {
+    exit(EXIT_FAILURE);
+  }
+
+  printf("In this example we will walk and free RBK trees built from sorted "
+         "values\n\n");
+
+  walk_tree(1);
+  walk_tree(0);
+
+  printf("\n%d checks failed\n", failed_checks);
+
+  fclose(fout);
+
+  if (0 != failed_checks) {
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
@@ -111,18 +111,34 @@
                                                                                \
   void ID##_internal_mbst_free_help(const ID##_mbst_ptr_t *const self,         \
                                     ID##_mbst_node_t *self_node) {             \
-    if (*self_node == self->nil) {                                             \
-      return;                                                                  \
-    }                                                                          \
+    ID##_mbst_node_t iterator = *self_node;                                    \
                                                                                \
-    ID##_internal_mbst_free_help(self, &(*self_node)->left);                   \
-    ID##_internal_mbst_free_help(self, &(*self_node)->right);                  \
+    while (iterator != self->nil) {                                            \
+      if (iterator->left != self->nil) {                                       \
+        iterator = iterator->left;                                             \
+      } else if (iterator->right != self->nil) {                               \
+        iterator = iterator->right;                                            \
+      } else {                                                                 \
+        ID##_mbst_node_t parent =                                              \
+            (iterator != *self_node) ? iterator->parent : self->nil;           \
+                                                                               \
+        if (parent != self->nil) {                                             \
+          if (parent->left == iterator) {                                      \
+            parent->left = self->nil;                                          \
+          } else {                                                             \
+            parent->right = self->nil;                                         \
+          }                                                                    \
+        }                                                                      \
                                                                                \
-    if (self->frd != NULL) {                                                   \
-      self->frd(&(*self_node)->data);                                          \
+        if (self->frd != NULL) {                                               \
+          self->frd(&iterator->data);                                          \
+        }                                                                      \
+                                                                               \
+        free(iterator);                                                        \
+        iterator = parent;                                                     \
+      }                                                                        \
     }                                                                          \
                                                                                \
-    free(*self_node);                                                          \
     *self_node = self->nil;                                                    \
   }                                                                            \
                                                                                \
@@ -598,9 +614,34 @@
       return;                                                                  \
     }                                                                          \
                                                                                \
-    ID##_internal_mbst_traverse_inorder_help(self, self_node->left, action);   \
-    action(&self_node->data);                                                  \
-    ID##_internal_mbst_traverse_inorder_help(self, self_node->right, action);  \
+    const ID##_mbst_node_ptr_t *iterator = self_node;                          \
+                                                                               \
+    while (iterator->left != self->nil) {                                      \
+      iterator = iterator->left;                                               \
+    }                                                                          \
+                                                                               \
+    while (1) {                                                                \
+      action(&iterator->data);                                                 \
+                                                                               \
+      if (iterator->right != self->nil) {                                      \
+        iterator = iterator->right;                                            \
+                                                                               \
+        while (iterator->left != self->nil) {                                  \
+          iterator = iterator->left;                                           \
+        }                                                                      \
+      } else {                                                                 \
+        while ((iterator != self_node) &&                                      \
+               (iterator->parent->right == iterator)) {                        \
+          iterator = iterator->parent;                                         \
+        }                                                                      \
+                                                                               \
+        if (iterator == self_node) {                                           \
+          return;                                                              \
+        }                                                                      \
+                                                                               \
+        iterator = iterator->parent;                                           \
+      }                                                                        \
+    }                                                                          \
   }                                                                            \
                                                                                \
   merr_t ID##_mbst_traverse_inorder(const ID##_mbst_ptr_t *const self,         \
@@ -637,9 +678,29 @@
       return;                                                                  \
     }                                                                          \
                                                                                \
-    action(&self_node->data);                                                  \
-    ID##_internal_mbst_traverse_preorder_help(self, self_node->left, action);  \
-    ID##_internal_mbst_traverse_preorder_help(self, self_node->right, action); \
+    const ID##_mbst_node_ptr_t *iterator = self_node;                          \
+                                                                               \
+    while (1) {                                                                \
+      action(&iterator->data);                                                 \
+                                                                               \
+      if (iterator->left != self->nil) {                                       \
+        iterator = iterator->left;                                             \
+      } else if (iterator->right != self->nil) {                               \
+        iterator = iterator->right;                                            \
+      } else {                                                                 \
+        while ((iterator != self_node) &&                                      \
+               ((iterator->parent->right == iterator) ||                       \
+                (iterator->parent->right == self->nil))) {                     \
+          iterator = iterator->parent;                                         \
+        }                                                                      \
+                                                                               \
+        if (iterator == self_node) {                                           \
+          return;                                                              \
+        }                                                                      \
+                                                                               \
+        iterator = iterator->parent->right;                                    \
+      }                                                                        \
+    }                                                                          \
   }                                                                            \
                                                                                \
   merr_t ID##_mbst_traverse_preorder(const ID##_mbst_ptr_t *const self,        \
@@ -676,10 +737,34 @@
       return;                                                                  \
     }                                                                          \
                                                                                \
-    action(&self_node->data);                                                  \
-    ID##_internal_mbst_traverse_postorder_help(self, self_node->left, action); \
-    ID##_internal_mbst_traverse_postorder_help(self, self_node->right,         \
-                                               action);                        \
+    const ID##_mbst_node_ptr_t *iterator = self_node;                          \
+    mbool_t go_down = mtrue;                                                   \
+                                                                               \
+    while (1) {                                                                \
+      while (go_down) {                                                        \
+        if (iterator->left != self->nil) {                                     \
+          iterator = iterator->left;                                           \
+        } else if (iterator->right != self->nil) {                             \
+          iterator = iterator->right;                                          \
+        } else {                                                               \
+          go_down = mfalse;                                                    \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      action(&iterator->data);                                                 \
+                                                                               \
+      if (iterator == self_node) {                                             \
+        return;                                                                \
+      }                                                                        \
+                                                                               \
+      if ((iterator->parent->left == iterator) &&                              \
+          (iterator->parent->right != self->nil)) {                            \
+        iterator = iterator->parent->right;                                    \
+        go_down = mtrue;                                                       \
+      } else {                                                                 \
+        iterator = iterator->parent;                                           \
+      }                                                                        \
+    }                                                                          \
   }                                                                            \
                                                                                \
   merr_t ID##_mbst_traverse_postorder(const ID##_mbst_ptr_t *const self,       \
@@ -703,6 +788,181 @@
     return M_OK;                                                               \
   }
 
+/**
+ * @brief Cursor over the tree in sorted order, placed by first, last or seek
+ * (the first data not less than the given one). The next and prev functions
+ * follow the parent links, so a full walk costs O(n) and a scan can stop at any
+ * point. The iterator is past the end when the data functions return
+ * `M_NOT_FOUND`, from there next moves to the minimum and prev to the maximum.
+ * Inserting or popping other data keeps the iterator valid, popping the data
+ * under the iterator invalidates it.
+ */
+#define MBST_ITER(ID, T)                                                       \
+  typedef struct ID##_mbst_iter_s {                                            \
+    const ID##_mbst_ptr_t *tree;                                               \
+    ID##_mbst_node_t node;                                                     \
+  } ID##_mbst_iter_ptr_t, *ID##_mbst_iter_t;                                   \
+                                                                               \
+  merr_t ID##_mbst_iter_first(const ID##_mbst_ptr_t *const self,               \
+                              ID##_mbst_iter_t const iter) {                   \
+    if ((self == NULL) || (iter == NULL)) {                                    \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    iter->tree = self;                                                         \
+    iter->node = self->root;                                                   \
+                                                                               \
+    if (iter->node != self->nil) {                                             \
+      while (iter->node->left != self->nil) {                                  \
+        iter->node = iter->node->left;                                         \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbst_iter_last(const ID##_mbst_ptr_t *const self,                \
+                             ID##_mbst_iter_t const iter) {                    \
+    if ((self == NULL) || (iter == NULL)) {                                    \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    iter->tree = self;                                                         \
+    iter->node = self->root;                                                   \
+                                                                               \
+    if (iter->node != self->nil) {                                             \
+      while (iter->node->right != self->nil) {                                 \
+        iter->node = iter->node->right;                                        \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbst_iter_seek(const ID##_mbst_ptr_t *const self,                \
+                             ID##_mbst_iter_t const iter, T data) {            \
+    if ((self == NULL) || (iter == NULL)) {                                    \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    ID##_mbst_node_t iterator = self->root;                                    \
+                                                                               \
+    iter->tree = self;                                                         \
+    iter->node = self->nil;                                                    \
+                                                                               \
+    while (iterator != self->nil) {                                            \
+      if (self->cmp(&iterator->data, &data) >= 0) {                            \
+        iter->node = iterator;                                                 \
+        iterator = iterator->left;                                             \
+      } else {                                                                 \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbst_iter_data(const ID##_mbst_iter_ptr_t *const iter,           \
+                             T *const acc) {                                   \
+    if ((iter == NULL) || (iter->tree == NULL) || (acc == NULL)) {             \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    if (iter->node == iter->tree->nil) {                                       \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    *acc = iter->node->data;                                                   \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbst_iter_next(ID##_mbst_iter_t const iter, T *const acc) {      \
+    if ((iter == NULL) || (iter->tree == NULL)) {                              \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    const ID##_mbst_ptr_t *const self = iter->tree;                            \
+    ID##_mbst_node_t iterator = iter->node;                                    \
+                                                                               \
+    if (iterator == self->nil) {                                               \
+      iterator = self->root;                                                   \
+                                                                               \
+      while ((iterator != self->nil) &&                                        \
+             (iterator->left != self->nil)) {                                  \
+        iterator = iterator->left;                                             \
+      }                                                                        \
+    } else if (iterator->right != self->nil) {                                 \
+      iterator = iterator->right;                                              \
+                                                                               \
+      while (iterator->left != self->nil) {                                    \
+        iterator = iterator->left;                                             \
+      }                                                                        \
+    } else {                                                                   \
+      while ((iterator->parent != self->nil) &&                                \
+             (iterator->parent->right == iterator)) {                          \
+        iterator = iterator->parent;                                           \
+      }                                                                        \
+                                                                               \
+      iterator = iterator->parent;                                             \
+    }                                                                          \
+                                                                               \
+    iter->node = iterator;                                                     \
+                                                                               \
+    if (iterator == self->nil) {                                               \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (acc != NULL) {                                                         \
+      *acc = iterator->data;                                                   \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }                                                                            \
+                                                                               \
+  merr_t ID##_mbst_iter_prev(ID##_mbst_iter_t const iter, T *const acc) {      \
+    if ((iter == NULL) || (iter->tree == NULL)) {                              \
+      return M_NULL_INPUT;                                                     \
+    }                                                                          \
+                                                                               \
+    const ID##_mbst_ptr_t *const self = iter->tree;                            \
+    ID##_mbst_node_t iterator = iter->node;                                    \
+                                                                               \
+    if (iterator == self->nil) {                                               \
+      iterator = self->root;                                                   \
+                                                                               \
+      while ((iterator != self->nil) &&                                        \
+             (iterator->right != self->nil)) {                                 \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    } else if (iterator->left != self->nil) {                                  \
+      iterator = iterator->left;                                               \
+                                                                               \
+      while (iterator->right != self->nil) {                                   \
+        iterator = iterator->right;                                            \
+      }                                                                        \
+    } else {                                                                   \
+      while ((iterator->parent != self->nil) &&                                \
+             (iterator->parent->left == iterator)) {                           \
+        iterator = iterator->parent;                                           \
+      }                                                                        \
+                                                                               \
+      iterator = iterator->parent;                                             \
+    }                                                                          \
+                                                                               \
+    iter->node = iterator;                                                     \
+                                                                               \
+    if (iterator == self->nil) {                                               \
+      return M_NOT_FOUND;                                                      \
+    }                                                                          \
+                                                                               \
+    if (acc != NULL) {                                                         \
+      *acc = iterator->data;                                                   \
+    }                                                                          \
+                                                                               \
+    return M_OK;                                                               \
+  }
+
 /**
  * @brief Adds the all API for the `mbst_t` structure (binary search tree). You
  * will not be always need to use all the API, in this case you must be sure
@@ -729,6 +989,7 @@
   MBST_POP(ID, T)                                                              \
   MBST_TRAVERSE_INORDER(ID, T)                                                 \
   MBST_TRAVERSE_PREORDER(ID, T)                                                \
-  MBST_TRAVERSE_POSTORDER(ID, T)
+  MBST_TRAVERSE_POSTORDER(ID, T)                                               \
+  MBST_ITER(ID, T)
 
 #endif /* MACROS_GENERIC_BINARY_SEARCH_TREE_UTILS_H_ */
@@ -0,0 +1,107 @@
+#include <scl_datastruc.h>
+#include <time.h>
+
+#define NUMBER_OF_DATA 1000000
+
+/* Random values shared by the insertion and the lookups */
+int values[NUMBER_OF_DATA];
+
+/* Data found for every value by the batched lookup */
+const void *found_data[NUMBER_OF_DATA];
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_4.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will compare the lookup of values one by one with the batched lookup\n\n");
+
+    /* Generate the random values */
+    srand(42);
+
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        values[i] = rand();
+    }
+
+    double exec_time = 0.0;
+
+    scl_error_t err = SCL_OK;
+
+    avl_tree_t *tree = create_avl(&compare_int, NULL, sizeof(int));
+
+    /* Insert the values and count the time */
+    clock_t begin = clock();
+
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        err = avl_insert(tree, &values[i]);
+
+        if (SCL_OK != err) {
+            scl_error_message(err);
+        }
+    }
+
+    clock_t end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("Inserting %d ints: %lf sec\n", NUMBER_OF_DATA, exec_time);
+    /* End to insert the values */
+
+    /* Search the values in another order */
+    for (int i = NUMBER_OF_DATA - 1; i > 0; --i) {
+        int j = rand() % (i + 1);
+        int temp = values[i];
+
+        values[i] = values[j];
+        values[j] = temp;
+    }
+
+    /* Find all the values one by one and count the time */
+    size_t found_values = 0;
+
+    begin = clock();
+
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        if (NULL != avl_find_data(tree, &values[i])) {
+            ++found_values;
+        }
+    }
+
+    end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("Finding %lu ints one by one: %lf sec\n", found_values, exec_time);
+    /* End to find the values one by one */
+
+    /* Find all the values in batches and count the time */
+    found_values = 0;
+
+    begin = clock();
+
+    err = avl_find_batch(tree, values, NUMBER_OF_DATA, found_data);
+
+    if (SCL_OK != err) {
+        scl_error_message(err);
+    }
+
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        if (NULL != found_data[i]) {
+            ++found_values;
+        }
+    }
+
+    end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("Finding %lu ints in batches: %lf sec\n", found_values, exec_time);
+    /* End to find the values in batches */
+
+    free_avl(tree);
+    tree = NULL;
+
+    /* Close output file */
+    fclose(fout);
+
+    return 0;
+}
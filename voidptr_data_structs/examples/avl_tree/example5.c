@@ -0,0 +1,140 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_VALUES 1000
+
+/* Values of the tree in sorted order */
+int sorted_values[NUMBER_OF_VALUES];
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Check that a cursor returned the expected value */
+void check_value(const void * const data, int value, const char * const message) {
+    check((NULL != data) && (value == *(const int *)data), message);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_5.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will walk an avl tree with a cursor and move it from the past the end position\n\n");
+
+    avl_tree_t *tree = create_avl(&compare_int, NULL, sizeof(int));
+    avl_cursor_t cursor;
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* A cursor of an empty tree is always past the end */
+    int key = 10;
+
+    check(SCL_OK == avl_cursor_first(tree, &cursor), "cursor not placed on an empty tree");
+    check(NULL == avl_cursor_data(&cursor), "data found in an empty tree");
+    check(NULL == avl_cursor_next(&cursor), "next found in an empty tree");
+    check(NULL == avl_cursor_prev(&cursor), "prev found in an empty tree");
+
+    check(SCL_OK == avl_cursor_seek(tree, &cursor, &key), "cursor not sought on an empty tree");
+    check(NULL == avl_cursor_data(&cursor), "sought data found in an empty tree");
+    check(NULL == avl_cursor_prev(&cursor), "prev after seek found in an empty tree");
+    check(NULL == avl_cursor_next(&cursor), "next after seek found in an empty tree");
+
+    printf("Empty tree: the cursor stays past the end\n");
+
+    /* Insert the even values in a random order */
+    srand(42);
+
+    for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+        sorted_values[i] = 2 * i;
+    }
+
+    for (int i = 0; i < 4 * NUMBER_OF_VALUES; ++i) {
+        int value = sorted_values[rand() % NUMBER_OF_VALUES];
+
+        avl_insert(tree, &value);
+    }
+
+    for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+        avl_insert(tree, &sorted_values[i]);
+    }
+
+    /* Walk the whole tree forward and backward */
+    int position = 0;
+
+    avl_cursor_first(tree, &cursor);
+
+    for (const int *data = avl_cursor_data(&cursor); NULL != data; data = avl_cursor_next(&cursor)) {
+        check((position < NUMBER_OF_VALUES) && (sorted_values[position] == *data), "wrong value walking forward");
+        ++position;
+    }
+
+    check(NUMBER_OF_VALUES == position, "wrong number of values walking forward");
+
+    avl_cursor_last(tree, &cursor);
+
+    for (const int *data = avl_cursor_data(&cursor); NULL != data; data = avl_cursor_prev(&cursor)) {
+        --position;
+        check((position >= 0) && (sorted_values[position] == *data), "wrong value walking backward");
+    }
+
+    check(0 == position, "wrong number of values walking backward");
+
+    printf("Walked %d values forward and backward\n", NUMBER_OF_VALUES);
+
+    /* Seeking a value greater than every value leaves the cursor past the end */
+    key = 2 * NUMBER_OF_VALUES + 5;
+
+    avl_cursor_seek(tree, &cursor, &key);
+    check(NULL == avl_cursor_data(&cursor), "value found over the maximum");
+    check_value(avl_cursor_prev(&cursor), sorted_values[NUMBER_OF_VALUES - 1], "prev after seeking past the end is not the maximum");
+    check_value(avl_cursor_prev(&cursor), sorted_values[NUMBER_OF_VALUES - 2], "second prev after seeking past the end");
+
+    avl_cursor_seek(tree, &cursor, &key);
+    check_value(avl_cursor_next(&cursor), sorted_values[0], "next after seeking past the end is not the minimum");
+
+    /* Moving over both ends goes through the past the end position */
+    avl_cursor_last(tree, &cursor);
+    check(NULL == avl_cursor_next(&cursor), "next found after the maximum");
+    check_value(avl_cursor_next(&cursor), sorted_values[0], "next from the past the end position is not the minimum");
+    check(NULL == avl_cursor_prev(&cursor), "prev found before the minimum");
+    check_value(avl_cursor_prev(&cursor), sorted_values[NUMBER_OF_VALUES - 1], "prev from the past the end position is not the maximum");
+
+    /* Seeking a missing value stops on the next greater value */
+    for (key = -1; key < 2 * NUMBER_OF_VALUES - 1; key += 2) {
+        avl_cursor_seek(tree, &cursor, &key);
+        check_value(avl_cursor_data(&cursor), key + 1, "wrong value after seek");
+
+        if (key > 0) {
+            check_value(avl_cursor_prev(&cursor), key - 1, "wrong prev after seek");
+        } else {
+            check(NULL == avl_cursor_prev(&cursor), "prev found before the minimum after seek");
+        }
+    }
+
+    printf("Moved the cursor over both ends of the tree\n");
+
+    free_avl(tree);
+    tree = NULL;
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
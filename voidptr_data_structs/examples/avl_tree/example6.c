@@ -0,0 +1,130 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_DATA 5000
+#define MAX_VALUE 2000
+
+/* Input of the bulk loads */
+int input[NUMBER_OF_DATA];
+
+/* Number of times every value is in the input */
+int counts[MAX_VALUE];
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Load the input into a tree and check it against the counts of the values */
+void check_bulk_load(size_t number_of_data, size_t nodes_per_chunk, const char * const name) {
+    memset(counts, 0, sizeof(counts));
+
+    for (size_t i = 0; i < number_of_data; ++i) {
+        ++counts[input[i]];
+    }
+
+    avl_tree_t *tree = create_avl_from_sorted(&compare_int, NULL, sizeof(int), input, number_of_data, nodes_per_chunk);
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* Every distinct value is one node, visited in sorted order */
+    size_t distinct_values = 0;
+    int value = 0;
+    avl_cursor_t cursor;
+
+    avl_cursor_first(tree, &cursor);
+
+    for (const int *data = avl_cursor_data(&cursor); NULL != data; data = avl_cursor_next(&cursor)) {
+        while ((value < MAX_VALUE) && (0 == counts[value])) {
+            ++value;
+        }
+
+        check((value < MAX_VALUE) && (value == *data), "wrong value walking the tree");
+        ++value;
+        ++distinct_values;
+    }
+
+    check(distinct_values == get_avl_size(tree), "wrong tree size");
+
+    if (NULL != tree->pool) {
+        check(distinct_values == get_pool_used_objects(tree->pool), "wrong number of pooled nodes");
+    }
+
+    /* Every loaded value is found and removed by one deletion */
+    for (value = 0; value < MAX_VALUE; ++value) {
+        check((0 != counts[value]) == (NULL != avl_find_data(tree, &value)), "wrong search result");
+
+        if (0 != counts[value]) {
+            check(SCL_OK == avl_delete(tree, &value), "value not deleted");
+            check(NULL == avl_find_data(tree, &value), "deleted value found");
+        }
+    }
+
+    check(1 == is_avl_empty(tree), "tree not empty after deleting every value");
+
+    printf("%s: %lu values loaded into %lu nodes\n", name, number_of_data, distinct_values);
+
+    free_avl(tree);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_6.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will load avl trees from sorted, unsorted and repeated values\n\n");
+
+    srand(42);
+
+    /* No values at all */
+    check_bulk_load(0, 0, "Empty input");
+
+    /* Sorted distinct values are used as they are */
+    for (int i = 0; i < MAX_VALUE; ++i) {
+        input[i] = i;
+    }
+
+    check_bulk_load(MAX_VALUE, 0, "Sorted input");
+
+    /* Unsorted values with duplicates are sorted in a copy */
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        input[i] = rand() % MAX_VALUE;
+    }
+
+    check_bulk_load(NUMBER_OF_DATA, 0, "Unsorted input");
+    check_bulk_load(NUMBER_OF_DATA, 64, "Unsorted input, pooled nodes");
+
+    /* Sorted values with runs of duplicates */
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        input[i] = i / 3;
+    }
+
+    check_bulk_load(NUMBER_OF_DATA, 64, "Sorted input with duplicates, pooled nodes");
+
+    /* One value repeated */
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        input[i] = 7;
+    }
+
+    check_bulk_load(NUMBER_OF_DATA, 0, "One repeated value");
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_VALUES 5000
+#define NUMBER_OF_OPERATIONS 50000
+#define CHECK_PERIOD 1000
+
+/* Values inserted into the b+ tree, kept aside to check the tree */
+uint8_t is_inserted[NUMBER_OF_VALUES];
+
+/* Values visited by the last traversal, in order */
+int visited_values[NUMBER_OF_VALUES];
+size_t number_of_visited_values = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Action function to remember the visited values */
+void visit_value(void * const data) {
+    if (NUMBER_OF_VALUES > number_of_visited_values) {
+        visited_values[number_of_visited_values++] = *(int *)data;
+    }
+}
+
+/* Check that the values from [lo, hi] are visited in order and are just the inserted ones */
+void check_range(const btree_t * const tree, int lo, int hi) {
+    number_of_visited_values = 0;
+
+    if (lo <= hi) {
+        btree_range_traverse(tree, &lo, &hi, &visit_value);
+    } else {
+        btree_traverse_inorder(tree, &visit_value);
+        lo = 0;
+        hi = NUMBER_OF_VALUES - 1;
+    }
+
+    size_t position = 0;
+
+    /* The range may go over the inserted values */
+    for (int value = lo; (value <= hi) && (value < NUMBER_OF_VALUES); ++value) {
+        if (0 != is_inserted[value]) {
+            check((position < number_of_visited_values) && (value == visited_values[position]), "value missing or out of order");
+            ++position;
+        }
+    }
+
+    check(position == number_of_visited_values, "too many values visited");
+}
+
+/* Check the size, the extremes and the order of the whole b+ tree */
+void check_tree(const btree_t * const tree) {
+    size_t size = 0;
+    int min_value = -1;
+    int max_value = -1;
+
+    for (int value = 0; value < NUMBER_OF_VALUES; ++value) {
+        if (0 != is_inserted[value]) {
+            if (0 == size++) {
+                min_value = value;
+            }
+
+            max_value = value;
+        }
+    }
+
+    check(size == get_btree_size(tree), "wrong size");
+
+    if (0 != size) {
+        check(min_value == *(const int *)btree_min_data(tree), "wrong minimum");
+        check(max_value == *(const int *)btree_max_data(tree), "wrong maximum");
+    } else {
+        check((NULL == btree_min_data(tree)) && (1 == get_btree_height(tree)), "empty tree not reset");
+    }
+
+    /* Whole tree in order, then a few ranges scanned along the leaves */
+    check_range(tree, 1, 0);
+    check_range(tree, 0, NUMBER_OF_VALUES / 10);
+    check_range(tree, NUMBER_OF_VALUES / 3, NUMBER_OF_VALUES / 2);
+    check_range(tree, NUMBER_OF_VALUES - 7, NUMBER_OF_VALUES + 7);
+}
+
+/* Insert and delete random values, the small nodes split, borrow and merge all the time */
+void run_example(size_t node_capacity) {
+    btree_t *tree = create_btree_with_capacity(&compare_int, NULL, sizeof(int), node_capacity);
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    memset(is_inserted, 0, sizeof(is_inserted));
+
+    size_t max_height = 0;
+
+    for (int iter = 1; iter <= NUMBER_OF_OPERATIONS; ++iter) {
+        int value = rand() % NUMBER_OF_VALUES;
+
+        /* Insert more than delete in the first half, delete more in the second half */
+        if ((rand() % 4) < ((iter <= NUMBER_OF_OPERATIONS / 2) ? 3 : 1)) {
+            check(SCL_OK == btree_insert(tree, &value), "insertion failed");
+            is_inserted[value] = 1;
+        } else {
+            scl_error_t err = btree_delete(tree, &value);
+
+            check((0 != is_inserted[value]) ? (SCL_OK == err) : (SCL_OK != err), "wrong deletion result");
+            is_inserted[value] = 0;
+        }
+
+        const int *found = btree_find_data(tree, &value);
+
+        check((0 != is_inserted[value]) == (NULL != found), "wrong search result");
+
+        if (get_btree_height(tree) > max_height) {
+            max_height = get_btree_height(tree);
+        }
+
+        if (0 == iter % CHECK_PERIOD) {
+            check_tree(tree);
+        }
+    }
+
+    printf("Nodes of %lu values: %lu values left, greatest height %lu\n", tree->node_capacity, get_btree_size(tree), max_height);
+
+    /* Delete everything left, the tree shrinks back to one leaf */
+    for (int value = 0; value < NUMBER_OF_VALUES; ++value) {
+        if (0 != is_inserted[value]) {
+            check(SCL_OK == btree_delete(tree, &value), "deletion of a value left failed");
+            is_inserted[value] = 0;
+        }
+    }
+
+    check_tree(tree);
+    check(SCL_DELETE_FROM_EMPTY_OBJECT == btree_delete(tree, ltoptr(int, 0)), "deletion from an empty tree");
+
+    free_btree(tree);
+    tree = NULL;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will insert and delete random values into b+ trees and check\n");
+    printf("the size, the order and the range scans of the trees\n\n");
+
+    srand(42);
+
+    /* The smallest nodes, odd nodes and the default nodes */
+    run_example(4);
+    run_example(5);
+    run_example(0);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
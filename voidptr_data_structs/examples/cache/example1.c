@@ -0,0 +1,196 @@
+#include <scl_datastruc.h>
+
+#define MAX_LOGGED_KEYS 64
+
+/* Keys that left the cache, in order, written by the free function of the keys */
+int left_keys[MAX_LOGGED_KEYS];
+size_t number_of_left_keys = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* The free function of the keys is called for every pair leaving the cache */
+void log_left_key(void *key) {
+    if (MAX_LOGGED_KEYS > number_of_left_keys) {
+        left_keys[number_of_left_keys++] = *(int *)key;
+    }
+}
+
+/* Check the keys that left the cache since the last call */
+void check_left_keys(const int * const expected_keys, size_t number_of_keys, const char * const message) {
+    check(number_of_keys == number_of_left_keys, message);
+
+    for (size_t i = 0; (i < number_of_keys) && (i < number_of_left_keys); ++i) {
+        check(expected_keys[i] == left_keys[i], message);
+    }
+
+    printf("%s:", message);
+
+    for (size_t i = 0; i < number_of_left_keys; ++i) {
+        printf(" %d", left_keys[i]);
+    }
+
+    printf("\n");
+
+    number_of_left_keys = 0;
+}
+
+/* Insert the keys with the data key * 10 */
+void put_keys(cache_t * const cache, const int * const keys, size_t number_of_keys) {
+    for (size_t i = 0; i < number_of_keys; ++i) {
+        int data = keys[i] * 10;
+
+        check(SCL_OK == cache_put(cache, &keys[i], &data), "insertion failed");
+    }
+}
+
+/* The least recently used pair is evicted, cache_peek does not count as a use */
+void lru_example(void) {
+    cache_t *cache = create_cache(4, 0, CACHE_POLICY_LRU, &hash_int, &compare_int, &log_left_key, NULL, sizeof(int), sizeof(int));
+
+    if (NULL == cache) {
+        exit(EXIT_FAILURE);
+    }
+
+    put_keys(cache, (const int []){1, 2, 3, 4}, 4);
+
+    const int *data = cache_get(cache, ltoptr(int, 1));
+
+    check((NULL != data) && (10 == *data), "key 1 missing");
+
+    /* Recency from the most recent: 1 4 3 2, so 2 is evicted */
+    put_keys(cache, (const int []){5}, 1);
+    check_left_keys((const int []){2}, 1, "LRU evicted after using 1");
+
+    /* Peeking 3 does not save it */
+    check(NULL != cache_peek(cache, ltoptr(int, 3)), "key 3 missing");
+    put_keys(cache, (const int []){6}, 1);
+    check_left_keys((const int []){3}, 1, "LRU evicted after peeking 3");
+
+    /* Touching 4 saves it, 1 is the least recently used now */
+    check(1 == cache_touch(cache, ltoptr(int, 4)), "key 4 missing");
+    put_keys(cache, (const int []){7}, 1);
+    check_left_keys((const int []){1}, 1, "LRU evicted after touching 4");
+
+    check(4 == get_cache_size(cache), "wrong size of the LRU cache");
+    check(NULL == cache_get(cache, ltoptr(int, 2)), "evicted key 2 found");
+
+    cache_stats_t stats;
+
+    cache_get_stats(cache, &stats);
+    check((1 == stats.hits) && (1 == stats.misses) && (3 == stats.evictions), "wrong LRU statistics");
+
+    /* Freeing the cache calls the free function for all the pairs left */
+    free_cache(cache);
+    check(4 == number_of_left_keys, "pairs left not freed with the LRU cache");
+    number_of_left_keys = 0;
+}
+
+/*
+ * The clock hand clears the reference bits of the used pairs and evicts
+ * the first pair not used since it passed, so a used pair gets a second
+ * chance even if it is the oldest one
+ */
+void clock_example(void) {
+    cache_t *cache = create_cache(4, 0, CACHE_POLICY_CLOCK, &hash_int, &compare_int, &log_left_key, NULL, sizeof(int), sizeof(int));
+
+    if (NULL == cache) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* The hand starts on 1, the pairs follow in insertion order */
+    put_keys(cache, (const int []){1, 2, 3, 4}, 4);
+
+    check(NULL != cache_get(cache, ltoptr(int, 1)), "key 1 missing");
+    check(NULL != cache_get(cache, ltoptr(int, 3)), "key 3 missing");
+
+    /* The hand clears 1 and evicts 2 */
+    put_keys(cache, (const int []){5}, 1);
+    check_left_keys((const int []){2}, 1, "CLOCK evicted after using 1 and 3");
+
+    /* The hand clears 3 and evicts 4 */
+    put_keys(cache, (const int []){6}, 1);
+    check_left_keys((const int []){4}, 1, "CLOCK evicted second");
+
+    /* 1 was not used since the hand passed it */
+    put_keys(cache, (const int []){7}, 1);
+    check_left_keys((const int []){1}, 1, "CLOCK evicted third");
+
+    for (int key = 3; key <= 7; ++key) {
+        check((4 != key) == (NULL != cache_peek(cache, &key)), "wrong pairs left in the CLOCK cache");
+    }
+
+    free_cache(cache);
+    number_of_left_keys = 0;
+}
+
+/* The cache is bounded by the bytes charged for the pairs */
+void max_bytes_example(void) {
+    cache_t *cache = create_cache(0, 100, CACHE_POLICY_LRU, &hash_int, &compare_int, &log_left_key, NULL, sizeof(int), sizeof(int));
+
+    if (NULL == cache) {
+        exit(EXIT_FAILURE);
+    }
+
+    check(SCL_OK == cache_put_with_cost(cache, ltoptr(int, 1), ltoptr(int, 10), 40), "insertion failed");
+    check(SCL_OK == cache_put_with_cost(cache, ltoptr(int, 2), ltoptr(int, 20), 40), "insertion failed");
+
+    /* 110 bytes do not fit, 1 is evicted */
+    check(SCL_OK == cache_put_with_cost(cache, ltoptr(int, 3), ltoptr(int, 30), 30), "insertion failed");
+    check_left_keys((const int []){1}, 1, "Evicted for 30 more bytes");
+    check(70 == get_cache_bytes(cache), "wrong bytes after the first eviction");
+
+    /* Charging 90 bytes for 2 evicts 3, the replaced pair itself is kept */
+    check(SCL_OK == cache_put_with_cost(cache, ltoptr(int, 2), ltoptr(int, 21), 90), "replacement failed");
+    check_left_keys((const int []){3}, 1, "Evicted when 2 grew to 90 bytes");
+    check(90 == get_cache_bytes(cache), "wrong bytes after the replacement");
+
+    const int *data = cache_peek(cache, ltoptr(int, 2));
+
+    check((NULL != data) && (21 == *data), "replaced data missing");
+
+    /* A pair greater than the whole cache is refused and nothing is evicted */
+    check(SCL_INVALID_INPUT == cache_put_with_cost(cache, ltoptr(int, 4), ltoptr(int, 40), 101), "too big pair inserted");
+    check_left_keys(NULL, 0, "Evicted for a pair too big");
+
+    /* Deleting a pair gives its bytes back */
+    check(SCL_OK == cache_delete_key(cache, ltoptr(int, 2)), "deletion failed");
+    check_left_keys((const int []){2}, 1, "Deleted");
+    check((0 == get_cache_bytes(cache)) && (1 == is_cache_empty(cache)), "cache not empty after deletion");
+
+    free_cache(cache);
+    number_of_left_keys = 0;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will check which pairs are evicted by every policy of the cache\n\n");
+
+    lru_example();
+    clock_example();
+    max_bytes_example();
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
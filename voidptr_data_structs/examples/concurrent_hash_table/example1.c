@@ -0,0 +1,157 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_READERS 4
+#define NUMBER_OF_WRITERS 4
+#define NUMBER_OF_KEYS 20000
+#define NUMBER_OF_WRITES 50000
+
+/*
+ * The keys from [0, NUMBER_OF_KEYS / 2) are inserted once by the main thread
+ * with the data key * 3 and never deleted, the keys from
+ * [NUMBER_OF_KEYS / 2, NUMBER_OF_KEYS) are inserted with the data key * 7 and
+ * deleted again and again by the writers
+ */
+concurrent_hash_table_t *cht = NULL;
+
+/* Number of stable keys inserted so far */
+atomic_int published_keys;
+
+/* Set when all the writers are done */
+atomic_int stop_readers;
+
+/* Number of failed checks of all the threads */
+atomic_int failed_checks;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message, int key) {
+    if (0 == condition) {
+        atomic_fetch_add(&failed_checks, 1);
+        printf("Check failed: %s (key %d)\n", message, key);
+    }
+}
+
+/* Search random keys until the writers are done */
+void* reader_thread(void *arg) {
+    unsigned int seed = (unsigned int)(size_t)arg;
+    size_t found_keys = 0;
+
+    while (0 == atomic_load(&stop_readers)) {
+        int key = rand_r(&seed) % NUMBER_OF_KEYS;
+        int published = atomic_load(&published_keys);
+        int data = 0;
+
+        scl_error_t err = concurrent_hash_table_find_data(cht, &key, &data);
+
+        if (key < published) {
+            /* A published stable key is always found, even while the buckets are replaced */
+            check((SCL_OK == err) && (key * 3 == data), "stable key missing or with wrong data", key);
+            ++found_keys;
+        } else if ((key >= NUMBER_OF_KEYS / 2) && (SCL_OK == err)) {
+            /* A churning key is either missing or complete */
+            check(key * 7 == data, "churning key with wrong data", key);
+            ++found_keys;
+        }
+    }
+
+    return (void *)found_keys;
+}
+
+/* Insert and delete random churning keys */
+void* writer_thread(void *arg) {
+    unsigned int seed = (unsigned int)(size_t)arg;
+
+    for (int iter = 0; iter < NUMBER_OF_WRITES; ++iter) {
+        int key = NUMBER_OF_KEYS / 2 + rand_r(&seed) % (NUMBER_OF_KEYS / 2);
+
+        if (0 != (rand_r(&seed) & 1)) {
+            int data = key * 7;
+
+            check(SCL_OK == concurrent_hash_table_insert(cht, &key, &data), "insertion failed", key);
+        } else {
+            scl_error_t err = concurrent_hash_table_delete_key(cht, &key);
+
+            check((SCL_OK == err) || (SCL_DATA_NOT_FOUND_FOR_DELETE == err), "deletion failed", key);
+        }
+    }
+
+    return NULL;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example %d readers search keys while %d writers insert and delete keys\n", NUMBER_OF_READERS, NUMBER_OF_WRITERS);
+    printf("and the buckets are resized many times, every reader checks every key it finds\n\n");
+
+    /* Start from the smallest capacity so the buckets are replaced while the readers search */
+    cht = create_concurrent_hash_table(0, &hash_int, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int));
+
+    if (NULL == cht) {
+        exit(EXIT_FAILURE);
+    }
+
+    size_t start_capacity = get_concurrent_hash_table_capacity(cht);
+
+    pthread_t readers[NUMBER_OF_READERS];
+    pthread_t writers[NUMBER_OF_WRITERS];
+
+    for (int i = 0; i < NUMBER_OF_READERS; ++i) {
+        pthread_create(&readers[i], NULL, &reader_thread, (void *)(size_t)(i + 1));
+    }
+
+    /* Publish the stable keys one by one, the readers expect to find all of them */
+    for (int key = 0; key < NUMBER_OF_KEYS / 2; ++key) {
+        int data = key * 3;
+
+        check(SCL_OK == concurrent_hash_table_insert(cht, &key, &data), "insertion failed", key);
+        atomic_store(&published_keys, key + 1);
+    }
+
+    for (int i = 0; i < NUMBER_OF_WRITERS; ++i) {
+        pthread_create(&writers[i], NULL, &writer_thread, (void *)(size_t)(i + 100));
+    }
+
+    /* Grow the buckets again while all the threads work */
+    check(SCL_OK == concurrent_hash_table_reserve(cht, 8 * NUMBER_OF_KEYS), "reserve failed", 0);
+
+    for (int i = 0; i < NUMBER_OF_WRITERS; ++i) {
+        pthread_join(writers[i], NULL);
+    }
+
+    atomic_store(&stop_readers, 1);
+
+    for (int i = 0; i < NUMBER_OF_READERS; ++i) {
+        void *found_keys = NULL;
+
+        pthread_join(readers[i], &found_keys);
+        printf("Reader %d found %lu keys\n", i, (size_t)found_keys);
+    }
+
+    /* The size must match the keys left in the table */
+    size_t left_keys = 0;
+
+    for (int key = 0; key < NUMBER_OF_KEYS; ++key) {
+        left_keys += concurrent_hash_table_contains_key(cht, &key);
+    }
+
+    check(left_keys == get_concurrent_hash_table_size(cht), "size does not match the keys", (int)left_keys);
+
+    printf("\n%lu keys left, capacity grew from %lu to %lu\n", left_keys, start_capacity, get_concurrent_hash_table_capacity(cht));
+    printf("%d checks failed\n", atomic_load(&failed_checks));
+
+    free_concurrent_hash_table(cht);
+    cht = NULL;
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != atomic_load(&failed_checks)) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_KEYS 100000
+#define NUMBER_OF_CHURN_ROUNDS 100
+#define NUMBER_OF_CHURN_KEYS 5000
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Compare two heap strings kept as data */
+int32_t compare_name(const void * const data1, const void * const data2) {
+    return strcmp(*(char * const *)data1, *(char * const *)data2);
+}
+
+/* Free the content of one data, the heap string */
+void free_name(void *data) {
+    free(*(char **)data);
+}
+
+/* Allocate a heap string for one key */
+char* make_name(int key) {
+    char *name = malloc(32);
+
+    if (NULL != name) {
+        snprintf(name, 32, "name-%d", key);
+    }
+
+    return name;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will insert, find and delete keys of a flat map while it grows\n");
+    printf("and reuses the slots of the deleted keys\n\n");
+
+    /* Start from the smallest capacity so the flat map is rehashed many times */
+    flat_map_t *fm = create_flat_map(0, &hash_int, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int));
+
+    if (NULL == fm) {
+        exit(EXIT_FAILURE);
+    }
+
+    size_t start_capacity = get_flat_map_capacity(fm);
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        int key = i * 7;
+
+        check(SCL_OK == flat_map_insert(fm, &key, &i), "insertion failed");
+    }
+
+    /* Keys are unique, inserting a key again changes nothing */
+    check(SCL_OK == flat_map_insert(fm, ltoptr(int, 7), ltoptr(int, -1)), "insertion of an existing key failed");
+
+    check(NUMBER_OF_KEYS == get_flat_map_size(fm), "wrong size after insertions");
+    check(start_capacity < get_flat_map_capacity(fm), "capacity did not grow");
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        const int *data = flat_map_find_data(fm, ltoptr(int, i * 7));
+
+        check((NULL != data) && (i == *data), "inserted key missing or with wrong data");
+        check(NULL == flat_map_find_data(fm, ltoptr(int, i * 7 + 1)), "missing key found");
+    }
+
+    printf("Inserted %d keys, capacity grew from %lu to %lu\n", NUMBER_OF_KEYS, start_capacity, get_flat_map_capacity(fm));
+
+    /* Delete the even keys, their slots become deleted slots */
+    for (int i = 0; i < NUMBER_OF_KEYS; i += 2) {
+        check(SCL_OK == flat_map_delete_key(fm, ltoptr(int, i * 7)), "deletion failed");
+    }
+
+    check(SCL_DATA_NOT_FOUND_FOR_DELETE == flat_map_delete_key(fm, ltoptr(int, 0)), "deleted key deleted twice");
+    check(SCL_DATA_NOT_FOUND_FOR_DELETE == flat_map_delete_key_data(fm, ltoptr(int, 7), ltoptr(int, 2)), "deleted a pair with wrong data");
+    check(NUMBER_OF_KEYS / 2 == get_flat_map_size(fm), "wrong size after deletions");
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        const int *data = flat_map_find_data(fm, ltoptr(int, i * 7));
+
+        if (0 == (i & 1)) {
+            check(NULL == data, "deleted key found");
+        } else {
+            check((NULL != data) && (i == *data), "kept key missing after deletions");
+        }
+    }
+
+    printf("Deleted %d keys, %lu keys left\n", NUMBER_OF_KEYS / 2, get_flat_map_size(fm));
+
+    /*
+     * Insert and delete new keys many times, the size stays under half of the
+     * capacity so the deleted slots are reused or dropped in place and the
+     * flat map never grows
+     */
+    size_t churn_capacity = get_flat_map_capacity(fm);
+
+    for (int round = 0; round < NUMBER_OF_CHURN_ROUNDS; ++round) {
+        int first_key = -(round + 1) * NUMBER_OF_CHURN_KEYS;
+
+        for (int key = first_key; key < first_key + NUMBER_OF_CHURN_KEYS; ++key) {
+            check(SCL_OK == flat_map_insert(fm, &key, &round), "churn insertion failed");
+        }
+
+        for (int key = first_key; key < first_key + NUMBER_OF_CHURN_KEYS; ++key) {
+            check(SCL_OK == flat_map_delete_key(fm, &key), "churn deletion failed");
+        }
+    }
+
+    check(churn_capacity == get_flat_map_capacity(fm), "capacity grew while the size stayed the same");
+    check(NUMBER_OF_KEYS / 2 == get_flat_map_size(fm), "wrong size after churn");
+
+    for (int i = 1; i < NUMBER_OF_KEYS; i += 2) {
+        const int *data = flat_map_find_data(fm, ltoptr(int, i * 7));
+
+        check((NULL != data) && (i == *data), "kept key missing after churn");
+    }
+
+    printf("Inserted and deleted %d keys, capacity stayed %lu\n", NUMBER_OF_CHURN_ROUNDS * NUMBER_OF_CHURN_KEYS, get_flat_map_capacity(fm));
+
+    free_flat_map(fm);
+    fm = NULL;
+
+    /* The data is a heap string, the flat map frees it on deletion and when it is freed */
+    fm = create_flat_map(0, &hash_int, &compare_int, &compare_name, NULL, &free_name, sizeof(int), sizeof(char *));
+
+    if (NULL == fm) {
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        char *name = make_name(i);
+
+        check(SCL_OK == flat_map_insert(fm, &i, &name), "insertion of a name failed");
+    }
+
+    for (int i = 0; i < 1000; i += 3) {
+        check(SCL_OK == flat_map_delete_key(fm, &i), "deletion of a name failed");
+    }
+
+    char *name = make_name(1);
+
+    check(1 == flat_map_contains_key_data(fm, ltoptr(int, 1), &name), "name of key 1 missing");
+    free(name);
+
+    printf("Names left: %lu\n", get_flat_map_size(fm));
+
+    /* Every name left is freed, valgrind reports no leaks */
+    free_flat_map(fm);
+    fm = NULL;
+
+    printf("%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <scl_datastruc.h>
+#include <time.h>
+
+#define NUMBER_OF_KEYS 1000000
+
+/* Random keys shared by all the benchmarks */
+int keys[NUMBER_OF_KEYS];
+
+/* Weak hash function, every key is a multiple of 64 */
+size_t hash_int_weak(const void * const key) {
+    return (size_t)(*(const int *)key) << 6;
+}
+
+/* Insert and find NUMBER_OF_KEYS ints into a hash table and measure the time */
+void benchmark_hash_table(hash_table_engine_t engine, const char * const engine_name, uint8_t pow2_capacity) {
+    double exec_time = 0.0;
+
+    scl_error_t err = SCL_OK;
+
+    hash_table_t *ht = create_hash_table_with_engine(0, &hash_int_weak, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int), engine);
+
+    err = hash_table_set_pow2_capacity(ht, pow2_capacity);
+
+    if (SCL_OK != err) {
+        scl_error_message(err);
+    }
+
+    /* Insert the keys and count the time */
+    clock_t begin = clock();
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        err = hash_table_insert(ht, &keys[i], &i);
+
+        if (SCL_OK != err) {
+            scl_error_message(err);
+        }
+    }
+
+    clock_t end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("%s (%s): inserting %d ints: %lf sec\n", engine_name, (0 != pow2_capacity) ? "mask" : "modulo", NUMBER_OF_KEYS, exec_time);
+    /* End to insert the keys */
+
+    /* Find all the keys and count the time */
+    size_t found_keys = 0;
+
+    begin = clock();
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        if (NULL != hash_table_find_data(ht, &keys[i])) {
+            ++found_keys;
+        }
+    }
+
+    end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("%s (%s): finding %lu ints: %lf sec\n\n", engine_name, (0 != pow2_capacity) ? "mask" : "modulo", found_keys, exec_time);
+    /* End to find the keys */
+
+    free_hash_table(ht);
+    ht = NULL;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will compare the modulo bucket selection with the power of two mask bucket selection\n\n");
+
+    /* Generate the random keys */
+    srand(42);
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        keys[i] = rand();
+    }
+
+    benchmark_hash_table(HASH_ENGINE_RBK, "Red black buckets", 0);
+    benchmark_hash_table(HASH_ENGINE_RBK, "Red black buckets", 1);
+
+    benchmark_hash_table(HASH_ENGINE_LINEAR, "Linear probing", 0);
+    benchmark_hash_table(HASH_ENGINE_LINEAR, "Linear probing", 1);
+
+    benchmark_hash_table(HASH_ENGINE_ROBIN_HOOD, "Robin hood", 0);
+    benchmark_hash_table(HASH_ENGINE_ROBIN_HOOD, "Robin hood", 1);
+
+    /* Close output file */
+    fclose(fout);
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <scl_datastruc.h>
+#include <time.h>
+
+#define NUMBER_OF_KEYS 1000000
+
+/* Random keys shared by all the benchmarks */
+int keys[NUMBER_OF_KEYS];
+
+/* Data found for every key by the batched lookup */
+const void *found_data[NUMBER_OF_KEYS];
+
+/* Find NUMBER_OF_KEYS ints one by one and in batches and measure the time */
+void benchmark_hash_table(hash_table_engine_t engine, const char * const engine_name) {
+    double exec_time = 0.0;
+
+    scl_error_t err = SCL_OK;
+
+    hash_table_t *ht = create_hash_table_with_engine(0, &hash_int, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int), engine);
+
+    /* Insert the keys in batches and count the time */
+    clock_t begin = clock();
+
+    err = hash_table_insert_batch(ht, keys, keys, NUMBER_OF_KEYS);
+
+    if (SCL_OK != err) {
+        scl_error_message(err);
+    }
+
+    clock_t end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("%s: batch inserting %d ints: %lf sec\n", engine_name, NUMBER_OF_KEYS, exec_time);
+    /* End to insert the keys */
+
+    /* Find all the keys one by one and count the time */
+    size_t found_keys = 0;
+
+    begin = clock();
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        if (NULL != hash_table_find_data(ht, &keys[i])) {
+            ++found_keys;
+        }
+    }
+
+    end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("%s: finding %lu ints one by one: %lf sec\n", engine_name, found_keys, exec_time);
+    /* End to find the keys one by one */
+
+    /* Find all the keys in batches and count the time */
+    found_keys = 0;
+
+    begin = clock();
+
+    err = hash_table_find_batch(ht, keys, NUMBER_OF_KEYS, found_data);
+
+    if (SCL_OK != err) {
+        scl_error_message(err);
+    }
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        if (NULL != found_data[i]) {
+            ++found_keys;
+        }
+    }
+
+    end = clock();
+
+    exec_time = (double)(end - begin) / CLOCKS_PER_SEC;
+    printf("%s: finding %lu ints in batches: %lf sec\n\n", engine_name, found_keys, exec_time);
+    /* End to find the keys in batches */
+
+    free_hash_table(ht);
+    ht = NULL;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_2.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will compare the lookup of keys one by one with the batched lookup\n\n");
+
+    /* Generate the random keys */
+    srand(42);
+
+    for (int i = 0; i < NUMBER_OF_KEYS; ++i) {
+        keys[i] = rand();
+    }
+
+    benchmark_hash_table(HASH_ENGINE_RBK, "Red black buckets");
+    benchmark_hash_table(HASH_ENGINE_LINEAR, "Linear probing");
+    benchmark_hash_table(HASH_ENGINE_ROBIN_HOOD, "Robin hood");
+
+    /* Close output file */
+    fclose(fout);
+
+    return 0;
+}
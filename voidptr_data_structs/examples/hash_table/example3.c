@@ -0,0 +1,137 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_KEYS 5000
+
+/* Number of times every key was visited by one iteration */
+int visits[NUMBER_OF_KEYS];
+
+/* Keys that should still be in the hash table */
+uint8_t is_left[NUMBER_OF_KEYS];
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Weak hash function, many keys share one bucket or one cluster */
+size_t hash_int_weak(const void * const key) {
+    return (size_t)(*(const int *)key / 8);
+}
+
+/*
+ * Iterate over all the pairs, erase the keys selected by the step
+ * and check that every left key was visited exactly once
+ */
+void iterate_and_erase(hash_table_t * const ht, int erase_step, const char * const name) {
+    hash_table_iter_t iter;
+
+    memset(visits, 0, sizeof(visits));
+
+    check(SCL_OK == hash_table_iter_begin(ht, &iter), "iterator not started");
+    check(NULL == ht->old_buckets, "rehashing not finished by the iterator");
+
+    size_t erased_keys = 0;
+
+    while (1 == hash_table_iter_next(ht, &iter)) {
+        int key = *(const int *)iter.key;
+
+        if ((key < 0) || (key >= NUMBER_OF_KEYS) || (0 == is_left[key])) {
+            check(0, "unknown key visited");
+            continue;
+        }
+
+        check(key == *(const int *)iter.data, "wrong data visited");
+        ++visits[key];
+
+        if ((0 != erase_step) && (0 == key % erase_step)) {
+            check(SCL_OK == hash_table_iter_erase(ht, &iter), "pair not erased");
+            check(SCL_OK != hash_table_iter_erase(ht, &iter), "pair erased twice");
+            is_left[key] = 0;
+            ++erased_keys;
+        }
+    }
+
+    size_t left_keys = 0;
+
+    for (int key = 0; key < NUMBER_OF_KEYS; ++key) {
+        if ((0 != is_left[key]) || (0 != visits[key])) {
+            check(1 == visits[key], "key not visited exactly once");
+        }
+
+        if (0 != is_left[key]) {
+            check(key == *(const int *)hash_table_find_data(ht, &key), "left key not found");
+            ++left_keys;
+        } else {
+            check(NULL == hash_table_find_data(ht, &key), "erased key found");
+        }
+    }
+
+    check(left_keys == get_hash_table_size(ht), "wrong size after erasing");
+
+    printf("%s: erased %lu keys, %lu keys left\n", name, erased_keys, left_keys);
+}
+
+/* Erase keys while iterating with one engine and one hash function */
+void erase_while_iterating(hash_table_engine_t engine, hash_func hash, size_t rehash_step, const char * const name) {
+    hash_table_t *ht = create_hash_table_with_engine(0, hash, &compare_int, &compare_int, NULL, NULL, sizeof(int), sizeof(int), engine);
+
+    if (NULL == ht) {
+        exit(EXIT_FAILURE);
+    }
+
+    check(SCL_OK == hash_table_set_rehash_step(ht, rehash_step), "rehash step not set");
+
+    for (int key = 0; key < NUMBER_OF_KEYS; ++key) {
+        check(SCL_OK == hash_table_insert(ht, &key, &key), "key not inserted");
+        is_left[key] = 1;
+    }
+
+    /* The last insertions left a rehashing in progress */
+    if (0 != rehash_step) {
+        check(NULL != ht->old_buckets, "no rehashing in progress");
+    }
+
+    iterate_and_erase(ht, 3, name);
+    iterate_and_erase(ht, 0, name);
+    iterate_and_erase(ht, 1, name);
+
+    check(1 == is_hash_table_empty(ht), "hash table not empty after erasing every key");
+
+    free_hash_table(ht);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_3.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will erase pairs while iterating over a hash table\n");
+    printf("and check that every pair left is still visited exactly once\n\n");
+
+    erase_while_iterating(HASH_ENGINE_RBK, &hash_int, 0, "Red black buckets");
+    erase_while_iterating(HASH_ENGINE_RBK, &hash_int_weak, 0, "Red black buckets, weak hash");
+    erase_while_iterating(HASH_ENGINE_RBK, &hash_int_weak, 1, "Red black buckets, rehashing in progress");
+    erase_while_iterating(HASH_ENGINE_LINEAR, &hash_int, 0, "Linear probing");
+    erase_while_iterating(HASH_ENGINE_LINEAR, &hash_int_weak, 0, "Linear probing, weak hash");
+    erase_while_iterating(HASH_ENGINE_ROBIN_HOOD, &hash_int, 0, "Robin hood");
+    erase_while_iterating(HASH_ENGINE_ROBIN_HOOD, &hash_int_weak, 0, "Robin hood, weak hash");
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
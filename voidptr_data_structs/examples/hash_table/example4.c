@@ -0,0 +1,230 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_KEYS 10000
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Free the heap memory owned by one data */
+void free_data(void *data) {
+    free(*(int **)data);
+}
+
+/* Bytes of one saved snapshot file, changed to write broken files */
+uint8_t *file_bytes = NULL;
+size_t file_size = 0;
+
+/* Read a whole file into file_bytes */
+void read_file(const char * const path) {
+    FILE *file = fopen(path, "rb");
+
+    if (NULL == file) {
+        exit(EXIT_FAILURE);
+    }
+
+    fseek(file, 0, SEEK_END);
+    file_size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    file_bytes = malloc(file_size);
+
+    if ((NULL == file_bytes) || (file_size != fread(file_bytes, 1, file_size, file))) {
+        exit(EXIT_FAILURE);
+    }
+
+    fclose(file);
+}
+
+/* Write the first number_of_bytes of file_bytes into a file */
+void write_file(const char * const path, size_t number_of_bytes) {
+    FILE *file = fopen(path, "wb");
+
+    if ((NULL == file) || (number_of_bytes != fwrite(file_bytes, 1, number_of_bytes, file))) {
+        exit(EXIT_FAILURE);
+    }
+
+    fclose(file);
+}
+
+/* Save a hash table of one engine, reopen it and check every lookup */
+void save_and_open(hash_table_engine_t engine, const char * const name) {
+    hash_table_t *ht = create_hash_table_with_engine(0, &hash_int, &compare_int, &compare_double, NULL, NULL, sizeof(int), sizeof(double), engine);
+
+    if (NULL == ht) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* Even keys are saved, odd keys are missing */
+    for (int key = 0; key < 2 * NUMBER_OF_KEYS; key += 2) {
+        double data = key * 0.5;
+
+        check(SCL_OK == hash_table_insert(ht, &key, &data), "pair not inserted");
+    }
+
+    check(SCL_OK == hash_table_save_snapshot(ht, "snapshot.txt"), "snapshot not saved");
+    free_hash_table(ht);
+
+    hash_table_snapshot_t *snapshot = open_hash_table_snapshot("snapshot.txt", &hash_int, &compare_int, sizeof(int), sizeof(double));
+
+    if (NULL == snapshot) {
+        exit(EXIT_FAILURE);
+    }
+
+    check(NUMBER_OF_KEYS == get_hash_table_snapshot_size(snapshot), "wrong snapshot size");
+
+    int keys[2 * NUMBER_OF_KEYS];
+    const void *found_data[2 * NUMBER_OF_KEYS];
+
+    for (int key = 0; key < 2 * NUMBER_OF_KEYS; ++key) {
+        const double *data = hash_table_snapshot_find_data(snapshot, &key);
+
+        if (0 == key % 2) {
+            check((NULL != data) && (key * 0.5 == *data), "saved key not found");
+        } else {
+            check(NULL == data, "missing key found");
+        }
+
+        keys[key] = key;
+    }
+
+    check(SCL_OK == hash_table_snapshot_find_batch(snapshot, keys, 2 * NUMBER_OF_KEYS, found_data), "batch not searched");
+
+    for (int key = 0; key < 2 * NUMBER_OF_KEYS; ++key) {
+        check(found_data[key] == hash_table_snapshot_find_data(snapshot, &key), "wrong batch result");
+    }
+
+    check(SCL_OK == close_hash_table_snapshot(snapshot), "snapshot not closed");
+
+    printf("%s: %d pairs saved and found again\n", name, NUMBER_OF_KEYS);
+}
+
+/* Write the first number_of_bytes of the changed file and try to open it */
+uint8_t can_open_file(size_t number_of_bytes) {
+    write_file("changed_snapshot.txt", number_of_bytes);
+
+    hash_table_snapshot_t *snapshot = open_hash_table_snapshot("changed_snapshot.txt", &hash_int, &compare_int, sizeof(int), sizeof(double));
+
+    if (NULL == snapshot) {
+        return 0;
+    }
+
+    close_hash_table_snapshot(snapshot);
+
+    return 1;
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_4.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will save hash tables into snapshot files, reopen them\n");
+    printf("and check that broken snapshot files are not opened\n\n");
+
+    save_and_open(HASH_ENGINE_RBK, "Red black buckets");
+    save_and_open(HASH_ENGINE_LINEAR, "Linear probing");
+    save_and_open(HASH_ENGINE_ROBIN_HOOD, "Robin hood");
+
+    /* Pairs owning other memory are not saved */
+    hash_table_t *ht = create_hash_table(0, &hash_int, &compare_int, &compare_int, NULL, &free_data, sizeof(int), sizeof(int *));
+
+    if (NULL == ht) {
+        exit(EXIT_FAILURE);
+    }
+
+    check(SCL_INVALID_INPUT == hash_table_save_snapshot(ht, "owner_snapshot.txt"), "pairs owning memory saved");
+    FILE *owner_file = fopen("owner_snapshot.txt", "rb");
+
+    check(NULL == owner_file, "snapshot file written for pairs owning memory");
+
+    if (NULL != owner_file) {
+        fclose(owner_file);
+    }
+
+    free_hash_table(ht);
+
+    /* The snapshot is opened just with the saved types */
+    hash_table_snapshot_t *snapshot = open_hash_table_snapshot("snapshot.txt", &hash_int, &compare_int, sizeof(int), sizeof(float));
+
+    check(NULL == snapshot, "snapshot opened with another data type");
+
+    if (NULL != snapshot) {
+        close_hash_table_snapshot(snapshot);
+    }
+
+    /* Change the last saved file in many ways */
+    read_file("snapshot.txt");
+
+    hash_table_snapshot_header_t header;
+    memcpy(&header, file_bytes, sizeof(header));
+
+    check(1 == can_open_file(file_size), "copy of the snapshot not opened");
+
+    check(0 == can_open_file(file_size - 1), "cut snapshot opened");
+    check(0 == can_open_file(sizeof(header) - 1), "cut header opened");
+
+    /* A pair cannot be further from its home slot than the number of pairs */
+    hash_table_slot_t *slots = (hash_table_slot_t *)(file_bytes + header.slots_offset);
+    size_t slot = 0;
+
+    while (0 == slots[slot].dist) {
+        ++slot;
+    }
+
+    slots[slot].dist = UINT32_MAX;
+
+    check(0 == can_open_file(file_size), "snapshot with a too far pair opened");
+
+    /* Every slot holds a pair, so a probe would never find an empty slot */
+    for (size_t iter = 0; iter < header.capacity; ++iter) {
+        slots[iter].dist = 1;
+    }
+
+    check(0 == can_open_file(file_size), "snapshot without empty slots opened");
+
+    /* Read the saved file again */
+    free(file_bytes);
+    read_file("snapshot.txt");
+
+    /* The pairs must have the aligned layout of the writer */
+    hash_table_snapshot_header_t *changed_header = (hash_table_snapshot_header_t *)file_bytes;
+
+    ++(changed_header->data_offset);
+    check(0 == can_open_file(file_size), "snapshot with misaligned data opened");
+    --(changed_header->data_offset);
+
+    ++(changed_header->entry_size);
+    check(0 == can_open_file(file_size), "snapshot with misaligned pairs opened");
+    --(changed_header->entry_size);
+
+    check(1 == can_open_file(file_size), "restored snapshot not opened");
+
+    file_bytes[0] = 'X';
+
+    check(0 == can_open_file(file_size), "snapshot without signature opened");
+
+    printf("Broken snapshots were not opened\n");
+
+    free(file_bytes);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,292 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_PEOPLE 5000
+#define NODES_PER_CHUNK 64
+
+/* Data of the trees, the name is allocated on the heap */
+typedef struct {
+    int id;
+    char *name;
+} person_t;
+
+/* People given to the trees and their random insertion order */
+person_t people[NUMBER_OF_PEOPLE];
+int ids[NUMBER_OF_PEOPLE];
+
+/* People that should still be in the tree */
+uint8_t is_left[NUMBER_OF_PEOPLE];
+
+/* Range of ids deleted at once */
+const person_t range_lo = { 1000, NULL };
+const person_t range_hi = { 1999, NULL };
+
+/* Number of names allocated and not freed yet */
+int live_names = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Compare two people by their ids */
+int compare_person(const void * const data1, const void * const data2) {
+    return compare_int(&((const person_t *)data1)->id, &((const person_t *)data2)->id);
+}
+
+/* Free the name of one person */
+void free_person(void *data) {
+    free(((person_t *)data)->name);
+    --live_names;
+}
+
+/* Create every person with a heap allocated name and shuffle the ids */
+void make_people(void) {
+    for (int id = 0; id < NUMBER_OF_PEOPLE; ++id) {
+        people[id].id = id;
+        people[id].name = malloc(32);
+
+        if (NULL == people[id].name) {
+            exit(EXIT_FAILURE);
+        }
+
+        snprintf(people[id].name, 32, "person-%d", id);
+        ++live_names;
+
+        ids[id] = id;
+        is_left[id] = 1;
+    }
+
+    for (int i = NUMBER_OF_PEOPLE - 1; i > 0; --i) {
+        int j = rand() % (i + 1);
+        int temp = ids[i];
+
+        ids[i] = ids[j];
+        ids[j] = temp;
+    }
+}
+
+/* Mark the people deleted from the tree */
+void mark_deleted_people(void) {
+    for (int id = 0; id < NUMBER_OF_PEOPLE; id += 3) {
+        is_left[id] = 0;
+    }
+
+    for (int id = range_lo.id; id <= range_hi.id; ++id) {
+        is_left[id] = 0;
+    }
+}
+
+/* Check one person found in the tree */
+size_t check_person(const person_t * const found, int id) {
+    check((0 != is_left[id]) == (NULL != found), "wrong search result");
+
+    if ((NULL != found) && (0 != strcmp(found->name, people[id].name))) {
+        check(0, "wrong name");
+    }
+
+    return (NULL != found) ? 1 : 0;
+}
+
+/*
+ * After the tree is freed every name must be released. A tree with a free
+ * function released them on deletion and when it was freed, a tree without
+ * one never owned them, so they are released here.
+ */
+void check_names(free_func frd) {
+    if (NULL == frd) {
+        for (int id = 0; id < NUMBER_OF_PEOPLE; ++id) {
+            free_person(&people[id]);
+        }
+    }
+
+    check(0 == live_names, "names left after the tree was freed");
+}
+
+/* Insert, delete and free a pooled bst tree still holding people */
+void bst_example(free_func frd) {
+    make_people();
+
+    bst_tree_t *tree = create_bst_with_pool(&compare_person, frd, sizeof(person_t), NODES_PER_CHUNK);
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < NUMBER_OF_PEOPLE; ++i) {
+        check(SCL_OK == bst_insert(tree, &people[ids[i]]), "bst insertion failed");
+    }
+
+    for (int id = 0; id < NUMBER_OF_PEOPLE; id += 3) {
+        check(SCL_OK == bst_delete(tree, &people[id]), "bst deletion failed");
+    }
+
+    check(SCL_OK == bst_range_delete(tree, &range_lo, &range_hi), "bst range deletion failed");
+    mark_deleted_people();
+
+    size_t left_people = 0;
+
+    for (int id = 0; id < NUMBER_OF_PEOPLE; ++id) {
+        left_people += check_person(bst_find_data(tree, &people[id]), id);
+    }
+
+    check(left_people == get_bst_size(tree), "wrong bst size");
+    check(left_people == get_pool_used_objects(tree->pool), "wrong number of pooled bst nodes");
+
+    printf("bst tree %s free function: %lu people left in %lu chunks\n", (NULL != frd) ? "with" : "without", left_people, get_pool_number_of_chunks(tree->pool));
+
+    check(SCL_OK == free_bst(tree), "bst tree not freed");
+    check_names(frd);
+}
+
+/* Insert, delete and free a pooled avl tree still holding people */
+void avl_example(free_func frd) {
+    make_people();
+
+    avl_tree_t *tree = create_avl_with_pool(&compare_person, frd, sizeof(person_t), NODES_PER_CHUNK);
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < NUMBER_OF_PEOPLE; ++i) {
+        check(SCL_OK == avl_insert(tree, &people[ids[i]]), "avl insertion failed");
+    }
+
+    for (int id = 0; id < NUMBER_OF_PEOPLE; id += 3) {
+        check(SCL_OK == avl_delete(tree, &people[id]), "avl deletion failed");
+    }
+
+    check(SCL_OK == avl_range_delete(tree, &range_lo, &range_hi), "avl range deletion failed");
+    mark_deleted_people();
+
+    size_t left_people = 0;
+
+    for (int id = 0; id < NUMBER_OF_PEOPLE; ++id) {
+        left_people += check_person(avl_find_data(tree, &people[id]), id);
+    }
+
+    check(left_people == get_avl_size(tree), "wrong avl size");
+    check(left_people == get_pool_used_objects(tree->pool), "wrong number of pooled avl nodes");
+
+    printf("avl tree %s free function: %lu people left in %lu chunks\n", (NULL != frd) ? "with" : "without", left_people, get_pool_number_of_chunks(tree->pool));
+
+    check(SCL_OK == free_avl(tree), "avl tree not freed");
+    check_names(frd);
+}
+
+/* Insert, delete and free a pooled rbk tree still holding people */
+void rbk_example(free_func frd) {
+    make_people();
+
+    rbk_tree_t *tree = create_rbk_with_pool(&compare_person, frd, sizeof(person_t), NODES_PER_CHUNK);
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < NUMBER_OF_PEOPLE; ++i) {
+        check(SCL_OK == rbk_insert(tree, &people[ids[i]]), "rbk insertion failed");
+    }
+
+    for (int id = 0; id < NUMBER_OF_PEOPLE; id += 3) {
+        check(SCL_OK == rbk_delete(tree, &people[id]), "rbk deletion failed");
+    }
+
+    check(SCL_OK == rbk_range_delete(tree, &range_lo, &range_hi), "rbk range deletion failed");
+    mark_deleted_people();
+
+    size_t left_people = 0;
+
+    for (int id = 0; id < NUMBER_OF_PEOPLE; ++id) {
+        left_people += check_person(rbk_find_data(tree, &people[id]), id);
+    }
+
+    check(left_people == get_rbk_size(tree), "wrong rbk size");
+    check(left_people == get_pool_used_objects(tree->pool), "wrong number of pooled rbk nodes");
+
+    printf("rbk tree %s free function: %lu people left in %lu chunks\n", (NULL != frd) ? "with" : "without", left_people, get_pool_number_of_chunks(tree->pool));
+
+    check(SCL_OK == free_rbk(tree), "rbk tree not freed");
+    check_names(frd);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will use a pool alone and pooled trees with and without a free function.\n");
+    printf("Run it under valgrind, every node and every name must be released when the trees are freed\n\n");
+
+    srand(42);
+
+    /* Released objects are reused before new ones are carved */
+    pool_t *pool = create_pool(sizeof(person_t), NODES_PER_CHUNK);
+
+    if (NULL == pool) {
+        exit(EXIT_FAILURE);
+    }
+
+    void *objects[3 * NODES_PER_CHUNK];
+
+    for (int i = 0; i < 3 * NODES_PER_CHUNK; ++i) {
+        objects[i] = pool_alloc(pool);
+        check(NULL != objects[i], "pool allocation failed");
+    }
+
+    check(3 == get_pool_number_of_chunks(pool), "wrong number of pool chunks");
+
+    void *released = objects[NODES_PER_CHUNK];
+
+    check(SCL_OK == pool_free(pool, released), "pool release failed");
+    check(released == pool_alloc(pool), "released pool object not reused");
+    check(3 * NODES_PER_CHUNK == get_pool_used_objects(pool), "wrong number of used pool objects");
+
+    /* Reserved objects are carved one after another */
+    check(SCL_OK == pool_reserve(pool, 4 * NODES_PER_CHUNK), "pool reservation failed");
+
+    uint8_t *first = pool_alloc(pool);
+    uint8_t *second = pool_alloc(pool);
+
+    check(first + pool->object_size == second, "reserved pool objects not contiguous");
+    check(4 == get_pool_number_of_chunks(pool), "wrong number of pool chunks after reservation");
+
+    /* Reservations bigger than the memory are refused */
+    check(SCL_INVALID_INPUT == pool_reserve(pool, SIZE_MAX / pool->object_size + 1), "overflowing pool reservation accepted");
+    check(SCL_INVALID_INPUT == pool_reserve(pool, SIZE_MAX), "overflowing pool reservation accepted");
+    check(4 == get_pool_number_of_chunks(pool), "chunk added by a refused reservation");
+    check(NULL == create_pool(SIZE_MAX / 2, 4), "overflowing pool created");
+
+    printf("Pool: %lu objects used in %lu chunks\n\n", get_pool_used_objects(pool), get_pool_number_of_chunks(pool));
+
+    check(SCL_OK == free_pool(pool), "pool not freed");
+
+    /* Pooled trees freed while they still hold people */
+    bst_example(&free_person);
+    bst_example(NULL);
+
+    avl_example(&free_person);
+    avl_example(NULL);
+
+    rbk_example(&free_person);
+    rbk_example(NULL);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
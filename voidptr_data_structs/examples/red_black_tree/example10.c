@@ -0,0 +1,174 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_DATA 5000
+#define MAX_VALUE 2000
+
+/* 1 if the value is in the tree */
+int in_tree[MAX_VALUE];
+
+/* Values in the order of the last traversal */
+int visited[MAX_VALUE];
+
+/* Number of values visited by the last traversal */
+size_t number_of_visited = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Action of the traversals */
+void visit(void * const data) {
+    if (number_of_visited < MAX_VALUE) {
+        visited[number_of_visited] = *(const int *)data;
+    }
+
+    ++number_of_visited;
+}
+
+/* Check the packed links and colors of a subtree and return its black height */
+int check_subtree(const rbk_tree_t * const tree, const rbk_tree_node_t * const node, const rbk_tree_node_t * const parent) {
+    if (tree->nil == node) {
+        return 1;
+    }
+
+    const int black = (int)(node->parent_color & 1);
+
+    check(parent == (const rbk_tree_node_t *)(node->parent_color & ~(uintptr_t)1), "wrong parent link");
+    check(black || ((0 != (node->left->parent_color & 1)) && (0 != (node->right->parent_color & 1))), "red node with a red child");
+
+    const int left_height = check_subtree(tree, node->left, node);
+    const int right_height = check_subtree(tree, node->right, node);
+
+    check(left_height == right_height, "different black heights");
+
+    return left_height + black;
+}
+
+/* Check the tree against the values that should be in it */
+void check_tree(const rbk_tree_t * const tree) {
+    size_t number_of_values = 0;
+
+    for (int value = 0; value < MAX_VALUE; ++value) {
+        check(in_tree[value] == (NULL != rbk_find_data(tree, &value)), "wrong search result");
+        number_of_values += in_tree[value];
+    }
+
+    check(number_of_values == get_rbk_size(tree), "wrong tree size");
+
+    if (tree->nil != tree->root) {
+        check(0 != (tree->root->parent_color & 1), "red root");
+        check_subtree(tree, tree->root, tree->nil);
+    }
+
+    /* Both the traversal and the cursor visit the values in sorted order */
+    number_of_visited = 0;
+    check(SCL_OK == rbk_traverse_inorder(tree, &visit), "inorder traversal failed");
+    check(number_of_values == number_of_visited, "wrong number of visited nodes");
+
+    rbk_cursor_t cursor;
+    size_t index = 0;
+
+    rbk_cursor_first(tree, &cursor);
+
+    for (const int *data = rbk_cursor_data(&cursor); NULL != data; data = rbk_cursor_next(&cursor)) {
+        check((index < number_of_visited) && (visited[index] == *data), "cursor and traversal differ");
+        check((0 == index) || (visited[index - 1] < visited[index]), "traversal not sorted");
+        ++index;
+    }
+
+    check(number_of_values == index, "wrong number of values walked by the cursor");
+
+    number_of_visited = 0;
+    check(SCL_OK == rbk_traverse_level(tree, &visit), "level traversal failed");
+    check(number_of_values == number_of_visited, "wrong number of visited nodes");
+}
+
+/* Insert, delete and walk one tree with packed nodes */
+void check_packed_tree(size_t nodes_per_chunk, const char * const name) {
+    rbk_tree_t *tree = NULL;
+
+    if (0 == nodes_per_chunk) {
+        tree = create_rbk(&compare_int, NULL, sizeof(int));
+    } else {
+        tree = create_rbk_with_pool(&compare_int, NULL, sizeof(int), nodes_per_chunk);
+    }
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    memset(in_tree, 0, sizeof(in_tree));
+
+    /* Packed nodes keep no weight */
+    check(SCL_INVALID_INPUT == rbk_set_order_statistics(tree, 1), "order statistics enabled");
+
+    /* Inserting a value already in the tree changes nothing */
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        int value = rand() % MAX_VALUE;
+
+        check(SCL_OK == rbk_insert(tree, &value), "value not inserted");
+        in_tree[value] = 1;
+    }
+
+    check_tree(tree);
+
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        int value = rand() % MAX_VALUE;
+
+        if (1 == in_tree[value]) {
+            check(SCL_OK == rbk_delete(tree, &value), "value not deleted");
+            in_tree[value] = 0;
+        }
+    }
+
+    check_tree(tree);
+
+    printf("%s: %lu nodes left after the deletions\n", name, get_rbk_size(tree));
+
+    for (int value = 0; value < MAX_VALUE; ++value) {
+        if (1 == in_tree[value]) {
+            check(SCL_OK == rbk_delete(tree, &value), "value not deleted");
+            in_tree[value] = 0;
+        }
+    }
+
+    check_tree(tree);
+    check(1 == is_rbk_empty(tree), "tree not empty after deleting every value");
+
+    free_rbk(tree);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_10.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will insert, delete and walk red black trees with packed nodes\n\n");
+
+    check(4 * sizeof(void *) == sizeof(rbk_tree_node_t), "nodes not packed");
+
+    srand(42);
+
+    check_packed_tree(0, "Packed nodes");
+    check_packed_tree(64, "Packed pooled nodes");
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_DATA 3000
+#define MAX_VALUE 1000
+
+/* Every insertion of the tree, kept sorted */
+int sorted[NUMBER_OF_DATA];
+
+/* Number of elements of the sorted array */
+size_t number_of_elements = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Insert a value into the sorted array after the equal values */
+void sorted_insert(int value) {
+    size_t index = number_of_elements;
+
+    while ((index > 0) && (sorted[index - 1] > value)) {
+        sorted[index] = sorted[index - 1];
+        --index;
+    }
+
+    sorted[index] = value;
+    ++number_of_elements;
+}
+
+/* Remove every copy of a value from the sorted array */
+void sorted_delete(int value) {
+    size_t kept = 0;
+
+    for (size_t i = 0; i < number_of_elements; ++i) {
+        if (sorted[i] != value) {
+            sorted[kept++] = sorted[i];
+        }
+    }
+
+    number_of_elements = kept;
+}
+
+/* Check every select and rank of the tree against the sorted array */
+void check_order_statistics(const rbk_tree_t * const tree, const char * const name) {
+    for (size_t i = 0; i < number_of_elements; ++i) {
+        const int *data = rbk_select_data(tree, i);
+
+        check((NULL != data) && (sorted[i] == *data), "wrong selected value");
+    }
+
+    check(NULL == rbk_select_data(tree, number_of_elements), "value selected past the last index");
+
+    /* Values below, inside and above the key set, in the tree or not */
+    size_t less = 0;
+
+    for (int value = -2; value <= MAX_VALUE + 2; ++value) {
+        while ((less < number_of_elements) && (sorted[less] < value)) {
+            ++less;
+        }
+
+        check(less == rbk_rank(tree, &value), "wrong rank");
+    }
+
+    printf("%s: %lu elements checked\n", name, number_of_elements);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_7.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will check the order statistics of a red black tree against a sorted array\n\n");
+
+    srand(42);
+
+    rbk_tree_t *tree = create_rbk(&compare_int, NULL, sizeof(int));
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* Order statistics are enabled on the empty tree */
+    check(SCL_OK == rbk_set_order_statistics(tree, 1), "order statistics not enabled");
+    check_order_statistics(tree, "Empty tree");
+
+    /* Repeated values are counted once for every insertion */
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        int value = rand() % MAX_VALUE;
+
+        check(SCL_OK == rbk_insert(tree, &value), "value not inserted");
+        sorted_insert(value);
+    }
+
+    check_order_statistics(tree, "Random insertions");
+
+    /* A deletion removes every copy of the value */
+    for (int i = 0; i < MAX_VALUE / 2; ++i) {
+        int value = rand() % MAX_VALUE;
+
+        if (NULL != rbk_find_data(tree, &value)) {
+            check(SCL_OK == rbk_delete(tree, &value), "value not deleted");
+            sorted_delete(value);
+        }
+    }
+
+    check_order_statistics(tree, "Random deletions");
+
+    /* Disabling and enabling again recomputes the weights of the nodes */
+    check(SCL_OK == rbk_set_order_statistics(tree, 0), "order statistics not disabled");
+    check(SIZE_MAX == rbk_rank(tree, &sorted[0]), "rank without order statistics");
+    check(SCL_OK == rbk_set_order_statistics(tree, 1), "order statistics not enabled");
+    check_order_statistics(tree, "Order statistics enabled on a full tree");
+
+    free_rbk(tree);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
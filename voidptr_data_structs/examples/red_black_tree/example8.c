@@ -0,0 +1,178 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_DATA 3000
+#define MAX_VALUE 1000
+
+/* Number of times every value is in the tree, just even values are inserted */
+int counts[2 * MAX_VALUE];
+
+/* Values visited by the last range traversal */
+int visited[2 * MAX_VALUE];
+
+/* Number of values visited by the last range traversal */
+int number_of_visited = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Action of the range traversals */
+void visit(void * const data) {
+    visited[number_of_visited++] = *(const int *)data;
+}
+
+/* Check the count and the traversal of the range [lo, hi] against the counts */
+void check_range(const rbk_tree_t * const tree, int lo, int hi) {
+    size_t expected_count = 0;
+    int expected_visited = 0;
+
+    for (int value = 0; value < 2 * MAX_VALUE; ++value) {
+        if ((value >= lo) && (value <= hi) && (0 != counts[value])) {
+            expected_count += counts[value];
+            ++expected_visited;
+        }
+    }
+
+    check(expected_count == rbk_range_count(tree, &lo, &hi), "wrong range count");
+
+    number_of_visited = 0;
+    check(SCL_OK == rbk_range_traverse(tree, &lo, &hi, &visit), "range not traversed");
+    check(expected_visited == number_of_visited, "wrong number of visited nodes");
+
+    /* Every node of the range is visited once, in sorted order */
+    for (int i = 0; i < number_of_visited; ++i) {
+        check((visited[i] >= lo) && (visited[i] <= hi) && (0 != counts[visited[i]]), "visited value out of the range");
+        check((0 == i) || (visited[i - 1] < visited[i]), "range not traversed in order");
+    }
+}
+
+/* Delete the range [lo, hi] from the tree and from the counts */
+void delete_range(rbk_tree_t * const tree, int lo, int hi) {
+    check(SCL_OK == rbk_range_delete(tree, &lo, &hi), "range not deleted");
+
+    for (int value = 0; value < 2 * MAX_VALUE; ++value) {
+        if ((value >= lo) && (value <= hi)) {
+            counts[value] = 0;
+        }
+    }
+
+    check(0 == rbk_range_count(tree, &lo, &hi), "deleted range not empty");
+}
+
+/* Check the whole tree against the counts */
+void check_tree(const rbk_tree_t * const tree) {
+    size_t distinct_values = 0;
+
+    for (int value = 0; value < 2 * MAX_VALUE; ++value) {
+        check((0 != counts[value]) == (NULL != rbk_find_data(tree, &value)), "wrong search result");
+
+        if (0 != counts[value]) {
+            ++distinct_values;
+        }
+    }
+
+    check(distinct_values == get_rbk_size(tree), "wrong tree size");
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_8.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will count, traverse and delete ranges of a red black tree\n\n");
+
+    srand(42);
+
+    rbk_tree_t *tree = create_rbk(&compare_int, NULL, sizeof(int));
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* Ranges of an empty tree */
+    check_range(tree, 0, 2 * MAX_VALUE);
+    delete_range(tree, 0, 2 * MAX_VALUE);
+    check(1 == is_rbk_empty(tree), "empty tree changed by a range deletion");
+
+    for (int i = 0; i < NUMBER_OF_DATA; ++i) {
+        int value = 2 * (rand() % MAX_VALUE);
+
+        check(SCL_OK == rbk_insert(tree, &value), "value not inserted");
+        ++counts[value];
+    }
+
+    printf("Inserted %d values into %lu nodes\n", NUMBER_OF_DATA, get_rbk_size(tree));
+
+    /* Missing bounds make the function fail */
+    int value = 0;
+
+    check(SIZE_MAX == rbk_range_count(tree, NULL, &value), "range count without a bound");
+    check(SCL_OK != rbk_range_traverse(tree, &value, NULL, &visit), "range traversal without a bound");
+    check(SCL_OK != rbk_range_delete(tree, NULL, NULL), "range deletion without bounds");
+
+    /* Ranges with one value or with no value between the bounds */
+    check_range(tree, 10, 10);
+    check_range(tree, 11, 11);
+    check_range(tree, 9, 11);
+
+    /* Inverted bounds are an empty range */
+    check_range(tree, 20, 10);
+    delete_range(tree, 20, 10);
+    check_tree(tree);
+
+    /* Bounds below, above and around the key set */
+    check_range(tree, -10, -1);
+    check_range(tree, 2 * MAX_VALUE, 3 * MAX_VALUE);
+    check_range(tree, -10, 50);
+    check_range(tree, 2 * MAX_VALUE - 50, 3 * MAX_VALUE);
+    check_range(tree, -10, 3 * MAX_VALUE);
+    check_range(tree, 333, 777);
+
+    /* Deletions of the ranges below and above the key set change nothing */
+    delete_range(tree, -10, -1);
+    delete_range(tree, 2 * MAX_VALUE, 3 * MAX_VALUE);
+    check_tree(tree);
+
+    /* A range around the root deletes the root */
+    int root = *(const int *)get_rbk_root(tree);
+
+    delete_range(tree, root - 7, root + 7);
+    check(root != *(const int *)get_rbk_root(tree), "root not deleted");
+    check_tree(tree);
+    check_range(tree, root - 100, root + 100);
+
+    /* Ranges from the ends of the key set */
+    delete_range(tree, -10, 101);
+    delete_range(tree, 2 * MAX_VALUE - 101, 3 * MAX_VALUE);
+    check_tree(tree);
+    check_range(tree, -10, 3 * MAX_VALUE);
+
+    printf("After the range deletions %lu nodes are left\n", get_rbk_size(tree));
+
+    /* A range with all the values empties the tree */
+    delete_range(tree, -10, 3 * MAX_VALUE);
+    check(1 == is_rbk_empty(tree), "tree not empty after deleting every value");
+    check_range(tree, -10, 3 * MAX_VALUE);
+
+    free_rbk(tree);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <scl_datastruc.h>
+
+#define NUMBER_OF_VALUES 10000
+
+/* Values in the order of the last traversal */
+int visited[NUMBER_OF_VALUES];
+
+/* Number of values visited by the last traversal */
+int number_of_visited = 0;
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* Action of the traversals */
+void visit(void * const data) {
+    if (number_of_visited < NUMBER_OF_VALUES) {
+        visited[number_of_visited] = *(const int *)data;
+    }
+
+    ++number_of_visited;
+}
+
+/* Check that the last traversal visited every value once */
+void check_visited(const char * const message) {
+    int seen[NUMBER_OF_VALUES] = { 0 };
+
+    check(NUMBER_OF_VALUES == number_of_visited, message);
+
+    for (int i = 0; (i < number_of_visited) && (i < NUMBER_OF_VALUES); ++i) {
+        check((visited[i] >= 0) && (visited[i] < NUMBER_OF_VALUES) && (0 == seen[visited[i]]++), message);
+    }
+}
+
+/* Walk a red black tree built from sorted values and free it */
+void walk_tree(int ascending) {
+    rbk_tree_t *tree = create_rbk(&compare_int, NULL, sizeof(int));
+
+    if (NULL == tree) {
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+        int value = ascending ? i : NUMBER_OF_VALUES - 1 - i;
+
+        check(SCL_OK == rbk_insert(tree, &value), "value not inserted");
+    }
+
+    check(NUMBER_OF_VALUES == get_rbk_size(tree), "wrong tree size");
+
+    const int root = *(const int *)get_rbk_root(tree);
+
+    number_of_visited = 0;
+    check(SCL_OK == rbk_traverse_inorder(tree, &visit), "inorder traversal failed");
+    check_visited("wrong inorder traversal");
+
+    for (int i = 0; i < NUMBER_OF_VALUES; ++i) {
+        check(i == visited[i], "inorder traversal not sorted");
+    }
+
+    number_of_visited = 0;
+    check(SCL_OK == rbk_traverse_preorder(tree, &visit), "preorder traversal failed");
+    check_visited("wrong preorder traversal");
+    check(root == visited[0], "preorder traversal does not start from the root");
+
+    number_of_visited = 0;
+    check(SCL_OK == rbk_traverse_postorder(tree, &visit), "postorder traversal failed");
+    check_visited("wrong postorder traversal");
+    check(root == visited[NUMBER_OF_VALUES - 1], "postorder traversal does not end with the root");
+
+    /* The level order visits the nodes by their depth */
+    number_of_visited = 0;
+    check(SCL_OK == rbk_traverse_level(tree, &visit), "level traversal failed");
+    check_visited("wrong level traversal");
+    check(root == visited[0], "level traversal does not start from the root");
+
+    for (int i = 1; i < NUMBER_OF_VALUES; ++i) {
+        check(rbk_data_level(tree, &visited[i - 1]) <= rbk_data_level(tree, &visited[i]), "level traversal not ordered by depth");
+    }
+
+    check(SCL_OK == free_rbk(tree), "tree not freed");
+
+    printf("%s values: %d nodes walked and freed\n", ascending ? "Ascending" : "Descending", NUMBER_OF_VALUES);
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_9.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will walk and free red black trees built from sorted values\n\n");
+
+    walk_tree(1);
+    walk_tree(0);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <scl_datastruc.h>
+
+#define MAX_NUMBER_OF_VALUES 1000
+
+/* Sorted values with duplicates, the reference for the index */
+int sorted_values[MAX_NUMBER_OF_VALUES];
+
+/* Number of failed checks */
+int failed_checks = 0;
+
+/* Count one failed check and print it */
+void check(int condition, const char * const message) {
+    if (0 == condition) {
+        ++failed_checks;
+        printf("Check failed: %s\n", message);
+    }
+}
+
+/* First position of the sorted values not less than key (or greater than key) */
+size_t reference_bound(size_t number_of_values, int key, uint8_t upper) {
+    size_t position = 0;
+
+    while ((position < number_of_values) && ((sorted_values[position] < key) || ((0 != upper) && (sorted_values[position] == key)))) {
+        ++position;
+    }
+
+    return position;
+}
+
+/* Check one bound of the index against the sorted values */
+void check_bound(const int * const found, size_t number_of_values, int key, uint8_t upper) {
+    size_t position = reference_bound(number_of_values, key, upper);
+
+    if (position == number_of_values) {
+        check(NULL == found, "bound found over the maximum");
+    } else {
+        check((NULL != found) && (sorted_values[position] == *found), "wrong bound");
+    }
+}
+
+/* Check all the searches of one index for keys from under the minimum to over the maximum */
+void check_index(const static_index_t * const index, size_t number_of_values) {
+    int min_key = (0 != number_of_values) ? sorted_values[0] - 5 : -5;
+    int max_key = (0 != number_of_values) ? sorted_values[number_of_values - 1] + 5 : 5;
+
+    check(number_of_values == get_static_index_size(index), "wrong size");
+
+    for (int key = min_key; key <= max_key; ++key) {
+        check_bound(static_index_lower_bound(index, &key), number_of_values, key, 0);
+        check_bound(static_index_upper_bound(index, &key), number_of_values, key, 1);
+
+        size_t position = reference_bound(number_of_values, key, 0);
+        const int *found = static_index_find_data(index, &key);
+
+        check(((position < number_of_values) && (key == sorted_values[position])) == (NULL != found), "wrong search result");
+    }
+}
+
+int main(void) {
+    FILE *fout = NULL;
+
+    if ((fout = freopen("out_1.txt", "w", stdout)) == NULL) {
+        exit(EXIT_FAILURE);
+    }
+
+    printf("In this example we will compare the bounds found by static indexes with the bounds\n");
+    printf("of a sorted array, for both layouts and for keys under the minimum and over the maximum\n\n");
+
+    srand(42);
+
+    const static_index_layout_t layouts[] = {STATIC_INDEX_EYTZINGER, STATIC_INDEX_BLOCKED};
+    const char * const layout_names[] = {"eytzinger", "blocked"};
+
+    /* Every size from empty to a few full levels and blocks, then bigger sizes */
+    for (size_t number_of_values = 0; number_of_values <= MAX_NUMBER_OF_VALUES; number_of_values += ((number_of_values < 100) ? 1 : 150)) {
+
+        /* Random values with duplicates, given unsorted to the index */
+        int values[MAX_NUMBER_OF_VALUES];
+
+        for (size_t i = 0; i < number_of_values; ++i) {
+            values[i] = 2 * (rand() % (int)(number_of_values + 1));
+        }
+
+        memcpy(sorted_values, values, number_of_values * sizeof(*values));
+        quick_sort(sorted_values, number_of_values, sizeof(*sorted_values), &compare_int);
+
+        for (int layout = 0; layout < 2; ++layout) {
+            static_index_t *index = create_static_index(&compare_int, sizeof(int), values, number_of_values, layouts[layout]);
+
+            if (NULL == index) {
+                exit(EXIT_FAILURE);
+            }
+
+            check_index(index, number_of_values);
+
+            free_static_index(index);
+            index = NULL;
+        }
+    }
+
+    printf("Checked the arrays of 0 to %d values\n", MAX_NUMBER_OF_VALUES);
+
+    /* Indexes built from the trees hold every value once */
+    avl_tree_t *avl = create_avl(&compare_int, NULL, sizeof(int));
+    rbk_tree_t *rbk = create_rbk(&compare_int, NULL, sizeof(int));
+
+    if ((NULL == avl) || (NULL == rbk)) {
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < 3 * MAX_NUMBER_OF_VALUES; ++i) {
+        int value = 3 * (rand() % MAX_NUMBER_OF_VALUES);
+
+        avl_insert(avl, &value);
+        rbk_insert(rbk, &value);
+    }
+
+    size_t number_of_values = 0;
+
+    for (int value = 0; value < 3 * MAX_NUMBER_OF_VALUES; value += 3) {
+        if (NULL != avl_find_data(avl, &value)) {
+            sorted_values[number_of_values++] = value;
+        }
+    }
+
+    for (int layout = 0; layout < 2; ++layout) {
+        static_index_t *avl_index = create_static_index_from_avl(avl, layouts[layout]);
+        static_index_t *rbk_index = create_static_index_from_rbk(rbk, layouts[layout]);
+
+        if ((NULL == avl_index) || (NULL == rbk_index)) {
+            exit(EXIT_FAILURE);
+        }
+
+        check_index(avl_index, number_of_values);
+        check_index(rbk_index, number_of_values);
+
+        printf("Checked the %s indexes of trees of %lu values\n", layout_names[layout], number_of_values);
+
+        free_static_index(avl_index);
+        free_static_index(rbk_index);
+    }
+
+    free_avl(avl);
+    free_rbk(rbk);
+
+    printf("\n%d checks failed\n", failed_checks);
+
+    /* Close output file */
+    fclose(fout);
+
+    if (0 != failed_checks) {
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
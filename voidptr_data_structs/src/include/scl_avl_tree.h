@@ -31,6 +31,14 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_pool.h"
+
+/*
+ * Define SCL_TREE_ORDER_STATISTICS when building the library and every
+ * program using it to keep in every node the weight used by the order
+ * statistics (avl_set_order_statistics), otherwise the nodes are 8 bytes
+ * smaller and order statistics cannot be enabled.
+ */
 
 /**
  * @brief Adelson-Velsky-Landis Tree Node object definition
@@ -43,6 +51,9 @@ typedef struct avl_tree_node_s {
     struct avl_tree_node_s *right;                              /* Pointer to right child node */
     uint32_t count;                                             /* Number of nodes with the same data value */
     uint32_t height;                                            /* Height of a node */
+#if defined(SCL_TREE_ORDER_STATISTICS)
+    size_t weight;                                              /* Sum of the counts from the subtree of the node (kept just with order statistics) */
+#endif
 } avl_tree_node_t;
 
 /**
@@ -56,13 +67,29 @@ typedef struct avl_tree_s {
     free_func frd;                                              /* Function to free content of data */
     size_t data_size;                                           /* Length in bytes of the data data type */
     size_t size;                                                /* Size of the avl tree */
+    pool_t *pool;                                               /* Pool of nodes and data (`NULL` if every node is allocated alone) */
+    uint8_t order_statistics;                                   /* 1 if the weights of the nodes are kept up to date */
 } avl_tree_t;
 
+/**
+ * @brief Adelson-Velsky-Landis Tree cursor object definition, it holds the position of
+ * one node inside the tree and needs no memory allocation
+ * 
+ */
+typedef struct avl_cursor_s {
+    const avl_tree_t *tree;                                     /* Tree walked by the cursor */
+    avl_tree_node_t *node;                                      /* Current node (`nil` if the cursor is past the end) */
+} avl_cursor_t;
+
 avl_tree_t*             create_avl                          (compare_func cmp, free_func frd, size_t data_size);
+avl_tree_t*             create_avl_with_pool                (compare_func cmp, free_func frd, size_t data_size, size_t nodes_per_chunk);
+avl_tree_t*             create_avl_from_sorted              (compare_func cmp, free_func frd, size_t data_size, const void * const data, size_t number_of_data, size_t nodes_per_chunk);
 scl_error_t             free_avl                            (avl_tree_t * const __restrict__ tree);
+scl_error_t             avl_set_order_statistics            (avl_tree_t * const __restrict__ tree, uint8_t order_statistics);
 
 scl_error_t             avl_insert                          (avl_tree_t * const __restrict__ tree, const void * __restrict__ data);
 const void*             avl_find_data                       (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             avl_find_batch                      (const avl_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, const void ** const found_data);
 int32_t                 avl_data_level                      (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 uint8_t                 is_avl_empty                        (const avl_tree_t * const __restrict__ tree);
@@ -72,12 +99,26 @@ size_t                  get_avl_size                        (const avl_tree_t *
 const void*             avl_max_data                        (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 const void*             avl_min_data                        (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 
+const void*             avl_select_data                     (const avl_tree_t * const __restrict__ tree, size_t index);
+size_t                  avl_rank                            (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+
 scl_error_t             avl_delete                          (avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 const void*             avl_predecessor_data                (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             avl_successor_data                  (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             avl_lowest_common_ancestor_data     (const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data1, const void * const __restrict__ data2);
 
+scl_error_t             avl_range_traverse                  (const avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+size_t                  avl_range_count                     (const avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi);
+scl_error_t             avl_range_delete                    (avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi);
+
+scl_error_t             avl_cursor_first                    (const avl_tree_t * const __restrict__ tree, avl_cursor_t * const __restrict__ cursor);
+scl_error_t             avl_cursor_last                     (const avl_tree_t * const __restrict__ tree, avl_cursor_t * const __restrict__ cursor);
+scl_error_t             avl_cursor_seek                     (const avl_tree_t * const __restrict__ tree, avl_cursor_t * const __restrict__ cursor, const void * const __restrict__ data);
+const void*             avl_cursor_data                     (const avl_cursor_t * const __restrict__ cursor);
+const void*             avl_cursor_next                     (avl_cursor_t * const __restrict__ cursor);
+const void*             avl_cursor_prev                     (avl_cursor_t * const __restrict__ cursor);
+
 scl_error_t             avl_traverse_inorder                (const avl_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             avl_traverse_preorder               (const avl_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             avl_traverse_postorder              (const avl_tree_t * const __restrict__ tree, action_func action);
@@ -31,6 +31,7 @@
 #include <stdint.h>
 #include <errno.h>
 #include "scl_config.h"
+#include "scl_pool.h"
 
 /**
  * @brief Binary Search Tree Node object definition
@@ -55,9 +56,22 @@ typedef struct bst_tree_s {
     free_func frd;                                          /* Function to free content of data */
     size_t data_size;                                       /* Length in bytes of the data data type */
     size_t size;                                            /* Size of the binary search tree */
+    pool_t *pool;                                           /* Pool of nodes and data (`NULL` if every node is allocated alone) */
 } bst_tree_t;
 
+/**
+ * @brief Binary Search Tree cursor object definition, it holds the position of
+ * one node inside the tree and needs no memory allocation
+ * 
+ */
+typedef struct bst_cursor_s {
+    const bst_tree_t *tree;                                 /* Tree walked by the cursor */
+    bst_tree_node_t *node;                                  /* Current node (`nil` if the cursor is past the end) */
+} bst_cursor_t;
+
 bst_tree_t*             create_bst                          (compare_func cmp, free_func frd, size_t data_size);
+bst_tree_t*             create_bst_with_pool                (compare_func cmp, free_func frd, size_t data_size, size_t nodes_per_chunk);
+bst_tree_t*             create_bst_from_sorted              (compare_func cmp, free_func frd, size_t data_size, const void * const data, size_t number_of_data, size_t nodes_per_chunk);
 scl_error_t             free_bst                            (bst_tree_t * const __restrict__ tree);
 
 scl_error_t             bst_insert                          (bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
@@ -77,6 +91,17 @@ const void*             bst_predecessor_data                (const bst_tree_t *
 const void*             bst_successor_data                  (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             bst_lowest_common_ancestor_data     (const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data1, const void * const __restrict__ data2);
 
+scl_error_t             bst_range_traverse                  (const bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+size_t                  bst_range_count                     (const bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi);
+scl_error_t             bst_range_delete                    (bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi);
+
+scl_error_t             bst_cursor_first                    (const bst_tree_t * const __restrict__ tree, bst_cursor_t * const __restrict__ cursor);
+scl_error_t             bst_cursor_last                     (const bst_tree_t * const __restrict__ tree, bst_cursor_t * const __restrict__ cursor);
+scl_error_t             bst_cursor_seek                     (const bst_tree_t * const __restrict__ tree, bst_cursor_t * const __restrict__ cursor, const void * const __restrict__ data);
+const void*             bst_cursor_data                     (const bst_cursor_t * const __restrict__ cursor);
+const void*             bst_cursor_next                     (bst_cursor_t * const __restrict__ cursor);
+const void*             bst_cursor_prev                     (bst_cursor_t * const __restrict__ cursor);
+
 scl_error_t             bst_traverse_inorder                (const bst_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             bst_traverse_preorder               (const bst_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             bst_traverse_postorder              (const bst_tree_t * const __restrict__ tree, action_func action);
@@ -0,0 +1,84 @@
+/**
+ * @file scl_btree.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BTREE_UTILS_H_
+#define BTREE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/**
+ * @brief B+ Tree Node object definition. The data is kept inline, after
+ * it an inner node keeps its children and a leaf keeps the counts of its data
+ * 
+ */
+typedef struct btree_node_s {
+    struct btree_node_s *prev;                                  /* Pointer to previous leaf (leaves only) */
+    struct btree_node_s *next;                                  /* Pointer to next leaf (leaves only) */
+    uint32_t size;                                              /* Number of data of the node */
+    uint32_t is_leaf;                                           /* 1 if node is a leaf, 0 otherwise */
+    _Alignas(16) uint8_t data[];                                /* Sorted data, followed by children or counts */
+} btree_node_t;
+
+/**
+ * @brief B+ Tree object definition
+ * 
+ */
+typedef struct btree_s {
+    btree_node_t *root;                                         /* Pointer to tree root */
+    btree_node_t *first_leaf;                                   /* Pointer to leaf with the minimum data */
+    btree_node_t *last_leaf;                                    /* Pointer to leaf with the maximum data */
+    compare_func cmp;                                           /* Function to compare two elements */
+    free_func frd;                                              /* Function to free content of data */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t size;                                                /* Size of the b+ tree */
+    size_t node_capacity;                                       /* Maximum number of data of one node */
+    size_t links_offset;                                        /* Offset of children or counts after the data of a node */
+    size_t height;                                              /* Number of levels of the b+ tree */
+    uint8_t *scratch;                                           /* Buffer to split the inner nodes */
+} btree_t;
+
+btree_t*                create_btree                        (compare_func cmp, free_func frd, size_t data_size);
+btree_t*                create_btree_with_capacity          (compare_func cmp, free_func frd, size_t data_size, size_t node_capacity);
+scl_error_t             free_btree                          (btree_t * const __restrict__ tree);
+
+scl_error_t             btree_insert                        (btree_t * const __restrict__ tree, const void * const __restrict__ data);
+const void*             btree_find_data                     (const btree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             btree_delete                        (btree_t * const __restrict__ tree, const void * const __restrict__ data);
+
+uint8_t                 is_btree_empty                      (const btree_t * const __restrict__ tree);
+size_t                  get_btree_size                      (const btree_t * const __restrict__ tree);
+size_t                  get_btree_height                    (const btree_t * const __restrict__ tree);
+
+const void*             btree_min_data                      (const btree_t * const __restrict__ tree);
+const void*             btree_max_data                      (const btree_t * const __restrict__ tree);
+
+scl_error_t             btree_traverse_inorder              (const btree_t * const __restrict__ tree, action_func action);
+scl_error_t             btree_range_traverse                (const btree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+
+#endif /* BTREE_UTILS_H_ */
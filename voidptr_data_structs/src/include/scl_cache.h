@@ -0,0 +1,116 @@
+/**
+ * @file scl_cache.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef CACHE_UTILS_H_
+#define CACHE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/**
+ * @brief Eviction policy of one cache object, selected
+ * when the cache is created
+ *
+ */
+typedef enum cache_policy_s {
+    CACHE_POLICY_LRU,                                           /* Evict the least recently used pair */
+    CACHE_POLICY_CLOCK                                          /* Evict the first pair not used since the clock hand passed it */
+} cache_policy_t;
+
+/**
+ * @brief Metadata of one cache entry, the links of the recency
+ * ring and of the bucket are indices into the entries array
+ *
+ */
+typedef struct cache_entry_s {
+    size_t hash;                                                /* Mixed hash value of the key */
+    size_t bucket_next;                                         /* Index of the next entry of the same bucket (or of the next free entry) */
+    size_t prev;                                                /* Index of the previous entry of the recency ring */
+    size_t next;                                                /* Index of the next entry of the recency ring */
+    size_t cost;                                                /* Number of bytes charged for the pair */
+    uint8_t referenced;                                         /* Entry was used since the clock hand passed it */
+} cache_entry_t;
+
+/**
+ * @brief Hit, miss and eviction counters of one cache object
+ *
+ */
+typedef struct cache_stats_s {
+    size_t hits;                                                /* Number of cache_get calls that found their key */
+    size_t misses;                                              /* Number of cache_get calls that did not find their key */
+    size_t evictions;                                           /* Number of pairs evicted to make room for new pairs */
+} cache_stats_t;
+
+/**
+ * @brief Cache object definition. Pairs are stored inline in one array,
+ * every entry is linked into one bucket of the hash index and into the
+ * recency ring, so no memory is allocated for one access.
+ *
+ */
+typedef struct cache_s {
+    cache_entry_t *entries;                                     /* Array of entries metadata */
+    uint8_t *pairs;                                             /* Array of inline {key, data} pairs, one for every entry */
+    size_t *buckets;                                            /* Array of the first entries of every bucket */
+    hash_func hash;                                             /* Pointer to a hash function */
+    compare_func cmp_key;                                       /* Pointer to a compare function to compare key values */
+    free_func frd_key;                                          /* Pointer to a function to delete content of the key, called on eviction too */
+    free_func frd_dt;                                           /* Pointer to a function to delete content of the data, called on eviction too */
+    size_t key_size;                                            /* Length in bytes of the key data type */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t data_offset;                                         /* Offset in bytes of the data inside one inline pair */
+    size_t pair_size;                                           /* Length in bytes of one inline pair */
+    cache_policy_t policy;                                      /* Eviction policy of the cache */
+    size_t max_entries;                                         /* Maximum number of pairs (0 for no limit) */
+    size_t max_bytes;                                           /* Maximum number of charged bytes (0 for no limit) */
+    size_t capacity;                                            /* Number of allocated entries */
+    size_t number_of_buckets;                                   /* Number of buckets of the hash index, a power of two */
+    size_t size;                                                /* Number of pairs from cache object */
+    size_t bytes;                                               /* Number of bytes charged for all the pairs */
+    size_t head;                                                /* Most recently used entry (LRU) or clock hand (CLOCK) */
+    size_t free_entry;                                          /* Index of the first free entry */
+    cache_stats_t stats;                                        /* Hit, miss and eviction counters */
+} cache_t;
+
+cache_t*                create_cache                            (size_t max_entries, size_t max_bytes, cache_policy_t policy, hash_func hash, compare_func cmp_key, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+scl_error_t             free_cache                              (cache_t * const __restrict__ cache);
+
+scl_error_t             cache_put                               (cache_t * const __restrict__ cache, const void * const key, const void * const data);
+scl_error_t             cache_put_with_cost                     (cache_t * const __restrict__ cache, const void * const key, const void * const data, size_t cost);
+const void*             cache_get                               (cache_t * const __restrict__ cache, const void * const __restrict__ key);
+const void*             cache_peek                              (const cache_t * const __restrict__ cache, const void * const __restrict__ key);
+uint8_t                 cache_touch                             (cache_t * const __restrict__ cache, const void * const __restrict__ key);
+
+uint8_t                 is_cache_empty                          (const cache_t * const __restrict__ cache);
+size_t                  get_cache_size                          (const cache_t * const __restrict__ cache);
+size_t                  get_cache_bytes                         (const cache_t * const __restrict__ cache);
+scl_error_t             cache_get_stats                         (const cache_t * const __restrict__ cache, cache_stats_t * const __restrict__ stats);
+
+scl_error_t             cache_delete_key                        (cache_t * const __restrict__ cache, const void * const __restrict__ key);
+
+#endif /* CACHE_UTILS_H_ */
@@ -0,0 +1,124 @@
+/**
+ * @file scl_concurrent_hash_table.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONCURRENT_HASH_TABLE_UTILS_H_
+#define CONCURRENT_HASH_TABLE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "scl_config.h"
+
+#define CONCURRENT_HASH_TABLE_STRIPES 64
+#define CONCURRENT_HASH_TABLE_READER_SHARDS 64
+#define CONCURRENT_HASH_TABLE_CACHE_LINE 64
+
+/**
+ * @brief Concurrent Hash Table Node object definition, the key and
+ * the data are stored in the same allocation right after the node
+ *
+ */
+typedef struct concurrent_hash_table_node_s {
+    void *key;                                                  /* Pointer to the key of the hash, stored after the node */
+    void *data;                                                 /* Pointer to the data of the node, stored after the key */
+    size_t hash;                                                /* Mixed hash value of the key */
+    _Atomic(struct concurrent_hash_table_node_s *) next;        /* Pointer to the next node from the same bucket */
+    struct concurrent_hash_table_node_s *retired_next;          /* Pointer to the next node waiting to be freed */
+} concurrent_hash_table_node_t;
+
+/**
+ * @brief Array of buckets of one concurrent hash table, replaced
+ * as a whole when the concurrent hash table is resized
+ *
+ */
+typedef struct concurrent_hash_table_buckets_s {
+    size_t capacity;                                            /* Number of buckets, a power of two */
+    struct concurrent_hash_table_buckets_s *retired_next;       /* Pointer to the next buckets array waiting to be freed */
+    _Atomic(concurrent_hash_table_node_t *) heads[];            /* Array of the first nodes of every bucket */
+} concurrent_hash_table_buckets_t;
+
+/**
+ * @brief Writers lock of one stripe of buckets, padded to one cache line
+ *
+ */
+typedef union concurrent_hash_table_lock_u {
+    pthread_mutex_t lock;                                       /* Mutex of the stripe */
+    uint8_t padding[CONCURRENT_HASH_TABLE_CACHE_LINE];          /* Keep every mutex on its own cache line */
+} concurrent_hash_table_lock_t;
+
+/**
+ * @brief Number of active readers of one shard, padded to one cache line
+ *
+ */
+typedef union concurrent_hash_table_readers_u {
+    atomic_size_t count;                                        /* Number of readers inside a read section */
+    uint8_t padding[CONCURRENT_HASH_TABLE_CACHE_LINE];          /* Keep every counter on its own cache line */
+} concurrent_hash_table_readers_t;
+
+/**
+ * @brief Concurrent Hash Table object definition
+ *
+ */
+typedef struct concurrent_hash_table_s {
+    _Atomic(concurrent_hash_table_buckets_t *) table;           /* Pointer to the current buckets array */
+    hash_func hash;                                             /* Pointer to a hash function */
+    compare_func cmp_key;                                       /* Pointer to a compare function to compare key values */
+    compare_func cmp_dt;                                        /* Pointer to a compare function to compare data values */
+    free_func frd_key;                                          /* Pointer to a function to delete content of the key */
+    free_func frd_dt;                                           /* Pointer to a function to delete content of the data */
+    size_t key_size;                                            /* Length in bytes of the key data type */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t key_offset;                                          /* Offset in bytes of the key from the beginning of a node */
+    size_t data_offset;                                         /* Offset in bytes of the data from the beginning of a node */
+    size_t node_size;                                           /* Length in bytes of one node with its key and data */
+    atomic_size_t size;                                         /* Number of total nodes from concurrent hash table object */
+    atomic_size_t epoch;                                        /* Read epoch, readers register on its parity */
+    concurrent_hash_table_lock_t stripes[CONCURRENT_HASH_TABLE_STRIPES];                          /* Writers locks, bucket i uses stripe i % STRIPES */
+    concurrent_hash_table_readers_t readers[2][CONCURRENT_HASH_TABLE_READER_SHARDS];              /* Active readers for every epoch parity */
+    pthread_mutex_t reclaim_lock;                               /* Lock serializing the waits for the readers */
+    pthread_mutex_t retire_lock;                                /* Lock of the lists of retired memory */
+    concurrent_hash_table_node_t *retired_nodes;                /* List of deleted nodes waiting for the readers */
+    size_t number_of_retired_nodes;                             /* Number of nodes from the retired nodes list */
+    concurrent_hash_table_buckets_t *retired_buckets;           /* List of replaced buckets arrays waiting for the readers */
+} concurrent_hash_table_t;
+
+concurrent_hash_table_t*    create_concurrent_hash_table                (size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+scl_error_t                 free_concurrent_hash_table                  (concurrent_hash_table_t * const __restrict__ cht);
+scl_error_t                 concurrent_hash_table_reserve               (concurrent_hash_table_t * const __restrict__ cht, size_t number_of_pairs);
+
+scl_error_t                 concurrent_hash_table_insert                (concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data);
+scl_error_t                 concurrent_hash_table_find_data             (const concurrent_hash_table_t * const __restrict__ cht, const void * const key, void * const data);
+uint8_t                     concurrent_hash_table_contains_key          (const concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key);
+uint8_t                     concurrent_hash_table_contains_key_data     (const concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data);
+
+size_t                      get_concurrent_hash_table_size              (const concurrent_hash_table_t * const __restrict__ cht);
+size_t                      get_concurrent_hash_table_capacity          (const concurrent_hash_table_t * const __restrict__ cht);
+
+scl_error_t                 concurrent_hash_table_delete_key            (concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key);
+
+#endif /* CONCURRENT_HASH_TABLE_UTILS_H_ */
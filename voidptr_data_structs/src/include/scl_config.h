@@ -98,7 +98,26 @@ typedef enum scl_error_s {
     SCL_NULL_VERTICES_DISTANCES                 = -49,
     SCL_NULL_VERTICES_PARENTS                   = -50,
     SCL_NULL_PATH_MATRIX                        = -51,
-    SCL_GRAPH_INVALID_NEW_VERTICES              = -52
+    SCL_GRAPH_INVALID_NEW_VERTICES              = -52,
+
+    SCL_NULL_FLAT_MAP                           = -53,
+    SCL_NULL_FLAT_MAP_SLOTS                     = -54,
+
+    SCL_NULL_CONCURRENT_HASH_TABLE              = -55,
+
+    SCL_NULL_HASH_TABLE_ITER                    = -56,
+    SCL_NULL_HASH_TABLE_FILTER                  = -57,
+
+    SCL_NULL_CACHE                              = -58,
+
+    SCL_NULL_HASH_TABLE_SNAPSHOT                = -59,
+    SCL_SNAPSHOT_WRITE_FAILED                   = -60,
+
+    SCL_NULL_POOL                               = -61,
+
+    SCL_NULL_BTREE                              = -62,
+
+    SCL_NULL_STATIC_INDEX                       = -63
 } scl_error_t;
 
 /**
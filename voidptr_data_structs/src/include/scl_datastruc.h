@@ -27,15 +27,21 @@
 
 #include "scl_avl_tree.h"
 #include "scl_bst_tree.h"
+#include "scl_btree.h"
+#include "scl_cache.h"
+#include "scl_concurrent_hash_table.h"
 #include "scl_dlist.h"
+#include "scl_flat_map.h"
 #include "scl_func_types.h"
 #include "scl_graph.h"
 #include "scl_hash_table.h"
 #include "scl_list.h"
+#include "scl_pool.h"
 #include "scl_priority_queue.h"
 #include "scl_queue.h"
 #include "scl_red_black_tree.h"
 #include "scl_sort_algo.h"
 #include "scl_stack.h"
+#include "scl_static_index.h"
 
 #endif /* DATA_STRUCTURES_H_ */
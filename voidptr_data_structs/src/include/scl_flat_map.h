@@ -0,0 +1,76 @@
+/**
+ * @file scl_flat_map.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FLAT_MAP_UTILS_H_
+#define FLAT_MAP_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/**
+ * @brief Flat Map object definition. Every slot has one control byte
+ * (empty, deleted or 7 bits of the key hash) and the control bytes are
+ * probed in groups of 16, so one lookup checks 16 slots at once.
+ *
+ */
+typedef struct flat_map_s {
+    int8_t *ctrl;                                               /* Array of control bytes, one for every slot */
+    uint8_t *entries;                                           /* Array of inline {key, data} pairs */
+    hash_func hash;                                             /* Pointer to a hash function */
+    compare_func cmp_key;                                       /* Pointer to a compare function to compare key values */
+    compare_func cmp_dt;                                        /* Pointer to a compare function to compare data values */
+    free_func frd_key;                                          /* Pointer to a function to delete content of the key */
+    free_func frd_dt;                                           /* Pointer to a function to delete content of the data */
+    size_t key_size;                                            /* Length in bytes of the key data type */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t data_offset;                                         /* Offset in bytes of the data inside one inline pair */
+    size_t entry_size;                                          /* Length in bytes of one inline pair */
+    size_t capacity;                                            /* Number of slots, a power of two multiple of the group width */
+    size_t size;                                                /* Number of pairs from flat map object */
+    size_t growth_left;                                         /* Number of pairs that can be inserted before rehashing */
+} flat_map_t;
+
+flat_map_t*             create_flat_map                         (size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+scl_error_t             free_flat_map                           (flat_map_t * const __restrict__ fm);
+scl_error_t             flat_map_reserve                        (flat_map_t * const __restrict__ fm, size_t number_of_pairs);
+
+scl_error_t             flat_map_insert                         (flat_map_t * const __restrict__ fm, const void * const key, const void * const data);
+const void*             flat_map_find_key_data                  (const flat_map_t * const __restrict__ fm, const void * const key, const void * const data);
+const void*             flat_map_find_data                      (const flat_map_t * const __restrict__ fm, const void * const __restrict__ key);
+uint8_t                 flat_map_contains_key_data              (const flat_map_t * const __restrict__ fm, const void * const key, const void * const data);
+
+uint8_t                 is_flat_map_empty                       (const flat_map_t * const __restrict__ fm);
+size_t                  get_flat_map_size                       (const flat_map_t * const __restrict__ fm);
+size_t                  get_flat_map_capacity                   (const flat_map_t * const __restrict__ fm);
+
+scl_error_t             flat_map_delete_key_data                (flat_map_t * const __restrict__ fm, const void * const key, const void * const data);
+scl_error_t             flat_map_delete_key                     (flat_map_t * const __restrict__ fm, const void * const __restrict__ key);
+
+scl_error_t             flat_map_traverse                       (const flat_map_t * const __restrict__ fm, action_func action);
+
+#endif /* FLAT_MAP_UTILS_H_ */
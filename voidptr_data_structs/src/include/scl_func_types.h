@@ -68,4 +68,20 @@ int32_t         compare_string_size             (const void * const data1, const
 int32_t         compare_string_lexi             (const void * const data1, const void * const data2);
 int32_t         compare_string                  (const void * const data1, const void * const data2);
 
+size_t          hash_bytes                      (const void * const data, size_t data_size);
+size_t          hash_short_int                  (const void * const data);
+size_t          hash_ushort_int                 (const void * const data);
+size_t          hash_uint                       (const void * const data);
+size_t          hash_int                        (const void * const data);
+size_t          hash_long_int                   (const void * const data);
+size_t          hash_ulong_int                  (const void * const data);
+size_t          hash_llong_int                  (const void * const data);
+size_t          hash_ullong_int                 (const void * const data);
+size_t          hash_char                       (const void * const data);
+size_t          hash_uchar                      (const void * const data);
+size_t          hash_float                      (const void * const data);
+size_t          hash_double                     (const void * const data);
+size_t          hash_long_double                (const void * const data);
+size_t          hash_string                     (const void * const data);
+
 #endif /* _FUNCTION_TYPES_H_ */
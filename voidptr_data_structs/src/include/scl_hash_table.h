@@ -32,6 +32,8 @@
 #include <errno.h>
 #include "scl_config.h"
 
+#define HASH_TABLE_STATS_HISTOGRAM_SIZE 16
+
 /**
  * @brief Color of one hash table node
  * 
@@ -41,6 +43,26 @@ typedef enum hash_table_node_color_s {
     HASH_BLACK                                                  /* Black color of the hash table node */
 } hash_table_node_color_t;
 
+/**
+ * @brief Storage engine of one hash table object, selected
+ * when the hash table is created
+ * 
+ */
+typedef enum hash_table_engine_s {
+    HASH_ENGINE_RBK,                                            /* Every bucket is a red black tree of allocated nodes */
+    HASH_ENGINE_LINEAR,                                         /* Open addressing with linear probing, pairs stored inline */
+    HASH_ENGINE_ROBIN_HOOD                                      /* Open addressing with robin hood probing, pairs stored inline */
+} hash_table_engine_t;
+
+/**
+ * @brief Metadata of one open addressing slot
+ * 
+ */
+typedef struct hash_table_slot_s {
+    uint32_t dist;                                              /* Probe distance plus one of the stored pair, zero if slot is empty */
+    uint32_t tag;                                               /* Folded hash of the stored key, checked before comparing keys */
+} hash_table_slot_t;
+
 /**
  * @brief Hash Table Node object definition
  * 
@@ -53,8 +75,53 @@ typedef struct hash_table_node_s {
     struct hash_table_node_s *right;                            /* Pointer to the right child of the current node */
     uint32_t count;                                             /* Number of nodes with the same data and key value */
     hash_table_node_color_t color;                              /* Color of the current node */
+    _Alignas(16) uint8_t entry[];                               /* Inline {key, data} pair, key and data point inside it */
 } hash_table_node_t;
 
+/**
+ * @brief Membership filter of one hash table (a blocked bloom filter)
+ * 
+ */
+typedef struct hash_table_filter_s {
+    uint64_t *blocks;                                           /* Bits of the filter, blocks of one cache line */
+    uint64_t *next_blocks;                                      /* Bits rebuilt while the hash table is resized (or `NULL`) */
+    size_t number_of_blocks;                                    /* Number of blocks of the filter */
+    size_t next_number_of_blocks;                               /* Number of blocks of the rebuilt filter */
+    double bits_per_key;                                        /* Number of bits of memory for every key */
+    uint32_t number_of_hashes;                                  /* Number of bits set for every key */
+} hash_table_filter_t;
+
+/**
+ * @brief Statistics of the membership filter of one hash table
+ * 
+ */
+typedef struct hash_table_filter_stats_s {
+    size_t memory_size;                                         /* Length in bytes of the bits of the filter */
+    uint32_t number_of_hashes;                                  /* Number of bits set for every key */
+    double fill_ratio;                                          /* Fraction of the bits of the filter that are set */
+    double false_positive_rate;                                 /* Estimated fraction of the missing keys passed by the filter */
+} hash_table_filter_stats_t;
+
+/**
+ * @brief Occupancy and probe length statistics of one hash table. For open
+ * addressing engines a bucket is the set of pairs having the same home slot
+ * and the depth of one pair is its probe distance
+ * 
+ */
+typedef struct hash_table_stats_s {
+    size_t size;                                                /* Number of pairs of the hash table */
+    size_t capacity;                                            /* Number of buckets (or slots) of the hash table */
+    double load_factor;                                         /* Number of pairs for every bucket */
+    size_t bucket_histogram[HASH_TABLE_STATS_HISTOGRAM_SIZE];   /* Number of buckets holding `i` pairs, the last entry counts all greater buckets */
+    size_t max_bucket_size;                                     /* Number of pairs of the greatest bucket */
+    size_t max_bucket_depth;                                    /* Greatest depth of one pair */
+    double average_bucket_depth;                                /* Average height of the buckets holding at least one pair */
+    double average_hit_probes;                                  /* Average number of nodes (or slots) visited to find a stored key */
+    double average_miss_probes;                                 /* Average number of nodes (or slots) visited to miss a key with a uniform hash */
+    size_t number_of_rehashes;                                  /* Number of times the buckets were resized */
+    size_t memory_size;                                         /* Length in bytes of the memory allocated by the hash table */
+} hash_table_stats_t;
+
 /**
  * @brief Hash Table object definition
  * 
@@ -71,26 +138,110 @@ typedef struct hash_table_s {
     size_t data_size;                                           /* Length in bytes of the data data type */
     size_t capacity;                                            /* Number of red black trees within the hash table */
     size_t size;                                                /* Number of total nodes from hash table object*/
+    hash_table_engine_t engine;                                 /* Storage engine used by the hash table */
+    hash_table_slot_t *slots;                                   /* Array of open addressing slots metadata (`NULL` for HASH_ENGINE_RBK) */
+    uint8_t *entries;                                           /* Array of inline {key, data} pairs of the open addressing slots */
+    uint8_t *swap_entry;                                        /* One inline pair used to carry displaced pairs while probing */
+    size_t data_offset;                                         /* Offset in bytes of the data inside one inline pair */
+    size_t entry_size;                                          /* Length in bytes of one inline pair */
+    hash_table_node_t **old_buckets;                            /* Array of buckets not moved yet by incremental rehashing (or `NULL`) */
+    size_t old_capacity;                                        /* Number of red black trees within the old buckets array */
+    size_t rehash_index;                                        /* Index of the next old bucket to move */
+    size_t rehash_step;                                         /* Number of old buckets to move for every operation (0 to rehash at once) */
+    uint8_t pow2_capacity;                                      /* Capacity is a power of two and buckets are selected with a mask (0 for modulo) */
+    double shrink_load_factor;                                  /* Capacity is halved when a deletion leaves the load factor under it (0 to never shrink) */
+    hash_table_filter_t *filter;                                /* Membership filter checked before every lookup (or `NULL`) */
+    size_t number_of_rehashes;                                  /* Number of times the buckets were resized */
 } hash_table_t;
 
+/**
+ * @brief On disk header of one hash table snapshot, every member
+ * has a fixed width and every location is an offset from the
+ * beginning of the file
+ * 
+ */
+typedef struct hash_table_snapshot_header_s {
+    uint8_t magic[8];                                           /* File signature "SCLHTSNP" */
+    uint32_t version;                                           /* Version of the snapshot format */
+    uint32_t byte_order;                                        /* Known value written in the byte order of the writer */
+    uint32_t hash_bits;                                         /* Number of bits of the hash values of the writer */
+    uint32_t reserved;                                          /* Unused, always zero */
+    uint64_t key_size;                                          /* Length in bytes of the key data type */
+    uint64_t data_size;                                         /* Length in bytes of the data data type */
+    uint64_t data_offset;                                       /* Offset in bytes of the data inside one inline pair */
+    uint64_t entry_size;                                        /* Length in bytes of one inline pair */
+    uint64_t capacity;                                          /* Number of slots, always a power of two */
+    uint64_t size;                                              /* Number of pairs */
+    uint64_t slots_offset;                                      /* Offset in bytes of the slots metadata array */
+    uint64_t entries_offset;                                    /* Offset in bytes of the inline pairs array */
+    uint64_t file_size;                                         /* Length in bytes of the whole file */
+} hash_table_snapshot_header_t;
+
+/**
+ * @brief Read only hash table mapped from one snapshot file, the
+ * lookups work directly on the mapped pages
+ * 
+ */
+typedef struct hash_table_snapshot_s {
+    hash_table_t table;                                         /* Robin hood hash table viewing the mapped arrays, never modified */
+    void *map;                                                  /* Beginning of the mapped file */
+    size_t map_size;                                            /* Length in bytes of the mapped file */
+} hash_table_snapshot_t;
+
+/**
+ * @brief Hash Table iterator object definition, it holds the position of
+ * one pair inside the hash table and needs no memory allocation
+ * 
+ */
+typedef struct hash_table_iter_s {
+    const void *key;                                            /* Pointer to the key of the current pair */
+    void *data;                                                 /* Pointer to the data of the current pair */
+    hash_table_node_t *node;                                    /* Current node for red black buckets (`NULL` before the first node of a bucket) */
+    size_t index;                                               /* Index of the current bucket or open addressing slot */
+    size_t steps;                                               /* Number of open addressing slots visited */
+    uint8_t erased;                                             /* Current pair was erased, the next position is already computed */
+} hash_table_iter_t;
+
 hash_table_t*           create_hash_table                       (size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size);
+hash_table_t*           create_hash_table_with_engine           (size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size, hash_table_engine_t engine);
 scl_error_t             free_hash_table                         (hash_table_t * const __restrict__ ht);
+scl_error_t             hash_table_set_rehash_step              (hash_table_t * const __restrict__ ht, size_t rehash_step);
+scl_error_t             hash_table_reserve                      (hash_table_t * const __restrict__ ht, size_t number_of_pairs);
+scl_error_t             hash_table_set_pow2_capacity            (hash_table_t * const __restrict__ ht, uint8_t pow2_capacity);
+scl_error_t             hash_table_set_shrink_load_factor       (hash_table_t * const __restrict__ ht, double shrink_load_factor);
+scl_error_t             hash_table_shrink_to_fit                (hash_table_t * const __restrict__ ht);
+scl_error_t             hash_table_set_filter                   (hash_table_t * const __restrict__ ht, double false_positive_rate);
+scl_error_t             hash_table_get_filter_stats             (const hash_table_t * const __restrict__ ht, hash_table_filter_stats_t * const __restrict__ stats);
 
 scl_error_t             hash_table_insert                       (hash_table_t * const __restrict__ ht, const void *key, const void *data);
 const void*             hash_table_find_key_data                (const hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
 const void*             hash_table_find_data                    (const hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 uint8_t                 hash_table_contains_key_data            (const hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
+scl_error_t             hash_table_find_batch                   (const hash_table_t * const __restrict__ ht, const void * const keys, size_t number_of_keys, const void ** const data);
+scl_error_t             hash_table_insert_batch                 (hash_table_t * const __restrict__ ht, const void * const keys, const void * const data, size_t number_of_pairs);
 
 uint8_t                 is_hash_table_empty                     (const hash_table_t * const __restrict__ ht);
 uint8_t                 is_hash_table_bucket_key_empty          (const hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 size_t                  get_hash_table_size                     (const hash_table_t * const __restrict__ ht);
 size_t                  get_hash_table_capacity                 (const hash_table_t * const __restrict__ ht);
 size_t                  hash_table_count_bucket_elements        (const hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
+scl_error_t             hash_table_get_stats                    (const hash_table_t * const __restrict__ ht, hash_table_stats_t * const __restrict__ stats);
 
 scl_error_t             hash_table_delete_key_data              (hash_table_t * const __restrict__ ht, const void * const key, const void * const data);
 scl_error_t             hash_table_delete_hash                  (hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 scl_error_t             hash_table_delete_key                   (hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
 
+scl_error_t             hash_table_iter_begin                   (hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter);
+uint8_t                 hash_table_iter_next                    (const hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter);
+scl_error_t             hash_table_iter_erase                   (hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter);
+
+scl_error_t             hash_table_save_snapshot                (hash_table_t * const __restrict__ ht, const char * const __restrict__ path);
+hash_table_snapshot_t*  open_hash_table_snapshot                (const char * const __restrict__ path, hash_func hash, compare_func cmp_key, size_t key_size, size_t data_size);
+scl_error_t             close_hash_table_snapshot               (hash_table_snapshot_t * const __restrict__ snapshot);
+const void*             hash_table_snapshot_find_data           (const hash_table_snapshot_t * const __restrict__ snapshot, const void * const __restrict__ key);
+scl_error_t             hash_table_snapshot_find_batch          (const hash_table_snapshot_t * const __restrict__ snapshot, const void * const keys, size_t number_of_keys, const void ** const data);
+size_t                  get_hash_table_snapshot_size            (const hash_table_snapshot_t * const __restrict__ snapshot);
+
 scl_error_t             hash_table_bucket_traverse_inorder      (const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action);
 scl_error_t             hash_table_traverse_inorder             (const hash_table_t * const __restrict__ ht, action_func action);
 scl_error_t             hash_table_bucket_traverse_preorder     (const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action);
@@ -0,0 +1,71 @@
+/**
+ * @file scl_pool.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POOL_UTILS_H_
+#define POOL_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+
+/**
+ * @brief One chunk of memory of a pool, the objects
+ * are carved from it one after another
+ * 
+ */
+typedef struct pool_chunk_s {
+    struct pool_chunk_s *next;                                  /* Pointer to the previously allocated chunk */
+    _Alignas(16) uint8_t objects[];                             /* Memory of the objects of the chunk */
+} pool_chunk_t;
+
+/**
+ * @brief Pool (slab) allocator object definition, it hands out objects
+ * of one fixed size and recycles the released objects through a free list
+ * 
+ */
+typedef struct pool_s {
+    pool_chunk_t *chunks;                                       /* List of allocated chunks, the newest one first */
+    void *free_object;                                          /* List of released objects, linked through their first bytes */
+    size_t object_size;                                         /* Length in bytes of one object */
+    size_t objects_per_chunk;                                   /* Number of objects carved from one chunk */
+    size_t chunk_capacity;                                      /* Number of objects of the newest chunk */
+    size_t carved_objects;                                      /* Number of objects carved from the newest chunk */
+    size_t number_of_chunks;                                    /* Number of allocated chunks */
+    size_t used_objects;                                        /* Number of objects handed out and not released */
+} pool_t;
+
+pool_t*                 create_pool                             (size_t object_size, size_t objects_per_chunk);
+scl_error_t             free_pool                               (pool_t * const __restrict__ pool);
+
+void*                   pool_alloc                              (pool_t * const __restrict__ pool);
+scl_error_t             pool_free                               (pool_t * const __restrict__ pool, void * const __restrict__ object);
+scl_error_t             pool_reserve                            (pool_t * const __restrict__ pool, size_t number_of_objects);
+
+size_t                  get_pool_used_objects                   (const pool_t * const __restrict__ pool);
+size_t                  get_pool_number_of_chunks               (const pool_t * const __restrict__ pool);
+
+#endif /* POOL_UTILS_H_ */
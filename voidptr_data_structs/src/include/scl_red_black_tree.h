@@ -31,6 +31,7 @@
 #include <errno.h>
 #include <stdint.h>
 #include "scl_config.h"
+#include "scl_pool.h"
 
 /**
  * @brief Color of one red-black tree node
@@ -41,6 +42,36 @@ typedef enum rbk_tree_node_color_s {
     BLACK                                                       /* Black color of the node */
 } rbk_tree_node_color_t;
 
+/*
+ * Define SCL_RBK_PACKED_NODES when building the library and every program
+ * using it to pack the red-black tree nodes into 32 bytes instead of 48. The
+ * color is kept in the lowest bit of the parent link and the nodes keep no
+ * duplicates counter and no weight, so inserting data already in the tree
+ * changes nothing and order statistics cannot be enabled.
+ */
+/*
+ * Define SCL_TREE_ORDER_STATISTICS when building the library and every
+ * program using it to keep in every node the weight used by the order
+ * statistics (rbk_set_order_statistics), otherwise the nodes are 8 bytes
+ * smaller and order statistics cannot be enabled. Packed nodes never keep
+ * a weight.
+ */
+
+#if defined(SCL_RBK_PACKED_NODES)
+
+/**
+ * @brief Red-Black Tree Node object definition (packed layout)
+ * 
+ */
+typedef struct rbk_tree_node_s {
+    void *data;                                                 /* Pointer to data */
+    uintptr_t parent_color;                                     /* Pointer to parent node, the lowest bit is set for black nodes */
+    struct rbk_tree_node_s *left;                               /* Pointer to left child node */
+    struct rbk_tree_node_s *right;                              /* Pointer to right child node */
+} rbk_tree_node_t;
+
+#else
+
 /**
  * @brief Red-Black Tree Node object definition
  * 
@@ -52,8 +83,13 @@ typedef struct rbk_tree_node_s {
     struct rbk_tree_node_s *right;                              /* Pointer to right child node */
     uint32_t count;                                             /* Number of nodes with the same data value */
     rbk_tree_node_color_t color;                                /* Color of a node */
+#if defined(SCL_TREE_ORDER_STATISTICS)
+    size_t weight;                                              /* Sum of the counts from the subtree of the node (kept just with order statistics) */
+#endif
 } rbk_tree_node_t;
 
+#endif /* SCL_RBK_PACKED_NODES */
+
 /**
  * @brief Red-Black Tree object definition
  * 
@@ -65,13 +101,29 @@ typedef struct rbk_tree_s {
     free_func frd;                                              /* Function to free content of data */
     size_t data_size;                                           /* Length in bytes of the data data type */
     size_t size;                                                /* Size of the red-black tree */
+    pool_t *pool;                                               /* Pool of nodes and data (`NULL` if every node is allocated alone) */
+    uint8_t order_statistics;                                   /* 1 if the weights of the nodes are kept up to date */
 } rbk_tree_t;
 
+/**
+ * @brief Red-Black Tree cursor object definition, it holds the position of
+ * one node inside the tree and needs no memory allocation
+ * 
+ */
+typedef struct rbk_cursor_s {
+    const rbk_tree_t *tree;                                     /* Tree walked by the cursor */
+    rbk_tree_node_t *node;                                      /* Current node (`nil` if the cursor is past the end) */
+} rbk_cursor_t;
+
 rbk_tree_t*             create_rbk                          (compare_func cmp, free_func frd, size_t data_size);
+rbk_tree_t*             create_rbk_with_pool                (compare_func cmp, free_func frd, size_t data_size, size_t nodes_per_chunk);
+rbk_tree_t*             create_rbk_from_sorted              (compare_func cmp, free_func frd, size_t data_size, const void * const data, size_t number_of_data, size_t nodes_per_chunk);
 scl_error_t             free_rbk                            (rbk_tree_t * const __restrict__ tree);
+scl_error_t             rbk_set_order_statistics            (rbk_tree_t * const __restrict__ tree, uint8_t order_statistics);
 
 scl_error_t             rbk_insert                          (rbk_tree_t * const __restrict__ tree, const void * __restrict__ data);
 const void*             rbk_find_data                       (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+scl_error_t             rbk_find_batch                      (const rbk_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, const void ** const found_data);
 int32_t                 rbk_data_level                      (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 uint8_t                 is_rbk_empty                        (const rbk_tree_t * const __restrict__ tree);
@@ -81,12 +133,26 @@ size_t                  get_rbk_size                        (const rbk_tree_t *
 const void*             rbk_max_data                        (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 const void*             rbk_min_data                        (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ subroot_data);
 
+const void*             rbk_select_data                     (const rbk_tree_t * const __restrict__ tree, size_t index);
+size_t                  rbk_rank                            (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
+
 scl_error_t             rbk_delete                          (rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 
 const void*             rbk_predecessor_data                (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             rbk_successor_data                  (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data);
 const void*             rbk_lowest_common_ancestor_data     (const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data1, const void * const __restrict__ data2);
 
+scl_error_t             rbk_range_traverse                  (const rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action);
+size_t                  rbk_range_count                     (const rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi);
+scl_error_t             rbk_range_delete                    (rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi);
+
+scl_error_t             rbk_cursor_first                    (const rbk_tree_t * const __restrict__ tree, rbk_cursor_t * const __restrict__ cursor);
+scl_error_t             rbk_cursor_last                     (const rbk_tree_t * const __restrict__ tree, rbk_cursor_t * const __restrict__ cursor);
+scl_error_t             rbk_cursor_seek                     (const rbk_tree_t * const __restrict__ tree, rbk_cursor_t * const __restrict__ cursor, const void * const __restrict__ data);
+const void*             rbk_cursor_data                     (const rbk_cursor_t * const __restrict__ cursor);
+const void*             rbk_cursor_next                     (rbk_cursor_t * const __restrict__ cursor);
+const void*             rbk_cursor_prev                     (rbk_cursor_t * const __restrict__ cursor);
+
 scl_error_t             rbk_traverse_inorder                (const rbk_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             rbk_traverse_preorder               (const rbk_tree_t * const __restrict__ tree, action_func action);
 scl_error_t             rbk_traverse_postorder              (const rbk_tree_t * const __restrict__ tree, action_func action);
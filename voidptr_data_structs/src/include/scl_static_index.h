@@ -0,0 +1,73 @@
+/**
+ * @file scl_static_index.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATIC_INDEX_UTILS_H_
+#define STATIC_INDEX_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "scl_config.h"
+#include "scl_avl_tree.h"
+#include "scl_red_black_tree.h"
+
+/**
+ * @brief Order of the data inside a static index
+ * 
+ */
+typedef enum static_index_layout_s {
+    STATIC_INDEX_EYTZINGER,                                     /* Breadth first order of an implicit binary tree */
+    STATIC_INDEX_BLOCKED                                        /* Breadth first order of an implicit tree with one cache line per node */
+} static_index_layout_t;
+
+/**
+ * @brief Static Index object definition, a read only copy of sorted
+ * data kept in one array in a layout that is fast to search
+ * 
+ */
+typedef struct static_index_s {
+    uint8_t *data;                                              /* Array of data in index layout */
+    compare_func cmp;                                           /* Function to compare two elements */
+    size_t data_size;                                           /* Length in bytes of the data data type */
+    size_t size;                                                /* Number of data of the index */
+    static_index_layout_t layout;                               /* Order of the data inside the array */
+    size_t block_size;                                          /* Number of data of one block (blocked layout only) */
+    size_t number_of_blocks;                                    /* Number of blocks of the array (blocked layout only) */
+} static_index_t;
+
+static_index_t*         create_static_index                 (compare_func cmp, size_t data_size, const void * const data, size_t number_of_data, static_index_layout_t layout);
+static_index_t*         create_static_index_from_avl        (const avl_tree_t * const __restrict__ tree, static_index_layout_t layout);
+static_index_t*         create_static_index_from_rbk        (const rbk_tree_t * const __restrict__ tree, static_index_layout_t layout);
+scl_error_t             free_static_index                   (static_index_t * const __restrict__ index);
+
+const void*             static_index_find_data              (const static_index_t * const __restrict__ index, const void * const __restrict__ data);
+const void*             static_index_lower_bound            (const static_index_t * const __restrict__ index, const void * const __restrict__ data);
+const void*             static_index_upper_bound            (const static_index_t * const __restrict__ index, const void * const __restrict__ data);
+
+uint8_t                 is_static_index_empty               (const static_index_t * const __restrict__ index);
+size_t                  get_static_index_size               (const static_index_t * const __restrict__ index);
+
+#endif /* STATIC_INDEX_UTILS_H_ */
@@ -23,7 +23,19 @@
  */
 
 #include "./include/scl_avl_tree.h"
-#include "./include/scl_queue.h"
+#include "./include/scl_sort_algo.h"
+
+/* Offset of the data inside one pooled object, the data follows its node */
+#define AVL_POOL_DATA_OFFSET ((sizeof(avl_tree_node_t) + 15) & ~((size_t)15))
+
+/* Number of searches walked in lockstep by avl_find_batch */
+#define DEFAULT_AVL_BATCH_SIZE 16
+
+#if defined(__GNUC__)
+#define AVL_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+#define AVL_PREFETCH(addr) ((void)(addr))
+#endif
 
 /**
  * @brief Max function directive for countable numbers
@@ -32,6 +44,54 @@
  */
 #define _MAX(A, B) (((A) >= (B))?(A):(B))
 
+#if defined(SCL_TREE_ORDER_STATISTICS)
+
+/**
+ * @brief Function to get the weight of an avl tree node.
+ * 
+ * @param node an avl tree node object
+ * @return size_t weight of the node
+ */
+static size_t avl_get_node_weight(const avl_tree_node_t * const __restrict__ node) {
+    return node->weight;
+}
+
+/**
+ * @brief Function to set the weight of an avl tree node.
+ * 
+ * @param node an avl tree node object
+ * @param weight new weight of the node
+ */
+static void avl_set_node_weight(avl_tree_node_t * const __restrict__ node, size_t weight) {
+    node->weight = weight;
+}
+
+#else
+
+/**
+ * @brief Nodes keep no weight without SCL_TREE_ORDER_STATISTICS,
+ * order statistics cannot be enabled.
+ * 
+ * @param node an avl tree node object
+ * @return size_t always 0
+ */
+static size_t avl_get_node_weight(const avl_tree_node_t * const __restrict__ node) {
+    return 0;
+}
+
+/**
+ * @brief Nodes keep no weight without SCL_TREE_ORDER_STATISTICS,
+ * order statistics cannot be enabled.
+ * 
+ * @param node an avl tree node object
+ * @param weight ignored weight
+ */
+static void avl_set_node_weight(avl_tree_node_t * const __restrict__ node, size_t weight) {
+    /* Nothing to store */
+}
+
+#endif /* SCL_TREE_ORDER_STATISTICS */
+
 /**
  * @brief Create an avl object. Allocation may fail if there
  * is not enough memory on heap or cmp function is not valid
@@ -40,9 +100,10 @@
  * @param cmp pointer to a function to compare two sets of data
  * @param frd pointer to a function to free content of one data
  * @param data_size length in bytes of the data data type
+ * @param nodes_per_chunk number of nodes allocated at once by the pool of the tree (0 for no pool)
  * @return avl_tree_t* a new allocated avl tree object or NULL (if function failed)
  */
-avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
+avl_tree_t* create_avl_with_pool(compare_func cmp, free_func frd, size_t data_size, size_t nodes_per_chunk) {
     /* Check if compareData function is valid */
     if (NULL == cmp) {
         errno = EINVAL;
@@ -75,6 +136,7 @@ avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
             new_tree->nil->data = NULL;
             new_tree->nil->count = 1;
             new_tree->nil->height = 0;
+            avl_set_node_weight(new_tree->nil, 0);
             new_tree->nil->left = new_tree->nil->right = new_tree->nil;
             new_tree->nil->parent = new_tree->nil;
         } else {
@@ -86,6 +148,23 @@ avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
         new_tree->root = new_tree->nil;
         new_tree->data_size = data_size;
         new_tree->size = 0;
+
+        /* Weights of the nodes are kept just if order statistics are requested */
+        new_tree->order_statistics = 0;
+
+        /* Nodes and data are carved from chunks just if a pool is requested */
+        new_tree->pool = NULL;
+
+        if (0 != nodes_per_chunk) {
+            new_tree->pool = create_pool(AVL_POOL_DATA_OFFSET + data_size, nodes_per_chunk);
+
+            /* Pool was not allocated wipe tree's memory */
+            if (NULL == new_tree->pool) {
+                free(new_tree->nil);
+                free(new_tree);
+                new_tree = NULL;
+            }
+        }
     } else {
         errno = ENOMEM;
         perror("Not enough memory for avl allocation");
@@ -95,6 +174,19 @@ avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
     return new_tree;
 }
 
+/**
+ * @brief Create an avl tree object allocating every node and its data
+ * alone, as create_avl_with_pool without a pool.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @return avl_tree_t* a new allocated avl tree or `NULL` (if function failed)
+ */
+avl_tree_t* create_avl(compare_func cmp, free_func frd, size_t data_size) {
+    return create_avl_with_pool(cmp, frd, data_size, 0);
+}
+
 /**
  * @brief Create an avl node object. Allocation of a new node
  * may fail if address of data is not valid or if not enough memory
@@ -111,8 +203,8 @@ static avl_tree_node_t* create_avl_node(const avl_tree_t * const __restrict__ tr
         return tree->nil;
     }
 
-    /* Allocate a new node on the heap */
-    avl_tree_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new node on the heap (or take one from the pool) */
+    avl_tree_node_t *new_node = (NULL != tree->pool) ? pool_alloc(tree->pool) : malloc(sizeof(*new_node));
 
     /* Check if allocation went successfully */
     if (NULL != new_node) {
@@ -122,9 +214,10 @@ static avl_tree_node_t* create_avl_node(const avl_tree_t * const __restrict__ tr
         new_node->parent = tree->nil;
         new_node->count = 1;
         new_node->height = 1;
+        avl_set_node_weight(new_node, 1);
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(tree->data_size);
+        /* Allocate heap memory for data, a pooled node keeps its data just after it */
+        new_node->data = (NULL != tree->pool) ? (uint8_t *)new_node + AVL_POOL_DATA_OFFSET : malloc(tree->data_size);
 
         /* Check if memory allocation went right */
         if (NULL != new_node->data) {
@@ -153,41 +246,51 @@ static avl_tree_node_t* create_avl_node(const avl_tree_t * const __restrict__ tr
 
 /**
  * @brief A helper function for free_avl function.
- * Function will iterate through all nodes recursively
- * by Left-Right-Root principle.
+ * Function will iterate through all nodes by Left-Right-Root
+ * principle without recursion, a leaf is freed and unlinked
+ * from its parent, so the parent may become a leaf.
  * 
  * @param tree an allocated avl tree object
  * @param root pointer to pointer of current avl node object
  */
 static void free_avl_helper(const avl_tree_t * const __restrict__ tree, avl_tree_node_t ** const __restrict__ root) {
-    /* Check if current node is valid */
-    if (tree->nil == *root) {
-        return;
-    }
-
-    /* Recursive calls */
-    free_avl_helper(tree, &(*root)->left);
-    free_avl_helper(tree, &(*root)->right);
+    avl_tree_node_t *iterator = *root;
 
-    /* Free content of the data pointer */
-    if ((NULL != tree->frd) && (NULL != (*root)->data)) {
-        tree->frd((*root)->data);
-    }
+    while (tree->nil != iterator) {
 
-    /* Free data pointer */
-    if (NULL != (*root)->data) {
-        free((*root)->data);
-    }
+        /* Go down until a leaf */
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+            avl_tree_node_t * const parent_iterator = (*root != iterator) ? iterator->parent : tree->nil;
+
+            /* Unlink the leaf from its parent */
+            if (tree->nil != parent_iterator) {
+                if (parent_iterator->left == iterator) {
+                    parent_iterator->left = tree->nil;
+                } else {
+                    parent_iterator->right = tree->nil;
+                }
+            }
 
-    /* Set data pointer as NULL */
-    (*root)->data = NULL;
+            /* Free content of the data pointer */
+            if ((NULL != tree->frd) && (NULL != iterator->data)) {
+                tree->frd(iterator->data);
+            }
 
-    /* Free avl node pointer */
-    if (tree->nil != *root) {
-        free(*root);
+            /* Free data pointer and node, pooled nodes are released with the pool */
+            if (NULL == tree->pool) {
+                free(iterator->data);
+                free(iterator);
+            }
 
-        *root = tree->nil;
+            iterator = parent_iterator;
+        }
     }
+
+    *root = tree->nil;
 }
 
 /**
@@ -205,8 +308,16 @@ scl_error_t free_avl(avl_tree_t * const __restrict__ tree) {
     /* Check if tree needs to be freed */
     if (NULL != tree) {
 
-        /* Free every node from avl -> tree */
-        free_avl_helper(tree, &tree->root);
+        /* Free every node, pooled nodes are visited just to free the content of their data */
+        if ((NULL == tree->pool) || (NULL != tree->frd)) {
+            free_avl_helper(tree, &tree->root);
+        }
+
+        /* Release all pooled nodes at once */
+        if (NULL != tree->pool) {
+            free_pool(tree->pool);
+            tree->pool = NULL;
+        }
         
         /* Free `nil` cell*/
         free(tree->nil);
@@ -223,7 +334,339 @@ scl_error_t free_avl(avl_tree_t * const __restrict__ tree) {
 }
 
 /**
- * @brief Function to update the height of a node that is broken.
+ * @brief Function to compute the number of bits needed to write a number,
+ * it is the height of a balanced tree holding that number of nodes.
+ * 
+ * @param number number to measure
+ * @return size_t number of bits of the number (0 for 0)
+ */
+static size_t avl_bulk_bit_length(size_t number) {
+    size_t bits = 0;
+
+    while (0 != number) {
+        number >>= 1;
+        ++bits;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Function to prepare the input of a bulk load. The input array is
+ * used as it is if it is sorted and has no duplicates, otherwise a sorted
+ * copy of it is made and every run of equal elements is merged into one
+ * element having a count, as repeated insertions do.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to the input array
+ * @param number_of_data number of elements of the input array
+ * @param work pointer to write the array of distinct elements (the input or an allocated copy)
+ * @param counts pointer to write the counts of the distinct elements (`NULL` if every count is one)
+ * @param number_of_nodes pointer to write the number of distinct elements
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t avl_bulk_prepare(const avl_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, uint8_t ** const work, uint32_t ** const counts, size_t * const number_of_nodes) {
+    const uint8_t * const input = data;
+    uint8_t is_sorted_set = 1;
+
+    *work = (uint8_t *)input;
+    *counts = NULL;
+    *number_of_nodes = number_of_data;
+
+    /* Check if the input is strictly increasing */
+    for (size_t iter = 1; iter < number_of_data; ++iter) {
+        if (tree->cmp(input + (iter - 1) * tree->data_size, input + iter * tree->data_size) >= 0) {
+            is_sorted_set = 0;
+            break;
+        }
+    }
+
+    if (1 == is_sorted_set) {
+        return SCL_OK;
+    }
+
+    /* Sort a copy of the input, the input is never modified */
+    uint8_t *sorted_data = malloc(number_of_data * tree->data_size);
+    uint32_t *sorted_counts = malloc(number_of_data * sizeof(*sorted_counts));
+
+    if ((NULL == sorted_data) || (NULL == sorted_counts)) {
+        free(sorted_data);
+        free(sorted_counts);
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    memcpy(sorted_data, input, number_of_data * tree->data_size);
+
+    scl_error_t err = merge_sort(sorted_data, number_of_data, tree->data_size, tree->cmp);
+
+    if (SCL_OK != err) {
+        free(sorted_data);
+        free(sorted_counts);
+
+        return err;
+    }
+
+    /* Merge the runs of equal elements */
+    size_t distinct_data = 0;
+
+    for (size_t iter = 0; iter < number_of_data; ++iter) {
+        const uint8_t * const current_data = sorted_data + iter * tree->data_size;
+
+        if ((0 != distinct_data) && (0 == tree->cmp(current_data, sorted_data + (distinct_data - 1) * tree->data_size))) {
+            ++sorted_counts[distinct_data - 1];
+        } else {
+            if (iter != distinct_data) {
+                memcpy(sorted_data + distinct_data * tree->data_size, current_data, tree->data_size);
+            }
+
+            sorted_counts[distinct_data++] = 1;
+        }
+    }
+
+    *work = sorted_data;
+    *counts = sorted_counts;
+    *number_of_nodes = distinct_data;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to create the node of the middle element of a range of
+ * distinct elements, the left half of the range goes into its left subtree
+ * and the right half into its right subtree.
+ * 
+ * @param tree an allocated avl tree object
+ * @param work array of distinct elements
+ * @param counts counts of the distinct elements (`NULL` if every count is one)
+ * @param lo index of the first element of the range
+ * @param hi index after the last element of the range
+ * @param depth depth of the new node (0 for root)
+ * @param height height of the whole tree
+ * @return avl_tree_node_t* a new node or `nil` if allocation failed
+ */
+static avl_tree_node_t* avl_bulk_node(const avl_tree_t * const __restrict__ tree, const uint8_t * const work, const uint32_t * const counts, size_t lo, size_t hi, size_t depth, size_t height) {
+    size_t middle = lo + (hi - lo - 1) / 2;
+    avl_tree_node_t *new_node = create_avl_node(tree, work + middle * tree->data_size);
+
+    /* Height of an avl node depends just on the size of its range */
+    (void)depth;
+    (void)height;
+
+    if (tree->nil != new_node) {
+        new_node->count = (NULL != counts) ? counts[middle] : 1;
+        avl_set_node_weight(new_node, new_node->count);
+
+        /* A balanced subtree of n nodes has the height equal to the bit length of n */
+        new_node->height = (uint32_t)avl_bulk_bit_length(hi - lo);
+    }
+
+    return new_node;
+}
+
+/**
+ * @brief Function to create the nodes of one level of a bulk loaded tree.
+ * The function goes down from the node of a range until the level above
+ * the new one and creates the children from left to right, so the nodes
+ * are allocated in breadth first order.
+ * 
+ * @param tree an allocated avl tree object
+ * @param node node of the range [lo, hi)
+ * @param work array of distinct elements
+ * @param counts counts of the distinct elements (`NULL` if every count is one)
+ * @param lo index of the first element of the range
+ * @param hi index after the last element of the range
+ * @param depth depth of the node
+ * @param level depth of the nodes to create
+ * @param height height of the whole tree
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t avl_bulk_build_level(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const node, const uint8_t * const work, const uint32_t * const counts, size_t lo, size_t hi, size_t depth, size_t level, size_t height) {
+    size_t middle = lo + (hi - lo - 1) / 2;
+
+    /* Go down until the parents of the new level */
+    if (depth + 1 < level) {
+        scl_error_t err = SCL_OK;
+
+        if (tree->nil != node->left) {
+            err = avl_bulk_build_level(tree, node->left, work, counts, lo, middle, depth + 1, level, height);
+        }
+
+        if ((SCL_OK == err) && (tree->nil != node->right)) {
+            err = avl_bulk_build_level(tree, node->right, work, counts, middle + 1, hi, depth + 1, level, height);
+        }
+
+        return err;
+    }
+
+    /* Create the children of the node */
+    if (lo < middle) {
+        node->left = avl_bulk_node(tree, work, counts, lo, middle, level, height);
+
+        if (tree->nil == node->left) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        node->left->parent = node;
+        ++(tree->size);
+    }
+
+    if (middle + 1 < hi) {
+        node->right = avl_bulk_node(tree, work, counts, middle + 1, hi, level, height);
+
+        if (tree->nil == node->right) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        node->right->parent = node;
+        ++(tree->size);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a avl tree object from an array of elements in O(N) for
+ * sorted input, without comparing or rotating anything. The middle element
+ * of every range becomes the root of its subtree, so the tree is perfectly
+ * balanced. The height of
+ * every node is the bit length of the size of its subtree. The nodes are allocated in breadth first order, if
+ * the tree has a pool all of them are carved from one chunk. Unsorted input
+ * is sorted first (in a copy) and equal elements are counted as repeated
+ * insertions do. The content of the data is owned by the tree as for
+ * insertion.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @param data pointer to an array of number_of_data elements
+ * @param number_of_data number of elements of the array
+ * @param nodes_per_chunk number of nodes allocated at once by the pool of the tree (0 for no pool)
+ * @return avl_tree_t* a new allocated avl tree or `NULL` (if function failed)
+ */
+avl_tree_t* create_avl_from_sorted(compare_func cmp, free_func frd, size_t data_size, const void * const data, size_t number_of_data, size_t nodes_per_chunk) {
+    /* Check if the input array is valid */
+    if ((NULL == data) && (0 != number_of_data)) {
+        errno = EINVAL;
+        perror("Input array undefined for avl tree");
+        return NULL;
+    }
+
+    avl_tree_t *new_tree = create_avl_with_pool(cmp, frd, data_size, nodes_per_chunk);
+
+    /* Check if the tree was created and if there is something to load */
+    if ((NULL == new_tree) || (NULL == new_tree->nil) || (0 == number_of_data)) {
+        return new_tree;
+    }
+
+    uint8_t *work = NULL;
+    uint32_t *counts = NULL;
+    size_t number_of_nodes = 0;
+
+    scl_error_t err = avl_bulk_prepare(new_tree, data, number_of_data, &work, &counts, &number_of_nodes);
+
+    /* Carve all the nodes one after another */
+    if ((SCL_OK == err) && (NULL != new_tree->pool)) {
+        err = pool_reserve(new_tree->pool, number_of_nodes);
+    }
+
+    if (SCL_OK == err) {
+        size_t height = avl_bulk_bit_length(number_of_nodes);
+
+        new_tree->root = avl_bulk_node(new_tree, work, counts, 0, number_of_nodes, 0, height);
+
+        if (new_tree->nil == new_tree->root) {
+            err = SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        } else {
+            new_tree->size = 1;
+        }
+
+        /* Create the tree level by level */
+        for (size_t level = 1; (SCL_OK == err) && (level < height); ++level) {
+            err = avl_bulk_build_level(new_tree, new_tree->root, work, counts, 0, number_of_nodes, 0, level, height);
+        }
+    }
+
+    /* Free the sorted copy of the input */
+    if ((const void *)work != data) {
+        free(work);
+    }
+
+    free(counts);
+
+    if (SCL_OK != err) {
+        free_avl(new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for avl tree bulk load");
+
+        return NULL;
+    }
+
+    return new_tree;
+}
+
+/**
+ * @brief Helper function to compute the weights of all the
+ * nodes from a subtree by Left-Right-Root principle.
+ * 
+ * @param tree an allocated avl tree object
+ * @param root current avl node object
+ * @return size_t weight of the root node
+ */
+static size_t avl_weight_helper(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ root) {
+    /* `nil` has no weight */
+    if (tree->nil == root) {
+        return 0;
+    }
+
+    avl_set_node_weight(root, avl_weight_helper(tree, root->left) + avl_weight_helper(tree, root->right) + root->count);
+
+    return avl_get_node_weight(root);
+}
+
+/**
+ * @brief Function to enable or disable the order statistics of an
+ * avl tree. With order statistics every node keeps the sum of the
+ * counts from its subtree, which is updated by insertions, deletions
+ * and rotations, so avl_select_data and avl_rank run in O(log N).
+ * Enabling them on a tree with nodes computes all the weights in O(N).
+ * Order statistics can be enabled just with SCL_TREE_ORDER_STATISTICS.
+ * 
+ * @param tree an allocated avl tree object
+ * @param order_statistics 1 to keep the weights of the nodes, 0 otherwise
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_set_order_statistics(avl_tree_t * const __restrict__ tree, uint8_t order_statistics) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+#if !defined(SCL_TREE_ORDER_STATISTICS)
+
+    /* The nodes have no room for the weights */
+    if (0 != order_statistics) {
+        return SCL_INVALID_INPUT;
+    }
+#endif
+
+    /* The weights were not updated while order statistics were disabled */
+    if ((0 != order_statistics) && (0 == tree->order_statistics)) {
+        avl_weight_helper(tree, tree->root);
+    }
+
+    tree->order_statistics = (0 != order_statistics);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to update the height of a node that is broken
+ * and its weight if the tree keeps order statistics.
  * Function may fail if the selected node is `nil`.
  * 
  * @param tree an allocated avl tree object
@@ -235,6 +678,11 @@ static void avl_update_node_height(const avl_tree_t * const __restrict__ tree, a
 
         /* Update node height */
         fix_node->height = _MAX(fix_node->left->height, fix_node->right->height) + 1;
+
+        /* Update node weight */
+        if (0 != tree->order_statistics) {
+            avl_set_node_weight(fix_node, avl_get_node_weight(fix_node->left) + avl_get_node_weight(fix_node->right) + fix_node->count);
+        }
     }
 }
 
@@ -463,6 +911,14 @@ scl_error_t avl_insert(avl_tree_t * const __restrict__ tree, const void * __rest
              * increment count value of node
              */
             ++(iterator->count);
+
+            /* The weights of all the ancestors grow with the count */
+            if (0 != tree->order_statistics) {
+                for (; tree->nil != iterator; iterator = iterator->parent) {
+                    avl_set_node_weight(iterator, avl_get_node_weight(iterator) + 1);
+                }
+            }
+
             return 0;
         }
     }
@@ -559,52 +1015,141 @@ const void* avl_find_data(const avl_tree_t * const __restrict__ tree, const void
 }
 
 /**
- * @brief Function to swap two nodes from an avl tree object.
- * This function MUST NOT be used by users, because it will
- * break the proprety of avl tree, it is used by program
- * to delete nodes from avl tree and must be used just
- * in delete function provided by the program.
+ * @brief Function to search many data values at once. The values are
+ * processed in groups of 16 and the searches of one group go down
+ * the tree in lockstep, one level at a time. Before a level is compared
+ * the data of all the current nodes is prefetched and after a step the
+ * next nodes are prefetched, so the cache misses of independent searches
+ * overlap instead of being paid one after another.
  * 
  * @param tree an allocated avl tree object
- * @param dest_node avl node object to rewrite data bytes from src_node
- * @param src_node avl node object to copy data bytes
+ * @param data pointer to an array of values stored one after another (data_size bytes each)
+ * @param number_of_data number of values from the array
+ * @param found_data pointer to an array of number_of_data pointers, found_data[i] is set to
+ * the data of the node equal to the i-th value or to `NULL` if it is not in the tree
  * @return scl_error_t enum object for handling errors
  */
-static scl_error_t avl_swap_nodes(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ dest_node, avl_tree_node_t * __restrict__ const src_node) {
-    /* Check if swap is posible */
-    if ((tree->nil == dest_node) || (tree->nil == src_node)) {
-        return SCL_CANNOT_SWAP_DATA;
+scl_error_t avl_find_batch(const avl_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, const void ** const found_data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
     }
 
-    /* Interchange the right child */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
 
-    avl_tree_node_t *temp = dest_node->right;
+    if (NULL == found_data) {
+        return SCL_INVALID_INPUT;
+    }
 
-    dest_node->right = src_node->right;
+    const uint8_t * const typed_data = data;
+    const avl_tree_node_t *nodes[DEFAULT_AVL_BATCH_SIZE];
+    size_t lanes[DEFAULT_AVL_BATCH_SIZE];
 
-    if (tree->nil != dest_node->right) {
-        dest_node->right->parent = dest_node;
-    }
+    for (size_t batch_start = 0; batch_start < number_of_data; batch_start += DEFAULT_AVL_BATCH_SIZE) {
+        size_t batch_size = number_of_data - batch_start;
 
-    src_node->right = temp;
+        if (DEFAULT_AVL_BATCH_SIZE < batch_size) {
+            batch_size = DEFAULT_AVL_BATCH_SIZE;
+        }
 
-    if (tree->nil != src_node->right) {
-        src_node->right->parent = src_node;
-    }
+        /* Every search of the group starts from the root */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            nodes[iter] = tree->root;
+            lanes[iter] = iter;
+            found_data[batch_start + iter] = NULL;
+        }
 
-    /* Interchange the left child */
+        size_t active_lanes = batch_size;
 
-    temp = dest_node->left;
+        /* Go down one level in all the unfinished searches */
+        while (0 != active_lanes) {
 
-    dest_node->left = src_node->left;
+            /* Prefetch the data of the current nodes */
+            for (size_t iter = 0; iter < active_lanes; ++iter) {
+                AVL_PREFETCH(nodes[lanes[iter]]->data);
+            }
 
-    if (tree->nil != dest_node->left) {
-        dest_node->left->parent = dest_node;
-    }
+            for (size_t iter = 0; iter < active_lanes;) {
+                const size_t lane = lanes[iter];
+                const avl_tree_node_t * const iterator = nodes[lane];
 
-    src_node->left = temp;
+                /* Search ended on `nil`, the value is not in the tree */
+                if (tree->nil == iterator) {
+                    lanes[iter] = lanes[--active_lanes];
+                    continue;
+                }
 
-    if (tree->nil != src_node->left) {
+                const int32_t compare_result = tree->cmp(iterator->data, typed_data + (batch_start + lane) * tree->data_size);
+
+                if (0 == compare_result) {
+
+                    /* Value found, the lane is finished */
+                    found_data[batch_start + lane] = iterator->data;
+                    lanes[iter] = lanes[--active_lanes];
+                    continue;
+                }
+
+                nodes[lane] = (compare_result >= 1) ? iterator->left : iterator->right;
+                AVL_PREFETCH(nodes[lane]);
+
+                ++iter;
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to swap two nodes from an avl tree object.
+ * This function MUST NOT be used by users, because it will
+ * break the proprety of avl tree, it is used by program
+ * to delete nodes from avl tree and must be used just
+ * in delete function provided by the program.
+ * 
+ * @param tree an allocated avl tree object
+ * @param dest_node avl node object to rewrite data bytes from src_node
+ * @param src_node avl node object to copy data bytes
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t avl_swap_nodes(avl_tree_t * const __restrict__ tree, avl_tree_node_t * const __restrict__ dest_node, avl_tree_node_t * __restrict__ const src_node) {
+    /* Check if swap is posible */
+    if ((tree->nil == dest_node) || (tree->nil == src_node)) {
+        return SCL_CANNOT_SWAP_DATA;
+    }
+
+    /* Interchange the right child */
+
+    avl_tree_node_t *temp = dest_node->right;
+
+    dest_node->right = src_node->right;
+
+    if (tree->nil != dest_node->right) {
+        dest_node->right->parent = dest_node;
+    }
+
+    src_node->right = temp;
+
+    if (tree->nil != src_node->right) {
+        src_node->right->parent = src_node;
+    }
+
+    /* Interchange the left child */
+
+    temp = dest_node->left;
+
+    dest_node->left = src_node->left;
+
+    if (tree->nil != dest_node->left) {
+        dest_node->left->parent = dest_node;
+    }
+
+    src_node->left = temp;
+
+    if (tree->nil != src_node->left) {
         src_node->left->parent = src_node;
     }
 
@@ -810,6 +1355,95 @@ const void* avl_min_data(const avl_tree_t * const __restrict__ tree, const void
     return avl_min_node(tree, avl_find_node(tree, subroot_data))->data;
 }
 
+/**
+ * @brief Function to get the data with the specified index from
+ * the sorted order of the avl tree, in O(log N). Repeated data is
+ * counted as many times as it was inserted, so every index from
+ * [count_before, count_before + count) selects the same data.
+ * Function may fail if the tree does not keep order statistics
+ * (see avl_set_order_statistics) or if index is not less than
+ * the number of inserted elements.
+ * 
+ * @param tree an allocated avl tree object
+ * @param index position of the data in sorted order (0 for minimum)
+ * @return const void* pointer to the selected data or `NULL`
+ */
+const void* avl_select_data(const avl_tree_t * const __restrict__ tree, size_t index) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (0 == tree->order_statistics) || (index >= avl_get_node_weight(tree->root))) {
+        return NULL;
+    }
+
+    const avl_tree_node_t *iterator = tree->root;
+
+    /* Go down on the side of the index */
+    while (tree->nil != iterator) {
+        if (index < avl_get_node_weight(iterator->left)) {
+            iterator = iterator->left;
+        } else if (index - avl_get_node_weight(iterator->left) < iterator->count) {
+            return iterator->data;
+        } else {
+            index -= avl_get_node_weight(iterator->left) + iterator->count;
+            iterator = iterator->right;
+        }
+    }
+
+    /* Weights are broken */
+    return NULL;
+}
+
+/**
+ * @brief Helper function to count the elements of the avl tree
+ * that are less than data (or less or equal if include_equal is 1)
+ * using the weights of the nodes.
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to an address of a generic data type
+ * @param include_equal 1 to count the elements equal to data too
+ * @return size_t number of elements before data
+ */
+static size_t avl_rank_helper(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data, uint8_t include_equal) {
+    const avl_tree_node_t *iterator = tree->root;
+    size_t rank = 0;
+
+    /* Add the left side of every node smaller than data */
+    while (tree->nil != iterator) {
+        int32_t compare_result = tree->cmp(iterator->data, data);
+
+        if (compare_result >= 1) {
+            iterator = iterator->left;
+        } else if (compare_result <= -1) {
+            rank += avl_get_node_weight(iterator->left) + iterator->count;
+            iterator = iterator->right;
+        } else {
+            return rank + avl_get_node_weight(iterator->left) + ((0 != include_equal) ? iterator->count : 0);
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Function to count the elements of the avl tree that
+ * are less than data, in O(log N). Repeated data is counted as
+ * many times as it was inserted and data does not have to be in
+ * the tree. Function may fail if the tree does not keep order
+ * statistics (see avl_set_order_statistics).
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to an address of a generic data type
+ * @return size_t number of elements less than data or `SIZE_MAX`
+ * if function failed
+ */
+size_t avl_rank(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (0 == tree->order_statistics) || (NULL == data)) {
+        return SIZE_MAX;
+    }
+
+    return avl_rank_helper(tree, data, 0);
+}
+
 /**
  * @brief Helper function to fix up the balance of a avl_tree_t
  * after deletion of one node. Function may fail if current
@@ -871,37 +1505,16 @@ static scl_error_t avl_delete_fix_node_up(avl_tree_t * const __restrict__ tree,
 }
 
 /**
- * @brief Function to delete one generic data from a avl.
- * Function may fail if input data is not valid or if
- * changing the data fails. You can delete one data at a time
- * and MUST specify a valid avl tree and a valid data pointer
+ * @brief Function to delete one node from a avl tree. The node
+ * is unlinked (swapped with its inorder successor if it has two
+ * children), its data is freed and the tree is fixed if needed.
+ * The other nodes keep their data, so pointers to them stay valid.
  * 
  * @param tree an allocated avl tree object
- * @param data pointer to an address of a generic data to be deleted
+ * @param delete_node avl tree node object to delete
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if (NULL == tree) {
-        return SCL_NULL_AVL;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Find current node (root) in avl tree */
-    avl_tree_node_t *delete_node = avl_find_node(tree, data);
-
-    /* Bst node was not found exit process */
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static scl_error_t avl_delete_node(avl_tree_t * const __restrict__ tree, avl_tree_node_t *delete_node) {
     /* Delete selected node */
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
 
@@ -996,8 +1609,8 @@ scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const
         tree->frd(delete_node->data);
     }
 
-    /* Free data pointer of selected node */
-    if (NULL != delete_node->data) {
+    /* Free data pointer of selected node, pooled data is released with its node */
+    if ((NULL == tree->pool) && (NULL != delete_node->data)) {
         free(delete_node->data);
     }
 
@@ -1006,7 +1619,11 @@ scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const
 
     /* Free selected avl node pointer */
     if (tree->nil != delete_node) {
-        free(delete_node);
+        if (NULL != tree->pool) {
+            pool_free(tree->pool, delete_node);
+        } else {
+            free(delete_node);
+        }
     }
 
     /* Set selected avl node as NULL */
@@ -1024,31 +1641,49 @@ scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const
 }
 
 /**
- * @brief Function to search the inorder predecessor for
- * a specified data type value. Function may fail if
- * avl tree is not allocated, if it is empty or if data
- * type pointer is not valid. Also function may fail if
- * the avl tree does not contain specified data pointer
+ * @brief Function to delete one generic data from a avl.
+ * Function may fail if input data is not valid or if
+ * changing the data fails. You can delete one data at a time
+ * and MUST specify a valid avl tree and a valid data pointer
  * 
  * @param tree an allocated avl tree object
- * @param data pointer to an address of a generic data type
- * @return avl_tree_node_t* `nil` or inorder predecessor of the
- * node containing (void *data) value.
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
  */
-static avl_tree_node_t* avl_predecessor_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+scl_error_t avl_delete(avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
     /* Check if input data is valid */
-    if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
-        return tree->nil;
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
     }
 
-    /* Find node containing the data value */
-    avl_tree_node_t *iterator = avl_find_node(tree, data);
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
 
-    /* If node is not in avl than return `nil` */
-    if (tree->nil == iterator) {
-        return tree->nil;
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
     }
 
+    /* Find current node (root) in avl tree */
+    avl_tree_node_t *delete_node = avl_find_node(tree, data);
+
+    /* Bst node was not found exit process */
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return avl_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to get the inorder predecessor of a node
+ * walking just the links of the nodes, without comparing data.
+ * 
+ * @param tree an allocated avl tree object
+ * @param iterator avl tree node object (not `nil`)
+ * @return avl_tree_node_t* `nil` or inorder predecessor of the node
+ */
+static avl_tree_node_t* avl_prev_node(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * __restrict__ iterator) {
     /*
      * If node has a left child than
      * find predecessor in left subtree
@@ -1066,12 +1701,11 @@ static avl_tree_node_t* avl_predecessor_node(const avl_tree_t * const __restrict
         parent_iterator = parent_iterator->parent;
     }
 
-    /* Return predecessor node of the data value node */
     return parent_iterator;
 }
 
 /**
- * @brief Function to search the inorder successor for
+ * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
  * avl tree is not allocated, if it is empty or if data
  * type pointer is not valid. Also function may fail if
@@ -1079,10 +1713,10 @@ static avl_tree_node_t* avl_predecessor_node(const avl_tree_t * const __restrict
  * 
  * @param tree an allocated avl tree object
  * @param data pointer to an address of a generic data type
- * @return avl_tree_node_t* `nil` or inorder successor of the
+ * @return avl_tree_node_t* `nil` or inorder predecessor of the
  * node containing (void *data) value.
  */
-static avl_tree_node_t* avl_successor_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+static avl_tree_node_t* avl_predecessor_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
     /* Check if input data is valid */
     if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
         return tree->nil;
@@ -1096,6 +1730,19 @@ static avl_tree_node_t* avl_successor_node(const avl_tree_t * const __restrict__
         return tree->nil;
     }
 
+    /* Return predecessor node of the data value node */
+    return avl_prev_node(tree, iterator);
+}
+
+/**
+ * @brief Function to get the inorder successor of a node
+ * walking just the links of the nodes, without comparing data.
+ * 
+ * @param tree an allocated avl tree object
+ * @param iterator avl tree node object (not `nil`)
+ * @return avl_tree_node_t* `nil` or inorder successor of the node
+ */
+static avl_tree_node_t* avl_next_node(const avl_tree_t * const __restrict__ tree, avl_tree_node_t * __restrict__ iterator) {
     /*
      * If node has a right child than
      * find successor in right subtree
@@ -1113,10 +1760,39 @@ static avl_tree_node_t* avl_successor_node(const avl_tree_t * const __restrict__
         parent_iterator = parent_iterator->parent;
     }
 
-    /* Return successor node of the data value node */
     return parent_iterator;
 }
 
+/**
+ * @brief Function to search the inorder successor for
+ * a specified data type value. Function may fail if
+ * avl tree is not allocated, if it is empty or if data
+ * type pointer is not valid. Also function may fail if
+ * the avl tree does not contain specified data pointer
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to an address of a generic data type
+ * @return avl_tree_node_t* `nil` or inorder successor of the
+ * node containing (void *data) value.
+ */
+static avl_tree_node_t* avl_successor_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
+        return tree->nil;
+    }
+
+    /* Find node containing the data value */
+    avl_tree_node_t *iterator = avl_find_node(tree, data);
+
+    /* If node is not in avl than return `nil` */
+    if (tree->nil == iterator) {
+        return tree->nil;
+    }
+
+    /* Return successor node of the data value node */
+    return avl_next_node(tree, iterator);
+}
+
 /**
  * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
@@ -1230,10 +1906,302 @@ const void* avl_lowest_common_ancestor_data(const avl_tree_t * const __restrict_
     return avl_lowest_common_ancestor_node(tree, data1, data2)->data;
 }
 
+/**
+ * @brief Function to find the first node with data greater
+ * or equal to a specified data, in O(log N).
+ * 
+ * @param tree an allocated avl tree object
+ * @param data pointer to an address of a generic data type
+ * @return avl_tree_node_t* `nil` or the first node not less than data
+ */
+static avl_tree_node_t* avl_lower_bound_node(const avl_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    avl_tree_node_t *iterator = tree->root;
+    avl_tree_node_t *lower_bound = tree->nil;
+
+    /* Remember the last node not less than data */
+    while (tree->nil != iterator) {
+        if (tree->cmp(iterator->data, data) >= 0) {
+            lower_bound = iterator;
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return lower_bound;
+}
+
+/**
+ * @brief Function to traverse in sorted order just the nodes with
+ * data from the range [lo, hi] and to perform an action on them.
+ * The first node is searched once and then the function follows
+ * the links of the nodes, so it runs in O(log N + K) where K is
+ * the number of nodes from the range. The action MUST NOT change
+ * the order of the data.
+ * 
+ * @param tree an allocated avl tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @param action a pointer to a function that will perform an action
+ * on every avl node object from the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_range_traverse(const avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Walk from the first node of the range until the data is greater than hi */
+    for (avl_tree_node_t *iterator = avl_lower_bound_node(tree, lo);
+        (tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0);
+        iterator = avl_next_node(tree, iterator)) {
+
+        action(iterator->data);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to count the elements of the avl tree with
+ * data from the range [lo, hi] in O(log N + K). Repeated data is
+ * counted as many times as it was inserted. If the tree keeps
+ * order statistics the weights of the nodes are used and the
+ * function runs in O(log N).
+ * 
+ * @param tree an allocated avl tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @return size_t number of elements from the range or `SIZE_MAX`
+ * if function failed
+ */
+size_t avl_range_count(const avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == lo) || (NULL == hi)) {
+        return SIZE_MAX;
+    }
+
+    /* Empty range */
+    if (tree->cmp(lo, hi) >= 1) {
+        return 0;
+    }
+
+    /* Count the elements using the weights */
+    if (0 != tree->order_statistics) {
+        return avl_rank_helper(tree, hi, 1) - avl_rank_helper(tree, lo, 0);
+    }
+
+    size_t count = 0;
+
+    /* Walk from the first node of the range until the data is greater than hi */
+    for (avl_tree_node_t *iterator = avl_lower_bound_node(tree, lo);
+        (tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0);
+        iterator = avl_next_node(tree, iterator)) {
+
+        count += iterator->count;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to delete all the nodes with data from the
+ * range [lo, hi]. The first node is searched once, the next node
+ * is taken before deleting the current one and every deletion
+ * just fixes the tree, so no node is searched again.
+ * 
+ * @param tree an allocated avl tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_range_delete(avl_tree_t * const __restrict__ tree, const void * const lo, const void * const hi) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    avl_tree_node_t *iterator = avl_lower_bound_node(tree, lo);
+
+    /* Delete the nodes one by one until the data is greater than hi */
+    while ((tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0)) {
+        avl_tree_node_t *next_iterator = avl_next_node(tree, iterator);
+
+        scl_error_t err = avl_delete_node(tree, iterator);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        iterator = next_iterator;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of
+ * the avl tree. The cursor is past the end if the tree is empty.
+ * A cursor stays valid while other elements are inserted or
+ * deleted, deleting the element under the cursor invalidates it.
+ * 
+ * @param tree an allocated avl tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_cursor_first(const avl_tree_t * const __restrict__ tree, avl_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    cursor->tree = tree;
+    cursor->node = (tree->nil != tree->root) ? avl_min_node(tree, tree->root) : tree->nil;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of
+ * the avl tree. The cursor is past the end if the tree is empty.
+ * 
+ * @param tree an allocated avl tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_cursor_last(const avl_tree_t * const __restrict__ tree, avl_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    cursor->tree = tree;
+    cursor->node = (tree->nil != tree->root) ? avl_max_node(tree, tree->root) : tree->nil;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the first element greater
+ * or equal to a specified data, in O(log N). The cursor is past
+ * the end if every element is less than data.
+ * 
+ * @param tree an allocated avl tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t avl_cursor_seek(const avl_tree_t * const __restrict__ tree, avl_cursor_t * const __restrict__ cursor, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    cursor->tree = tree;
+    cursor->node = avl_lower_bound_node(tree, data);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the current data or `NULL`
+ * if the cursor is past the end
+ */
+const void* avl_cursor_data(const avl_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    /* Data of `nil` is `NULL` */
+    return cursor->node->data;
+}
+
+/**
+ * @brief Function to move a cursor to the next element in sorted
+ * order, following the links of the nodes in amortized O(1). A
+ * cursor past the end moves to the smallest element.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the next data or `NULL` if the
+ * cursor moved past the end
+ */
+const void* avl_cursor_next(avl_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    if (cursor->tree->nil != cursor->node) {
+        cursor->node = avl_next_node(cursor->tree, cursor->node);
+    } else if (cursor->tree->nil != cursor->tree->root) {
+        cursor->node = avl_min_node(cursor->tree, cursor->tree->root);
+    }
+
+    return cursor->node->data;
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in sorted
+ * order, following the links of the nodes in amortized O(1). A
+ * cursor past the end moves to the greatest element.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the previous data or `NULL` if the
+ * cursor moved past the beginning
+ */
+const void* avl_cursor_prev(avl_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    if (cursor->tree->nil != cursor->node) {
+        cursor->node = avl_prev_node(cursor->tree, cursor->node);
+    } else if (cursor->tree->nil != cursor->tree->root) {
+        cursor->node = avl_max_node(cursor->tree, cursor->tree->root);
+    }
+
+    return cursor->node->data;
+}
+
 /**
  * @brief Helper function for avl_traverse_inorder function.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
+ * This method will iterate through all nodes without recursion by
+ * Left-Root-Right principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated avl tree object
  * @param root starting point of the avl tree traversal
@@ -1245,14 +2213,40 @@ static void avl_traverse_inorder_helper(const avl_tree_t * const __restrict__ tr
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    avl_traverse_inorder_helper(tree, root->left, action);
-    
-    /* Call action function */
-    action(root->data);
+    /* Start from the minimum node of the sub-tree */
+    const avl_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->right) {
+
+            /* Next node is the minimum of the right sub-tree */
+            iterator = iterator->right;
+
+            while (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            }
+        } else {
+
+            /* Go up until the node is a left child */
+            while ((root != iterator) && (iterator->parent->right == iterator)) {
+                iterator = iterator->parent;
+            }
+
+            if (root == iterator) {
+                return;
+            }
 
-    /* Traverse in the right sub-tree */
-    avl_traverse_inorder_helper(tree, root->right, action);
+            iterator = iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1295,8 +2289,8 @@ scl_error_t avl_traverse_inorder(const avl_tree_t * const __restrict__ tree, act
 
 /**
  * @brief Helper function for avl_traverse_preorder function.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * This method will iterate through all nodes without recursion by
+ * Root-Left-Right principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated avl tree object
  * @param root starting point of the avl tree traversal
@@ -1308,14 +2302,31 @@ static void avl_traverse_preorder_helper(const avl_tree_t * const __restrict__ t
         return;
     }
 
-    /* Call action function */
-    action(root->data);
+    const avl_tree_node_t *iterator = root;
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+
+            /* Go up until a left child with a right brother */
+            while ((root != iterator) && ((iterator->parent->right == iterator) || (tree->nil == iterator->parent->right))) {
+                iterator = iterator->parent;
+            }
 
-    /* Traverse in the left sub-tree */
-    avl_traverse_preorder_helper(tree, root->left, action);
+            if (root == iterator) {
+                return;
+            }
 
-    /* Traverse in the right sub-tree */
-    avl_traverse_preorder_helper(tree, root->right, action);
+            iterator = iterator->parent->right;
+        }
+    }
 }
 
 /**
@@ -1356,8 +2367,8 @@ scl_error_t avl_traverse_preorder(const avl_tree_t * const __restrict__ tree, ac
 
 /**
  * @brief Helper function for avl_traverse_postorder function.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * This method will iterate through all nodes without recursion by
+ * Left-Right-Root principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated avl tree object
  * @param root starting point of the avl tree traversal
@@ -1369,14 +2380,37 @@ static void avl_traverse_postorder_helper(const avl_tree_t * const __restrict__
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    avl_traverse_postorder_helper(tree, root->left, action);
+    const avl_tree_node_t *iterator = root;
+    uint8_t go_down = 1;
 
-    /* Traverse in the right sub-tree */
-    avl_traverse_postorder_helper(tree, root->right, action);
+    while (1) {
 
-    /* Call action function */
-    action(root->data);
+        /* Go down to the first leaf of the sub-tree */
+        while (0 != go_down) {
+            if (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            } else if (tree->nil != iterator->right) {
+                iterator = iterator->right;
+            } else {
+                go_down = 0;
+            }
+        }
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (root == iterator) {
+            return;
+        }
+
+        /* After a left child comes the right brother's sub-tree, otherwise the parent */
+        if ((iterator->parent->left == iterator) && (tree->nil != iterator->parent->right)) {
+            iterator = iterator->parent->right;
+            go_down = 1;
+        } else {
+            iterator = iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1442,62 +2476,40 @@ scl_error_t avl_traverse_level(const avl_tree_t * const __restrict__ tree, actio
 
         /* Tree is empty no node to traverse */
         printf("(Null)\n");
-    } else {
-
-        /* Create a queue for bfs tree traversal */
-        queue_t * const level_queue = create_queue(NULL, sizeof(tree->root));
-
-        /* Check if queue was created successfully */
-        if (NULL != level_queue) {
-
-            scl_error_t err = SCL_OK;
-            
-            /* Push pointer to root node into qeuue */
-            err = queue_push(level_queue, &tree->root);
 
-            if (SCL_OK != err) {
-                return err;
-            }
+        return SCL_OK;
+    }
 
-            /* Traverse all nodes */
-            while (!is_queue_empty(level_queue)) {
+    /* Every node is queued once, so one array of size nodes is the whole queue */
+    const avl_tree_node_t **level_nodes = malloc(tree->size * sizeof(*level_nodes));
 
-                /* Get front node from queue */
-                const avl_tree_node_t * const front_node = *(const avl_tree_node_t ** const)queue_front(level_queue);
+    if (NULL == level_nodes) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
 
-                /* Remove front node from queue */
-                err = queue_pop(level_queue);
+    size_t front = 0;
+    size_t back = 0;
 
-                if (SCL_OK != err) {
-                    return err;
-                }
+    level_nodes[back++] = tree->root;
 
-                /* Call action function on front node */
-                action(front_node->data);
+    /* Traverse all nodes */
+    while (front < back) {
+        const avl_tree_node_t * const front_node = level_nodes[front++];
 
-                /* Push on queue front left child if it exists */
-                if (tree->nil != front_node->left) {
-                    err = queue_push(level_queue, &front_node->left);
+        /* Call action function on front node */
+        action(front_node->data);
 
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-                
-                /* Push on queue front right child if it exists */
-                if (tree->nil != front_node->right) {
-                    err = queue_push(level_queue, &front_node->right);
-
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-            }
+        /* Queue the children of the front node */
+        if (tree->nil != front_node->left) {
+            level_nodes[back++] = front_node->left;
+        }
 
-            /* Free queue object from heap */
-            return free_queue(level_queue);
+        if (tree->nil != front_node->right) {
+            level_nodes[back++] = front_node->right;
         }
     }
 
-    return SCL_NULL_QUEUE;
+    free(level_nodes);
+
+    return SCL_OK;
 }
@@ -23,7 +23,10 @@
  */
 
 #include "./include/scl_bst_tree.h"
-#include "./include/scl_queue.h"
+#include "./include/scl_sort_algo.h"
+
+/* Offset of the data inside one pooled object, the data follows its node */
+#define BST_POOL_DATA_OFFSET ((sizeof(bst_tree_node_t) + 15) & ~((size_t)15))
 
 /**
  * @brief Create a bst object. Allocation may fail if there
@@ -33,9 +36,10 @@
  * @param cmp pointer to a function to compare two sets of data
  * @param frd pointer to a function to free content of one data
  * @param data_size length in bytes of the data data type
+ * @param nodes_per_chunk number of nodes allocated at once by the pool of the tree (0 for no pool)
  * @return bst_tree_t* a new allocated binary search tree or NULL (if function failed)
  */
-bst_tree_t* create_bst(compare_func cmp, free_func frd, size_t data_size) {
+bst_tree_t* create_bst_with_pool(compare_func cmp, free_func frd, size_t data_size, size_t nodes_per_chunk) {
     /* Check if cmp function is valid */
     if (NULL == cmp) {
         errno = EINVAL;
@@ -78,6 +82,20 @@ bst_tree_t* create_bst(compare_func cmp, free_func frd, size_t data_size) {
         new_tree->root = new_tree->nil;
         new_tree->data_size = data_size;
         new_tree->size = 0;
+
+        /* Nodes and data are carved from chunks just if a pool is requested */
+        new_tree->pool = NULL;
+
+        if (0 != nodes_per_chunk) {
+            new_tree->pool = create_pool(BST_POOL_DATA_OFFSET + data_size, nodes_per_chunk);
+
+            /* Pool was not allocated wipe tree's memory */
+            if (NULL == new_tree->pool) {
+                free(new_tree->nil);
+                free(new_tree);
+                new_tree = NULL;
+            }
+        }
     } else {
         errno = ENOMEM;
         perror("Not enough memory for bst allocation");
@@ -87,6 +105,19 @@ bst_tree_t* create_bst(compare_func cmp, free_func frd, size_t data_size) {
     return new_tree;
 }
 
+/**
+ * @brief Create a binary search tree object allocating every node and its data
+ * alone, as create_bst_with_pool without a pool.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @return bst_tree_t* a new allocated binary search tree or `NULL` (if function failed)
+ */
+bst_tree_t* create_bst(compare_func cmp, free_func frd, size_t data_size) {
+    return create_bst_with_pool(cmp, frd, data_size, 0);
+}
+
 /**
  * @brief Create a bst node object. Allocation of a new node
  * may fail if address of data is not valid or if not enough memory
@@ -103,8 +134,8 @@ static bst_tree_node_t* create_bst_node(const bst_tree_t * const __restrict__ tr
         return tree->nil;
     }
 
-    /* Allocate a new node on the heap */
-    bst_tree_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new node on the heap (or take one from the pool) */
+    bst_tree_node_t *new_node = (NULL != tree->pool) ? pool_alloc(tree->pool) : malloc(sizeof(*new_node));
 
     /* Check if allocation went successfully */
     if (NULL != new_node) {
@@ -114,8 +145,8 @@ static bst_tree_node_t* create_bst_node(const bst_tree_t * const __restrict__ tr
         new_node->parent = tree->nil;
         new_node->count = 1;
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(tree->data_size);
+        /* Allocate heap memory for data, a pooled node keeps its data just after it */
+        new_node->data = (NULL != tree->pool) ? (uint8_t *)new_node + BST_POOL_DATA_OFFSET : malloc(tree->data_size);
 
         /* Check if memory allocation went right */
         if (NULL != new_node->data) {
@@ -144,41 +175,51 @@ static bst_tree_node_t* create_bst_node(const bst_tree_t * const __restrict__ tr
 
 /**
  * @brief A helper function for free_bst function.
- * Function will iterate through all nodes recursively
- * by Left-Right-Root principle.
+ * Function will iterate through all nodes by Left-Right-Root
+ * principle without recursion, a leaf is freed and unlinked
+ * from its parent, so the parent may become a leaf.
  * 
  * @param tree an allocated binary search tree object
  * @param root pointer to pointer to current bst node object
  */
 static void free_bst_helper(const bst_tree_t * const __restrict__ tree, bst_tree_node_t ** const __restrict__ root) {
-    /* Check if current node is valid */
-    if (tree->nil == *root) {
-        return;
-    }
+    bst_tree_node_t *iterator = *root;
 
-    /* Recursive calls */
-    free_bst_helper(tree, &(*root)->left);
-    free_bst_helper(tree, &(*root)->right);
-
-    /* Free content of the data pointer */
-    if ((NULL != tree->frd) && (NULL != (*root)->data)) {
-        tree->frd((*root)->data);
-    }
+    while (tree->nil != iterator) {
 
-    /* Free data pointer */
-    if (NULL != (*root)->data) {
-        free((*root)->data);
-    }
+        /* Go down until a leaf */
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+            bst_tree_node_t * const parent_iterator = (*root != iterator) ? iterator->parent : tree->nil;
+
+            /* Unlink the leaf from its parent */
+            if (tree->nil != parent_iterator) {
+                if (parent_iterator->left == iterator) {
+                    parent_iterator->left = tree->nil;
+                } else {
+                    parent_iterator->right = tree->nil;
+                }
+            }
 
-    /* Set data pointer as NULL */
-    (*root)->data = NULL;
+            /* Free content of the data pointer */
+            if ((NULL != tree->frd) && (NULL != iterator->data)) {
+                tree->frd(iterator->data);
+            }
 
-    /* Free bst node pointer */
-    if (tree->nil != *root) {
-        free(*root);
+            /* Free data pointer and node, pooled nodes are released with the pool */
+            if (NULL == tree->pool) {
+                free(iterator->data);
+                free(iterator);
+            }
 
-        *root = tree->nil;
+            iterator = parent_iterator;
+        }
     }
+
+    *root = tree->nil;
 }
 
 /**
@@ -196,8 +237,16 @@ scl_error_t free_bst(bst_tree_t *const __restrict__ tree) {
     /* Check if tree needs to be freed */
     if (NULL != tree) {
 
-        /* Free every node from bst -> tree */
-        free_bst_helper(tree, &tree->root);
+        /* Free every node, pooled nodes are visited just to free the content of their data */
+        if ((NULL == tree->pool) || (NULL != tree->frd)) {
+            free_bst_helper(tree, &tree->root);
+        }
+
+        /* Release all pooled nodes at once */
+        if (NULL != tree->pool) {
+            free_pool(tree->pool);
+            tree->pool = NULL;
+        }
         
         /* Free `nil` cell*/
         free(tree->nil);
@@ -213,6 +262,276 @@ scl_error_t free_bst(bst_tree_t *const __restrict__ tree) {
     return SCL_NULL_BST;
 }
 
+/**
+ * @brief Function to compute the number of bits needed to write a number,
+ * it is the height of a balanced tree holding that number of nodes.
+ * 
+ * @param number number to measure
+ * @return size_t number of bits of the number (0 for 0)
+ */
+static size_t bst_bulk_bit_length(size_t number) {
+    size_t bits = 0;
+
+    while (0 != number) {
+        number >>= 1;
+        ++bits;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Function to prepare the input of a bulk load. The input array is
+ * used as it is if it is sorted and has no duplicates, otherwise a sorted
+ * copy of it is made and every run of equal elements is merged into one
+ * element having a count, as repeated insertions do.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to the input array
+ * @param number_of_data number of elements of the input array
+ * @param work pointer to write the array of distinct elements (the input or an allocated copy)
+ * @param counts pointer to write the counts of the distinct elements (`NULL` if every count is one)
+ * @param number_of_nodes pointer to write the number of distinct elements
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t bst_bulk_prepare(const bst_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, uint8_t ** const work, uint32_t ** const counts, size_t * const number_of_nodes) {
+    const uint8_t * const input = data;
+    uint8_t is_sorted_set = 1;
+
+    *work = (uint8_t *)input;
+    *counts = NULL;
+    *number_of_nodes = number_of_data;
+
+    /* Check if the input is strictly increasing */
+    for (size_t iter = 1; iter < number_of_data; ++iter) {
+        if (tree->cmp(input + (iter - 1) * tree->data_size, input + iter * tree->data_size) >= 0) {
+            is_sorted_set = 0;
+            break;
+        }
+    }
+
+    if (1 == is_sorted_set) {
+        return SCL_OK;
+    }
+
+    /* Sort a copy of the input, the input is never modified */
+    uint8_t *sorted_data = malloc(number_of_data * tree->data_size);
+    uint32_t *sorted_counts = malloc(number_of_data * sizeof(*sorted_counts));
+
+    if ((NULL == sorted_data) || (NULL == sorted_counts)) {
+        free(sorted_data);
+        free(sorted_counts);
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    memcpy(sorted_data, input, number_of_data * tree->data_size);
+
+    scl_error_t err = merge_sort(sorted_data, number_of_data, tree->data_size, tree->cmp);
+
+    if (SCL_OK != err) {
+        free(sorted_data);
+        free(sorted_counts);
+
+        return err;
+    }
+
+    /* Merge the runs of equal elements */
+    size_t distinct_data = 0;
+
+    for (size_t iter = 0; iter < number_of_data; ++iter) {
+        const uint8_t * const current_data = sorted_data + iter * tree->data_size;
+
+        if ((0 != distinct_data) && (0 == tree->cmp(current_data, sorted_data + (distinct_data - 1) * tree->data_size))) {
+            ++sorted_counts[distinct_data - 1];
+        } else {
+            if (iter != distinct_data) {
+                memcpy(sorted_data + distinct_data * tree->data_size, current_data, tree->data_size);
+            }
+
+            sorted_counts[distinct_data++] = 1;
+        }
+    }
+
+    *work = sorted_data;
+    *counts = sorted_counts;
+    *number_of_nodes = distinct_data;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to create the node of the middle element of a range of
+ * distinct elements, the left half of the range goes into its left subtree
+ * and the right half into its right subtree.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param work array of distinct elements
+ * @param counts counts of the distinct elements (`NULL` if every count is one)
+ * @param lo index of the first element of the range
+ * @param hi index after the last element of the range
+ * @param depth depth of the new node (0 for root)
+ * @param height height of the whole tree
+ * @return bst_tree_node_t* a new node or `nil` if allocation failed
+ */
+static bst_tree_node_t* bst_bulk_node(const bst_tree_t * const __restrict__ tree, const uint8_t * const work, const uint32_t * const counts, size_t lo, size_t hi, size_t depth, size_t height) {
+    size_t middle = lo + (hi - lo - 1) / 2;
+    bst_tree_node_t *new_node = create_bst_node(tree, work + middle * tree->data_size);
+
+    /* Shape of the tree does not change any member of a binary search tree node */
+    (void)depth;
+    (void)height;
+
+    if (tree->nil != new_node) {
+        new_node->count = (NULL != counts) ? counts[middle] : 1;
+    }
+
+    return new_node;
+}
+
+/**
+ * @brief Function to create the nodes of one level of a bulk loaded tree.
+ * The function goes down from the node of a range until the level above
+ * the new one and creates the children from left to right, so the nodes
+ * are allocated in breadth first order.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param node node of the range [lo, hi)
+ * @param work array of distinct elements
+ * @param counts counts of the distinct elements (`NULL` if every count is one)
+ * @param lo index of the first element of the range
+ * @param hi index after the last element of the range
+ * @param depth depth of the node
+ * @param level depth of the nodes to create
+ * @param height height of the whole tree
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t bst_bulk_build_level(bst_tree_t * const __restrict__ tree, bst_tree_node_t * const node, const uint8_t * const work, const uint32_t * const counts, size_t lo, size_t hi, size_t depth, size_t level, size_t height) {
+    size_t middle = lo + (hi - lo - 1) / 2;
+
+    /* Go down until the parents of the new level */
+    if (depth + 1 < level) {
+        scl_error_t err = SCL_OK;
+
+        if (tree->nil != node->left) {
+            err = bst_bulk_build_level(tree, node->left, work, counts, lo, middle, depth + 1, level, height);
+        }
+
+        if ((SCL_OK == err) && (tree->nil != node->right)) {
+            err = bst_bulk_build_level(tree, node->right, work, counts, middle + 1, hi, depth + 1, level, height);
+        }
+
+        return err;
+    }
+
+    /* Create the children of the node */
+    if (lo < middle) {
+        node->left = bst_bulk_node(tree, work, counts, lo, middle, level, height);
+
+        if (tree->nil == node->left) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        node->left->parent = node;
+        ++(tree->size);
+    }
+
+    if (middle + 1 < hi) {
+        node->right = bst_bulk_node(tree, work, counts, middle + 1, hi, level, height);
+
+        if (tree->nil == node->right) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        node->right->parent = node;
+        ++(tree->size);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a binary search tree object from an array of elements in O(N) for
+ * sorted input, without comparing or rotating anything. The middle element
+ * of every range becomes the root of its subtree, so the tree is perfectly
+ * balanced. The nodes are allocated in breadth first order, if
+ * the tree has a pool all of them are carved from one chunk. Unsorted input
+ * is sorted first (in a copy) and equal elements are counted as repeated
+ * insertions do. The content of the data is owned by the tree as for
+ * insertion.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @param data pointer to an array of number_of_data elements
+ * @param number_of_data number of elements of the array
+ * @param nodes_per_chunk number of nodes allocated at once by the pool of the tree (0 for no pool)
+ * @return bst_tree_t* a new allocated binary search tree or `NULL` (if function failed)
+ */
+bst_tree_t* create_bst_from_sorted(compare_func cmp, free_func frd, size_t data_size, const void * const data, size_t number_of_data, size_t nodes_per_chunk) {
+    /* Check if the input array is valid */
+    if ((NULL == data) && (0 != number_of_data)) {
+        errno = EINVAL;
+        perror("Input array undefined for binary search tree");
+        return NULL;
+    }
+
+    bst_tree_t *new_tree = create_bst_with_pool(cmp, frd, data_size, nodes_per_chunk);
+
+    /* Check if the tree was created and if there is something to load */
+    if ((NULL == new_tree) || (NULL == new_tree->nil) || (0 == number_of_data)) {
+        return new_tree;
+    }
+
+    uint8_t *work = NULL;
+    uint32_t *counts = NULL;
+    size_t number_of_nodes = 0;
+
+    scl_error_t err = bst_bulk_prepare(new_tree, data, number_of_data, &work, &counts, &number_of_nodes);
+
+    /* Carve all the nodes one after another */
+    if ((SCL_OK == err) && (NULL != new_tree->pool)) {
+        err = pool_reserve(new_tree->pool, number_of_nodes);
+    }
+
+    if (SCL_OK == err) {
+        size_t height = bst_bulk_bit_length(number_of_nodes);
+
+        new_tree->root = bst_bulk_node(new_tree, work, counts, 0, number_of_nodes, 0, height);
+
+        if (new_tree->nil == new_tree->root) {
+            err = SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        } else {
+            new_tree->size = 1;
+        }
+
+        /* Create the tree level by level */
+        for (size_t level = 1; (SCL_OK == err) && (level < height); ++level) {
+            err = bst_bulk_build_level(new_tree, new_tree->root, work, counts, 0, number_of_nodes, 0, level, height);
+        }
+    }
+
+    /* Free the sorted copy of the input */
+    if ((const void *)work != data) {
+        free(work);
+    }
+
+    free(counts);
+
+    if (SCL_OK != err) {
+        free_bst(new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for binary search tree bulk load");
+
+        return NULL;
+    }
+
+    return new_tree;
+}
+
 /**
  * @brief Function to insert one generic data to a bst.
  * Function may fail if bst or data os not valid (have
@@ -600,37 +919,16 @@ const void* bst_min_data(const bst_tree_t * const __restrict__ tree, const void
 }
 
 /**
- * @brief Function to delete one generic data from a bst.
- * Function may fail if input data is not valid or if
- * changing the data fails. You can delete one data at a time
- * and MUST specify a valid bst tree and a valid data pointer
+ * @brief Function to delete one node from a binary search tree. The node
+ * is unlinked (swapped with its inorder successor if it has two
+ * children), its data is freed and the tree is fixed if needed.
+ * The other nodes keep their data, so pointers to them stay valid.
  * 
  * @param tree an allocated binary search tree object
- * @param data pointer to an address of a generic data to be deleted
+ * @param delete_node bst tree node object to delete
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if (NULL == tree) {
-        return SCL_NULL_BST;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Find current node (root) in binary search tree */
-    bst_tree_node_t *delete_node = bst_find_node(tree, data);
-
-    /* Bst node was not found exit process */
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static scl_error_t bst_delete_node(bst_tree_t * const __restrict__ tree, bst_tree_node_t *delete_node) {
     /* Delete selected node */
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
 
@@ -721,8 +1019,8 @@ scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const
         tree->frd(delete_node->data);
     }
 
-    /* Free data pointer of selected node */
-    if (NULL != delete_node->data) {
+    /* Free data pointer of selected node, pooled data is released with its node */
+    if ((NULL == tree->pool) && (NULL != delete_node->data)) {
         free(delete_node->data);
     }
 
@@ -731,7 +1029,11 @@ scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const
 
     /* Free selected bst node pointer */
     if (tree->nil != delete_node) {
-        free(delete_node);
+        if (NULL != tree->pool) {
+            pool_free(tree->pool, delete_node);
+        } else {
+            free(delete_node);
+        }
     }
 
     /* Set selected bst node as `nil` */
@@ -745,31 +1047,49 @@ scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const
 }
 
 /**
- * @brief Function to search the inorder predecessor for
- * a specified data type value. Function may fail if
- * bst tree is not allocated, if it is empty or if data
- * type pointer is not valid. Also function may fail if
- * the bst tree does not contain specified data pointer
+ * @brief Function to delete one generic data from a bst.
+ * Function may fail if input data is not valid or if
+ * changing the data fails. You can delete one data at a time
+ * and MUST specify a valid bst tree and a valid data pointer
  * 
  * @param tree an allocated binary search tree object
- * @param data pointer to an address of a generic data type
- * @return bst_tree_node_t* nil or inorder predecessor of the
- * node containing (void *data) value.
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
  */
-static bst_tree_node_t* bst_predecessor_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+scl_error_t bst_delete(bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
     /* Check if input data is valid */
-    if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
-        return tree->nil;
+    if (NULL == tree) {
+        return SCL_NULL_BST;
     }
 
-    /* Find node containing the data value */
-    bst_tree_node_t *iterator = bst_find_node(tree, data);
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
 
-    /* If node is not in bst than return `nil` */
-    if (tree->nil == iterator) {
-        return tree->nil;
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
     }
 
+    /* Find current node (root) in binary search tree */
+    bst_tree_node_t *delete_node = bst_find_node(tree, data);
+
+    /* Bst node was not found exit process */
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return bst_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to get the inorder predecessor of a node
+ * walking just the links of the nodes, without comparing data.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param iterator binary search tree node object (not `nil`)
+ * @return bst_tree_node_t* `nil` or inorder predecessor of the node
+ */
+static bst_tree_node_t* bst_prev_node(const bst_tree_t * const __restrict__ tree, bst_tree_node_t * __restrict__ iterator) {
     /*
      * If node has a left child than
      * find predecessor in left subtree
@@ -787,12 +1107,11 @@ static bst_tree_node_t* bst_predecessor_node(const bst_tree_t * const __restrict
         parent_iterator = parent_iterator->parent;
     }
 
-    /* Return predecessor node of the data value node */
     return parent_iterator;
 }
 
 /**
- * @brief Function to search the inorder successor for
+ * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
  * bst tree is not allocated, if it is empty or if data
  * type pointer is not valid. Also function may fail if
@@ -800,10 +1119,10 @@ static bst_tree_node_t* bst_predecessor_node(const bst_tree_t * const __restrict
  * 
  * @param tree an allocated binary search tree object
  * @param data pointer to an address of a generic data type
- * @return bst_tree_node_t* nil or inorder successor of the
+ * @return bst_tree_node_t* nil or inorder predecessor of the
  * node containing (void *data) value.
  */
-static bst_tree_node_t* bst_successor_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+static bst_tree_node_t* bst_predecessor_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
     /* Check if input data is valid */
     if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
         return tree->nil;
@@ -817,6 +1136,19 @@ static bst_tree_node_t* bst_successor_node(const bst_tree_t * const __restrict__
         return tree->nil;
     }
 
+    /* Return predecessor node of the data value node */
+    return bst_prev_node(tree, iterator);
+}
+
+/**
+ * @brief Function to get the inorder successor of a node
+ * walking just the links of the nodes, without comparing data.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param iterator bst tree node object (not `nil`)
+ * @return bst_tree_node_t* `nil` or inorder successor of the node
+ */
+static bst_tree_node_t* bst_next_node(const bst_tree_t * const __restrict__ tree, bst_tree_node_t * __restrict__ iterator) {
     /*
      * If node has a right child than
      * find successor in right subtree
@@ -834,10 +1166,39 @@ static bst_tree_node_t* bst_successor_node(const bst_tree_t * const __restrict__
         parent_iterator = parent_iterator->parent;
     }
 
-    /* Return successor node of the data value node */
     return parent_iterator;
 }
 
+/**
+ * @brief Function to search the inorder successor for
+ * a specified data type value. Function may fail if
+ * bst tree is not allocated, if it is empty or if data
+ * type pointer is not valid. Also function may fail if
+ * the bst tree does not contain specified data pointer
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to an address of a generic data type
+ * @return bst_tree_node_t* nil or inorder successor of the
+ * node containing (void *data) value.
+ */
+static bst_tree_node_t* bst_successor_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (tree->nil == tree->root) || (NULL == data)) {
+        return tree->nil;
+    }
+
+    /* Find node containing the data value */
+    bst_tree_node_t *iterator = bst_find_node(tree, data);
+
+    /* If node is not in bst than return `nil` */
+    if (tree->nil == iterator) {
+        return tree->nil;
+    }
+
+    /* Return successor node of the data value node */
+    return bst_next_node(tree, iterator);
+}
+
 /**
  * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
@@ -951,10 +1312,290 @@ const void* bst_lowest_common_ancestor_data(const bst_tree_t * const __restrict_
     return bst_lowest_common_ancestor_node(tree, data1, data2)->data;
 }
 
+/**
+ * @brief Function to find the first node with data greater
+ * or equal to a specified data, in O(log N).
+ * 
+ * @param tree an allocated binary search tree object
+ * @param data pointer to an address of a generic data type
+ * @return bst_tree_node_t* `nil` or the first node not less than data
+ */
+static bst_tree_node_t* bst_lower_bound_node(const bst_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    bst_tree_node_t *iterator = tree->root;
+    bst_tree_node_t *lower_bound = tree->nil;
+
+    /* Remember the last node not less than data */
+    while (tree->nil != iterator) {
+        if (tree->cmp(iterator->data, data) >= 0) {
+            lower_bound = iterator;
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return lower_bound;
+}
+
+/**
+ * @brief Function to traverse in sorted order just the nodes with
+ * data from the range [lo, hi] and to perform an action on them.
+ * The first node is searched once and then the function follows
+ * the links of the nodes, so it runs in O(log N + K) where K is
+ * the number of nodes from the range. The action MUST NOT change
+ * the order of the data.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @param action a pointer to a function that will perform an action
+ * on every bst node object from the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_range_traverse(const bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Walk from the first node of the range until the data is greater than hi */
+    for (bst_tree_node_t *iterator = bst_lower_bound_node(tree, lo);
+        (tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0);
+        iterator = bst_next_node(tree, iterator)) {
+
+        action(iterator->data);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to count the elements of the binary search tree with
+ * data from the range [lo, hi] in O(log N + K). Repeated data is
+ * counted as many times as it was inserted.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @return size_t number of elements from the range or `SIZE_MAX`
+ * if function failed
+ */
+size_t bst_range_count(const bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == lo) || (NULL == hi)) {
+        return SIZE_MAX;
+    }
+
+    size_t count = 0;
+
+    /* Walk from the first node of the range until the data is greater than hi */
+    for (bst_tree_node_t *iterator = bst_lower_bound_node(tree, lo);
+        (tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0);
+        iterator = bst_next_node(tree, iterator)) {
+
+        count += iterator->count;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to delete all the nodes with data from the
+ * range [lo, hi]. The first node is searched once, the next node
+ * is taken before deleting the current one and every deletion
+ * just fixes the tree, so no node is searched again.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_range_delete(bst_tree_t * const __restrict__ tree, const void * const lo, const void * const hi) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    bst_tree_node_t *iterator = bst_lower_bound_node(tree, lo);
+
+    /* Delete the nodes one by one until the data is greater than hi */
+    while ((tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0)) {
+        bst_tree_node_t *next_iterator = bst_next_node(tree, iterator);
+
+        scl_error_t err = bst_delete_node(tree, iterator);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        iterator = next_iterator;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of
+ * the binary search tree. The cursor is past the end if the tree is empty.
+ * A cursor stays valid while other elements are inserted or
+ * deleted, deleting the element under the cursor invalidates it.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_cursor_first(const bst_tree_t * const __restrict__ tree, bst_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    cursor->tree = tree;
+    cursor->node = (tree->nil != tree->root) ? bst_min_node(tree, tree->root) : tree->nil;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of
+ * the binary search tree. The cursor is past the end if the tree is empty.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_cursor_last(const bst_tree_t * const __restrict__ tree, bst_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    cursor->tree = tree;
+    cursor->node = (tree->nil != tree->root) ? bst_max_node(tree, tree->root) : tree->nil;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the first element greater
+ * or equal to a specified data, in O(log N). The cursor is past
+ * the end if every element is less than data.
+ * 
+ * @param tree an allocated binary search tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t bst_cursor_seek(const bst_tree_t * const __restrict__ tree, bst_cursor_t * const __restrict__ cursor, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BST;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    cursor->tree = tree;
+    cursor->node = bst_lower_bound_node(tree, data);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the current data or `NULL`
+ * if the cursor is past the end
+ */
+const void* bst_cursor_data(const bst_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    /* Data of `nil` is `NULL` */
+    return cursor->node->data;
+}
+
+/**
+ * @brief Function to move a cursor to the next element in sorted
+ * order, following the links of the nodes in amortized O(1). A
+ * cursor past the end moves to the smallest element.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the next data or `NULL` if the
+ * cursor moved past the end
+ */
+const void* bst_cursor_next(bst_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    if (cursor->tree->nil != cursor->node) {
+        cursor->node = bst_next_node(cursor->tree, cursor->node);
+    } else if (cursor->tree->nil != cursor->tree->root) {
+        cursor->node = bst_min_node(cursor->tree, cursor->tree->root);
+    }
+
+    return cursor->node->data;
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in sorted
+ * order, following the links of the nodes in amortized O(1). A
+ * cursor past the end moves to the greatest element.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the previous data or `NULL` if the
+ * cursor moved past the beginning
+ */
+const void* bst_cursor_prev(bst_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    if (cursor->tree->nil != cursor->node) {
+        cursor->node = bst_prev_node(cursor->tree, cursor->node);
+    } else if (cursor->tree->nil != cursor->tree->root) {
+        cursor->node = bst_max_node(cursor->tree, cursor->tree->root);
+    }
+
+    return cursor->node->data;
+}
+
 /**
  * @brief Helper function for bst_traverse_inorder function.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
+ * This method will iterate through all nodes without recursion by
+ * Left-Root-Right principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated binary search tree object
  * @param root starting point of the binary search tree traversal
@@ -966,14 +1607,40 @@ static void bst_traverse_inorder_helper(const bst_tree_t * const __restrict__ tr
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    bst_traverse_inorder_helper(tree, root->left, action);
-    
-    /* Call action function */
-    action(root->data);
+    /* Start from the minimum node of the sub-tree */
+    const bst_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->right) {
+
+            /* Next node is the minimum of the right sub-tree */
+            iterator = iterator->right;
+
+            while (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            }
+        } else {
+
+            /* Go up until the node is a left child */
+            while ((root != iterator) && (iterator->parent->right == iterator)) {
+                iterator = iterator->parent;
+            }
 
-    /* Traverse in the right sub-tree */
-    bst_traverse_inorder_helper(tree, root->right, action);
+            if (root == iterator) {
+                return;
+            }
+
+            iterator = iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1014,8 +1681,8 @@ scl_error_t bst_traverse_inorder(const bst_tree_t * const __restrict__ tree, act
 
 /**
  * @brief Helper function for bst_traverse_preorder function.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * This method will iterate through all nodes without recursion by
+ * Root-Left-Right principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated binary search tree object
  * @param root starting point of the binary search tree traversal
@@ -1027,14 +1694,31 @@ static void bst_traverse_preorder_helper(const bst_tree_t * const __restrict__ t
         return;
     }
 
-    /* Call action function */
-    action(root->data);
+    const bst_tree_node_t *iterator = root;
 
-    /* Traverse in the left sub-tree */
-    bst_traverse_preorder_helper(tree, root->left, action);
+    while (1) {
 
-    /* Traverse in the right sub-tree */
-    bst_traverse_preorder_helper(tree, root->right, action);
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+
+            /* Go up until a left child with a right brother */
+            while ((root != iterator) && ((iterator->parent->right == iterator) || (tree->nil == iterator->parent->right))) {
+                iterator = iterator->parent;
+            }
+
+            if (root == iterator) {
+                return;
+            }
+
+            iterator = iterator->parent->right;
+        }
+    }
 }
 
 /**
@@ -1075,8 +1759,8 @@ scl_error_t bst_traverse_preorder(const bst_tree_t * const __restrict__ tree, ac
 
 /**
  * @brief Helper function for bst_traverse_postorder function.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * This method will iterate through all nodes without recursion by
+ * Left-Right-Root principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated binary search tree object
  * @param root starting point of the binary search tree traversal
@@ -1088,14 +1772,37 @@ static void bst_traverse_postorder_helper(const bst_tree_t * const __restrict__
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    bst_traverse_postorder_helper(tree, root->left, action);
+    const bst_tree_node_t *iterator = root;
+    uint8_t go_down = 1;
 
-    /* Traverse in the right sub-tree */
-    bst_traverse_postorder_helper(tree, root->right, action);
+    while (1) {
 
-    /* Call action function */
-    action(root->data);
+        /* Go down to the first leaf of the sub-tree */
+        while (0 != go_down) {
+            if (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            } else if (tree->nil != iterator->right) {
+                iterator = iterator->right;
+            } else {
+                go_down = 0;
+            }
+        }
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (root == iterator) {
+            return;
+        }
+
+        /* After a left child comes the right brother's sub-tree, otherwise the parent */
+        if ((iterator->parent->left == iterator) && (tree->nil != iterator->parent->right)) {
+            iterator = iterator->parent->right;
+            go_down = 1;
+        } else {
+            iterator = iterator->parent;
+        }
+    }
 }
 
 /**
@@ -1150,7 +1857,7 @@ scl_error_t bst_traverse_postorder(const bst_tree_t * const __restrict__ tree, a
 scl_error_t bst_traverse_level(const bst_tree_t * const __restrict__ tree, action_func action) {
     /* Check if input data is valid */
     if (NULL == tree) {
-        return SCL_NULL_AVL;
+        return SCL_NULL_BST;
     }
 
     if (NULL == action) {
@@ -1161,62 +1868,40 @@ scl_error_t bst_traverse_level(const bst_tree_t * const __restrict__ tree, actio
 
         /* Tree is empty no node to traverse */
         printf("(Null)\n");
-    } else {
-
-        /* Create a queue for bfs tree traversal */
-        queue_t * const level_queue = create_queue(NULL, sizeof(tree->root));
-
-        /* Check if queue was created successfully */
-        if (NULL != level_queue) {
 
-            scl_error_t err = SCL_OK;
-
-            /* Push pointer to root node into qeuue */
-            err = queue_push(level_queue, &tree->root);
-
-            if (SCL_OK != err) {
-                return err;
-            }
+        return SCL_OK;
+    }
 
-            /* Traverse all nodes */
-            while (!is_queue_empty(level_queue)) {
+    /* Every node is queued once, so one array of size nodes is the whole queue */
+    const bst_tree_node_t **level_nodes = malloc(tree->size * sizeof(*level_nodes));
 
-                /* Get front node from queue */
-                const bst_tree_node_t * const front_node = *(const bst_tree_node_t ** const)queue_front(level_queue);
+    if (NULL == level_nodes) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
 
-                /* Remove front node from queue */
-                err = queue_pop(level_queue);
+    size_t front = 0;
+    size_t back = 0;
 
-                if (SCL_OK != err) {
-                    return err;
-                }
+    level_nodes[back++] = tree->root;
 
-                /* Call action function on front node */
-                action(front_node->data);
+    /* Traverse all nodes */
+    while (front < back) {
+        const bst_tree_node_t * const front_node = level_nodes[front++];
 
-                /* Push on queue front left child if it exists */
-                if (tree->nil != front_node->left) {
-                    err = queue_push(level_queue, &front_node->left);
+        /* Call action function on front node */
+        action(front_node->data);
 
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-                
-                /* Push on queue front right child if it exists */
-                if (tree->nil != front_node->right) {
-                    err = queue_push(level_queue, &front_node->right);
-
-                    if (SCL_OK != err) {
-                        return err;
-                    } 
-                }
-            }
+        /* Queue the children of the front node */
+        if (tree->nil != front_node->left) {
+            level_nodes[back++] = front_node->left;
+        }
 
-            /* Free queue object from heap */
-            return free_queue(level_queue);
+        if (tree->nil != front_node->right) {
+            level_nodes[back++] = front_node->right;
         }
     }
 
-    return SCL_NULL_QUEUE;
+    free(level_nodes);
+
+    return SCL_OK;
 }
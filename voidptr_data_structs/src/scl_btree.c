@@ -0,0 +1,953 @@
+/**
+ * @file scl_btree.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_btree.h"
+
+#define DEFAULT_BTREE_NODE_BYTES 256
+#define DEFAULT_BTREE_MIN_CAPACITY 4
+#define DEFAULT_BTREE_MAX_HEIGHT 64
+#define DEFAULT_BTREE_ALIGN 16
+
+/**
+ * @brief Function to round a length up to the alignment of the nodes.
+ * 
+ * @param length number of bytes
+ * @return size_t length rounded up to DEFAULT_BTREE_ALIGN
+ */
+static size_t btree_align(size_t length) {
+    return (length + DEFAULT_BTREE_ALIGN - 1) & ~((size_t)DEFAULT_BTREE_ALIGN - 1);
+}
+
+/**
+ * @brief Create a b+ tree object. Every node keeps up to node_capacity
+ * data inline, one after another, so searching a node touches just a
+ * few cache lines and a tree of a million elements has 3-4 levels.
+ * The leaves are linked, so sorted scans do not go up the tree.
+ * Allocation may fail if heap memory is full or the arguments are
+ * not valid, in this case an exception will be thrown.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @param node_capacity maximum number of data of one node (0 to fill
+ * DEFAULT_BTREE_NODE_BYTES bytes, at least DEFAULT_BTREE_MIN_CAPACITY)
+ * @return btree_t* a new allocated b+ tree or `NULL` (if function failed)
+ */
+btree_t* create_btree_with_capacity(compare_func cmp, free_func frd, size_t data_size, size_t node_capacity) {
+    /* Check if compare function is valid */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for b+ tree");
+        return NULL;
+    }
+
+    /* Check if size of the data is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    /* Fill the default number of bytes with data */
+    if (0 == node_capacity) {
+        node_capacity = DEFAULT_BTREE_NODE_BYTES / data_size;
+    }
+
+    /* A node must keep at least two data after splitting */
+    if (DEFAULT_BTREE_MIN_CAPACITY > node_capacity) {
+        node_capacity = DEFAULT_BTREE_MIN_CAPACITY;
+    }
+
+    /* Allocate a new b+ tree object on heap */
+    btree_t *new_tree = malloc(sizeof(*new_tree));
+
+    /* Check if b+ tree object was allocated */
+    if (NULL == new_tree) {
+        errno = ENOMEM;
+        perror("Not enough memory for b+ tree allocation");
+        return NULL;
+    }
+
+    /* Set function pointers */
+    new_tree->cmp = cmp;
+    new_tree->frd = frd;
+
+    /* Set the sizes of the b+ tree */
+    new_tree->data_size = data_size;
+    new_tree->size = 0;
+    new_tree->node_capacity = node_capacity;
+    new_tree->links_offset = btree_align(node_capacity * data_size);
+    new_tree->height = 1;
+
+    /* Scratch keeps one more data and child than a full inner node and the promoted data */
+    new_tree->scratch = malloc(btree_align((node_capacity + 2) * data_size) + (node_capacity + 2) * sizeof(btree_node_t *));
+
+    /* The root of an empty b+ tree is an empty leaf */
+    new_tree->root = malloc(sizeof(*new_tree->root) + new_tree->links_offset + node_capacity * sizeof(uint32_t));
+
+    if ((NULL == new_tree->scratch) || (NULL == new_tree->root)) {
+        free(new_tree->scratch);
+        free(new_tree->root);
+        free(new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for b+ tree allocation");
+        return NULL;
+    }
+
+    new_tree->root->prev = new_tree->root->next = NULL;
+    new_tree->root->size = 0;
+    new_tree->root->is_leaf = 1;
+
+    new_tree->first_leaf = new_tree->last_leaf = new_tree->root;
+
+    /* Return a new allocated b+ tree object */
+    return new_tree;
+}
+
+/**
+ * @brief Create a b+ tree object with nodes of DEFAULT_BTREE_NODE_BYTES
+ * bytes of data, as create_btree_with_capacity with a zero capacity.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @return btree_t* a new allocated b+ tree or `NULL` (if function failed)
+ */
+btree_t* create_btree(compare_func cmp, free_func frd, size_t data_size) {
+    return create_btree_with_capacity(cmp, frd, data_size, 0);
+}
+
+/**
+ * @brief Function to get the address of one data of a node.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param node a b+ tree node object
+ * @param index position of the data in the node
+ * @return uint8_t* address of the data
+ */
+static uint8_t* btree_node_data(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ node, size_t index) {
+    return node->data + index * tree->data_size;
+}
+
+/**
+ * @brief Function to get the children of an inner node.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param node an inner b+ tree node object
+ * @return btree_node_t** array of node->size + 1 children
+ */
+static btree_node_t** btree_node_children(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ node) {
+    return (btree_node_t **)(node->data + tree->links_offset);
+}
+
+/**
+ * @brief Function to get the counts of the data of a leaf.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param node a leaf b+ tree node object
+ * @return uint32_t* array of node->size counts
+ */
+static uint32_t* btree_node_counts(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ node) {
+    return (uint32_t *)(node->data + tree->links_offset);
+}
+
+/**
+ * @brief Create a b+ tree node object. Allocation may
+ * fail if not enough memory is left on heap.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param is_leaf 1 for a leaf, 0 for an inner node
+ * @return btree_node_t* a new allocated node or `NULL`
+ */
+static btree_node_t* create_btree_node(const btree_t * const __restrict__ tree, uint32_t is_leaf) {
+    size_t links_size = (0 != is_leaf) ? tree->node_capacity * sizeof(uint32_t) : (tree->node_capacity + 1) * sizeof(btree_node_t *);
+    btree_node_t *new_node = malloc(sizeof(*new_node) + tree->links_offset + links_size);
+
+    /* Set default node data */
+    if (NULL != new_node) {
+        new_node->prev = new_node->next = NULL;
+        new_node->size = 0;
+        new_node->is_leaf = is_leaf;
+    }
+
+    return new_node;
+}
+
+/**
+ * @brief Helper function for free_btree function. Function
+ * frees the data of the leaves and all the nodes recursively.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param node current b+ tree node object
+ */
+static void free_btree_helper(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ node) {
+    if (0 != node->is_leaf) {
+
+        /* Free content of the data */
+        if (NULL != tree->frd) {
+            for (size_t iter = 0; iter < node->size; ++iter) {
+                tree->frd(btree_node_data(tree, node, iter));
+            }
+        }
+    } else {
+
+        /* Free the children */
+        for (size_t iter = 0; iter <= node->size; ++iter) {
+            free_btree_helper(tree, btree_node_children(tree, node)[iter]);
+        }
+    }
+
+    free(node);
+}
+
+/**
+ * @brief Function to free every node and every data from
+ * a b+ tree object.
+ * 
+ * @param tree an allocated b+ tree object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_btree(btree_t * const __restrict__ tree) {
+    /* Check if tree is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BTREE;
+    }
+
+    /* Free all nodes */
+    free_btree_helper(tree, tree->root);
+
+    free(tree->scratch);
+    free(tree);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search the first data of a node that
+ * is greater or equal to a specified data, by binary search.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param node a b+ tree node object
+ * @param data pointer to an address of a generic data type
+ * @param found set to 1 if the node contains data, 0 otherwise
+ * @return size_t position of the first data not less than data
+ */
+static size_t btree_search_node(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ node, const void * const __restrict__ data, uint8_t * const __restrict__ found) {
+    size_t left = 0;
+    size_t right = node->size;
+
+    *found = 0;
+
+    while (left < right) {
+        size_t middle = left + (right - left) / 2;
+        int32_t compare_result = tree->cmp(btree_node_data(tree, node, middle), data);
+
+        if (compare_result <= -1) {
+            left = middle + 1;
+        } else {
+            if (0 == compare_result) {
+                *found = 1;
+                return middle;
+            }
+
+            right = middle;
+        }
+    }
+
+    return left;
+}
+
+/**
+ * @brief Function to go down from the root to the leaf that
+ * may contain data. Every separator of an inner node is the first
+ * data of the subtree at its right, so equal data goes right.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param data pointer to an address of a generic data type
+ * @param path array to save the inner nodes of the path (may be `NULL`)
+ * @param path_index array to save the children taken on the path (may be `NULL`)
+ * @return btree_node_t* leaf that may contain data
+ */
+static btree_node_t* btree_find_leaf(const btree_t * const __restrict__ tree, const void * const __restrict__ data, btree_node_t ** const path, size_t * const path_index) {
+    btree_node_t *iterator = tree->root;
+
+    for (size_t level = 0; 0 == iterator->is_leaf; ++level) {
+        uint8_t found = 0;
+        size_t index = btree_search_node(tree, iterator, data, &found) + found;
+
+        if (NULL != path) {
+            path[level] = iterator;
+            path_index[level] = index;
+        }
+
+        iterator = btree_node_children(tree, iterator)[index];
+    }
+
+    return iterator;
+}
+
+/**
+ * @brief Function to insert one data into a leaf with free space.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param leaf a leaf b+ tree node object
+ * @param index position of the new data
+ * @param data pointer to an address of a generic data type
+ * @param count count of the new data
+ */
+static void btree_leaf_insert(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ leaf, size_t index, const void * const __restrict__ data, uint32_t count) {
+    uint32_t * const counts = btree_node_counts(tree, leaf);
+
+    memmove(btree_node_data(tree, leaf, index + 1), btree_node_data(tree, leaf, index), (leaf->size - index) * tree->data_size);
+    memmove(counts + index + 1, counts + index, (leaf->size - index) * sizeof(*counts));
+
+    memcpy(btree_node_data(tree, leaf, index), data, tree->data_size);
+    counts[index] = count;
+
+    ++(leaf->size);
+}
+
+/**
+ * @brief Function to remove one data from a leaf.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param leaf a leaf b+ tree node object
+ * @param index position of the removed data
+ */
+static void btree_leaf_remove(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ leaf, size_t index) {
+    uint32_t * const counts = btree_node_counts(tree, leaf);
+
+    --(leaf->size);
+
+    memmove(btree_node_data(tree, leaf, index), btree_node_data(tree, leaf, index + 1), (leaf->size - index) * tree->data_size);
+    memmove(counts + index, counts + index + 1, (leaf->size - index) * sizeof(*counts));
+}
+
+/**
+ * @brief Function to split a full leaf into itself and a new leaf,
+ * inserting one more data. The new leaf is linked after the old one.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param leaf a full leaf b+ tree node object
+ * @param new_leaf an empty leaf b+ tree node object
+ * @param index position of the new data in the full leaf
+ * @param data pointer to an address of a generic data type
+ */
+static void btree_split_leaf(btree_t * const __restrict__ tree, btree_node_t * const __restrict__ leaf, btree_node_t * const __restrict__ new_leaf, size_t index, const void * const __restrict__ data) {
+    size_t middle = (tree->node_capacity + 1) / 2;
+
+    /* The old leaf keeps middle data after the insertion */
+    size_t moved = (index < middle) ? (middle - 1) : middle;
+
+    memcpy(new_leaf->data, btree_node_data(tree, leaf, moved), (leaf->size - moved) * tree->data_size);
+    memcpy(btree_node_counts(tree, new_leaf), btree_node_counts(tree, leaf) + moved, (leaf->size - moved) * sizeof(uint32_t));
+
+    new_leaf->size = leaf->size - moved;
+    leaf->size = moved;
+
+    if (index < middle) {
+        btree_leaf_insert(tree, leaf, index, data, 1);
+    } else {
+        btree_leaf_insert(tree, new_leaf, index - middle, data, 1);
+    }
+
+    /* Link the new leaf after the old one */
+    new_leaf->prev = leaf;
+    new_leaf->next = leaf->next;
+
+    if (NULL != leaf->next) {
+        leaf->next->prev = new_leaf;
+    } else {
+        tree->last_leaf = new_leaf;
+    }
+
+    leaf->next = new_leaf;
+}
+
+/**
+ * @brief Function to insert a separator and the node at its right
+ * into the inner nodes of a path, splitting the full nodes. A full
+ * node is split into the scratch buffer and its middle separator is
+ * promoted to the level above. The new nodes are allocated before
+ * the call, so the tree cannot remain half split.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param path inner nodes from the root to the split node
+ * @param path_index children taken on the path
+ * @param level number of inner nodes of the path
+ * @param separator first data of the subtree of right_node
+ * @param right_node new node to link after the split node
+ * @param new_nodes allocated inner nodes, one for every split and one for a new root
+ */
+static void btree_insert_in_parent(btree_t * const __restrict__ tree, btree_node_t ** const path, const size_t * const path_index, size_t level, const uint8_t *separator, btree_node_t *right_node, btree_node_t **new_nodes) {
+    const size_t data_size = tree->data_size;
+    const size_t capacity = tree->node_capacity;
+
+    uint8_t * const scratch_data = tree->scratch;
+    uint8_t * const promoted = tree->scratch + (capacity + 1) * data_size;
+    btree_node_t ** const scratch_children = (btree_node_t **)(tree->scratch + btree_align((capacity + 2) * data_size));
+
+    for (; 0 != level; --level) {
+        btree_node_t * const parent = path[level - 1];
+        btree_node_t ** const children = btree_node_children(tree, parent);
+        size_t index = path_index[level - 1];
+
+        /* The separator fits in the parent */
+        if (parent->size < capacity) {
+            memmove(btree_node_data(tree, parent, index + 1), btree_node_data(tree, parent, index), (parent->size - index) * data_size);
+            memmove(children + index + 2, children + index + 1, (parent->size - index) * sizeof(*children));
+
+            memcpy(btree_node_data(tree, parent, index), separator, data_size);
+            children[index + 1] = right_node;
+
+            ++(parent->size);
+
+            return;
+        }
+
+        /* Put all the separators and children of the full parent into the scratch */
+        memcpy(scratch_data, parent->data, index * data_size);
+        memcpy(scratch_data + index * data_size, separator, data_size);
+        memcpy(scratch_data + (index + 1) * data_size, btree_node_data(tree, parent, index), (capacity - index) * data_size);
+
+        memcpy(scratch_children, children, (index + 1) * sizeof(*children));
+        scratch_children[index + 1] = right_node;
+        memcpy(scratch_children + index + 2, children + index + 1, (capacity - index) * sizeof(*children));
+
+        /* Split them around the middle separator */
+        size_t middle = capacity / 2;
+        btree_node_t * const new_node = *new_nodes;
+
+        memcpy(parent->data, scratch_data, middle * data_size);
+        memcpy(children, scratch_children, (middle + 1) * sizeof(*children));
+        parent->size = middle;
+
+        memcpy(new_node->data, scratch_data + (middle + 1) * data_size, (capacity - middle) * data_size);
+        memcpy(btree_node_children(tree, new_node), scratch_children + middle + 1, (capacity - middle + 1) * sizeof(*children));
+        new_node->size = capacity - middle;
+
+        /* Promote the middle separator */
+        memcpy(promoted, scratch_data + middle * data_size, data_size);
+
+        separator = promoted;
+        right_node = new_node;
+        ++new_nodes;
+    }
+
+    /* The root was split, create a new root */
+    btree_node_t * const new_root = *new_nodes;
+
+    memcpy(new_root->data, separator, data_size);
+    btree_node_children(tree, new_root)[0] = tree->root;
+    btree_node_children(tree, new_root)[1] = right_node;
+    new_root->size = 1;
+
+    tree->root = new_root;
+    ++(tree->height);
+}
+
+/**
+ * @brief Function to insert one generic data into a b+ tree.
+ * If data is already in the tree its count is incremented.
+ * Function may fail if the tree or data are not valid or not
+ * enough heap memory is left, in this case the tree is not changed.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t btree_insert(btree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if tree and data are valid */
+    if (NULL == tree) {
+        return SCL_NULL_BTREE;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    btree_node_t *path[DEFAULT_BTREE_MAX_HEIGHT];
+    size_t path_index[DEFAULT_BTREE_MAX_HEIGHT];
+
+    /* Find the leaf of the data */
+    btree_node_t * const leaf = btree_find_leaf(tree, data, path, path_index);
+
+    uint8_t found = 0;
+    size_t index = btree_search_node(tree, leaf, data, &found);
+
+    /* Data already exists increment its count */
+    if (0 != found) {
+        ++(btree_node_counts(tree, leaf)[index]);
+        return SCL_OK;
+    }
+
+    /* Data fits in the leaf */
+    if (leaf->size < tree->node_capacity) {
+        btree_leaf_insert(tree, leaf, index, data, 1);
+        ++(tree->size);
+
+        return SCL_OK;
+    }
+
+    /* Every full inner node above the leaf is split too, and the root needs a parent if all are full */
+    size_t level = tree->height - 1;
+    size_t number_of_splits = 0;
+
+    while ((number_of_splits < level) && (path[level - 1 - number_of_splits]->size == tree->node_capacity)) {
+        ++number_of_splits;
+    }
+
+    if ((number_of_splits == level) && (DEFAULT_BTREE_MAX_HEIGHT == tree->height)) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* Allocate all the nodes before changing anything */
+    btree_node_t *new_nodes[DEFAULT_BTREE_MAX_HEIGHT + 1];
+    size_t number_of_new_nodes = number_of_splits + ((number_of_splits == level) ? 1 : 0);
+
+    btree_node_t * const new_leaf = create_btree_node(tree, 1);
+    uint8_t allocated = (NULL != new_leaf);
+
+    for (size_t iter = 0; iter < number_of_new_nodes; ++iter) {
+        new_nodes[iter] = create_btree_node(tree, 0);
+        allocated &= (NULL != new_nodes[iter]);
+    }
+
+    if (0 == allocated) {
+        free(new_leaf);
+
+        for (size_t iter = 0; iter < number_of_new_nodes; ++iter) {
+            free(new_nodes[iter]);
+        }
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    /* Split the leaf and link the new one to the inner nodes */
+    btree_split_leaf(tree, leaf, new_leaf, index, data);
+    btree_insert_in_parent(tree, path, path_index, level, new_leaf->data, new_leaf, new_nodes);
+
+    ++(tree->size);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search data in b+ tree in O(log N).
+ * The returned pointer is valid until the next insertion
+ * or deletion, because the data is moved inside the nodes.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param data pointer to an address of a generic data type
+ * @return const void* pointer to location of data found in
+ * the tree or `NULL` if data was not found
+ */
+const void* btree_find_data(const btree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == data)) {
+        return NULL;
+    }
+
+    btree_node_t * const leaf = btree_find_leaf(tree, data, NULL, NULL);
+
+    uint8_t found = 0;
+    size_t index = btree_search_node(tree, leaf, data, &found);
+
+    return (0 != found) ? btree_node_data(tree, leaf, index) : NULL;
+}
+
+/**
+ * @brief Function to remove one separator and the child
+ * at its right from an inner node.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param node an inner b+ tree node object
+ * @param index position of the separator
+ */
+static void btree_inner_remove(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ node, size_t index) {
+    btree_node_t ** const children = btree_node_children(tree, node);
+
+    --(node->size);
+
+    memmove(btree_node_data(tree, node, index), btree_node_data(tree, node, index + 1), (node->size - index) * tree->data_size);
+    memmove(children + index + 1, children + index + 2, (node->size - index) * sizeof(*children));
+}
+
+/**
+ * @brief Function to fix a leaf with less than half of the
+ * capacity, by taking one data from a sibling or by merging
+ * it with a sibling. Separators stay equal to the first data
+ * of the subtrees at their right.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param parent parent of the leaf
+ * @param index position of the leaf in its parent
+ */
+static void btree_fix_leaf(btree_t * const __restrict__ tree, btree_node_t * const __restrict__ parent, size_t index) {
+    btree_node_t ** const children = btree_node_children(tree, parent);
+    btree_node_t * const leaf = children[index];
+    btree_node_t * const left = (0 != index) ? children[index - 1] : NULL;
+    btree_node_t * const right = (index < parent->size) ? children[index + 1] : NULL;
+    const size_t min_size = tree->node_capacity / 2;
+
+    if ((NULL != left) && (left->size > min_size)) {
+
+        /* Take the last data of the left sibling */
+        btree_leaf_insert(tree, leaf, 0, btree_node_data(tree, left, left->size - 1), btree_node_counts(tree, left)[left->size - 1]);
+        --(left->size);
+
+        memcpy(btree_node_data(tree, parent, index - 1), leaf->data, tree->data_size);
+    } else if ((NULL != right) && (right->size > min_size)) {
+
+        /* Take the first data of the right sibling */
+        btree_leaf_insert(tree, leaf, leaf->size, right->data, btree_node_counts(tree, right)[0]);
+        btree_leaf_remove(tree, right, 0);
+
+        memcpy(btree_node_data(tree, parent, index), right->data, tree->data_size);
+    } else {
+
+        /* Merge the leaf with one sibling, the right one goes into the left one */
+        btree_node_t * const merge_left = (NULL != left) ? left : leaf;
+        btree_node_t * const merge_right = (NULL != left) ? leaf : right;
+
+        memcpy(btree_node_data(tree, merge_left, merge_left->size), merge_right->data, merge_right->size * tree->data_size);
+        memcpy(btree_node_counts(tree, merge_left) + merge_left->size, btree_node_counts(tree, merge_right), merge_right->size * sizeof(uint32_t));
+        merge_left->size += merge_right->size;
+
+        /* Unlink the right leaf */
+        merge_left->next = merge_right->next;
+
+        if (NULL != merge_right->next) {
+            merge_right->next->prev = merge_left;
+        } else {
+            tree->last_leaf = merge_left;
+        }
+
+        btree_inner_remove(tree, parent, (NULL != left) ? (index - 1) : index);
+        free(merge_right);
+    }
+}
+
+/**
+ * @brief Function to fix an inner node with less than half of
+ * the capacity, by rotating one separator from a sibling through
+ * the parent or by merging it with a sibling and the separator
+ * between them.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param parent parent of the inner node
+ * @param index position of the inner node in its parent
+ */
+static void btree_fix_inner(const btree_t * const __restrict__ tree, btree_node_t * const __restrict__ parent, size_t index) {
+    btree_node_t ** const children = btree_node_children(tree, parent);
+    btree_node_t * const node = children[index];
+    btree_node_t * const left = (0 != index) ? children[index - 1] : NULL;
+    btree_node_t * const right = (index < parent->size) ? children[index + 1] : NULL;
+    btree_node_t ** const node_children = btree_node_children(tree, node);
+    const size_t data_size = tree->data_size;
+    const size_t min_size = tree->node_capacity / 2;
+
+    if ((NULL != left) && (left->size > min_size)) {
+
+        /* Rotate the last child of the left sibling */
+        memmove(btree_node_data(tree, node, 1), node->data, node->size * data_size);
+        memmove(node_children + 1, node_children, (node->size + 1) * sizeof(*node_children));
+
+        memcpy(node->data, btree_node_data(tree, parent, index - 1), data_size);
+        node_children[0] = btree_node_children(tree, left)[left->size];
+
+        memcpy(btree_node_data(tree, parent, index - 1), btree_node_data(tree, left, left->size - 1), data_size);
+
+        --(left->size);
+        ++(node->size);
+    } else if ((NULL != right) && (right->size > min_size)) {
+        btree_node_t ** const right_children = btree_node_children(tree, right);
+
+        /* Rotate the first child of the right sibling */
+        memcpy(btree_node_data(tree, node, node->size), btree_node_data(tree, parent, index), data_size);
+        node_children[node->size + 1] = right_children[0];
+
+        memcpy(btree_node_data(tree, parent, index), right->data, data_size);
+
+        --(right->size);
+        memmove(right->data, btree_node_data(tree, right, 1), right->size * data_size);
+        memmove(right_children, right_children + 1, (right->size + 1) * sizeof(*right_children));
+
+        ++(node->size);
+    } else {
+
+        /* Merge the node with one sibling and the separator between them */
+        size_t separator_index = (NULL != left) ? (index - 1) : index;
+        btree_node_t * const merge_left = (NULL != left) ? left : node;
+        btree_node_t * const merge_right = (NULL != left) ? node : right;
+
+        memcpy(btree_node_data(tree, merge_left, merge_left->size), btree_node_data(tree, parent, separator_index), data_size);
+        memcpy(btree_node_data(tree, merge_left, merge_left->size + 1), merge_right->data, merge_right->size * data_size);
+        memcpy(btree_node_children(tree, merge_left) + merge_left->size + 1, btree_node_children(tree, merge_right), (merge_right->size + 1) * sizeof(btree_node_t *));
+        merge_left->size += merge_right->size + 1;
+
+        btree_inner_remove(tree, parent, separator_index);
+        free(merge_right);
+    }
+}
+
+/**
+ * @brief Function to delete one generic data from a b+ tree,
+ * whatever its count is. The nodes with less than half of the
+ * capacity are fixed from the leaf up to the root. Function may
+ * fail if input data is not valid or if data is not in the tree.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t btree_delete(btree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BTREE;
+    }
+
+    if (0 == tree->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    btree_node_t *path[DEFAULT_BTREE_MAX_HEIGHT];
+    size_t path_index[DEFAULT_BTREE_MAX_HEIGHT];
+
+    /* Find the leaf of the data */
+    btree_node_t * const leaf = btree_find_leaf(tree, data, path, path_index);
+
+    uint8_t found = 0;
+    size_t index = btree_search_node(tree, leaf, data, &found);
+
+    if (0 == found) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Free content of the data and remove it */
+    if (NULL != tree->frd) {
+        tree->frd(btree_node_data(tree, leaf, index));
+    }
+
+    btree_leaf_remove(tree, leaf, index);
+    --(tree->size);
+
+    size_t level = tree->height - 1;
+
+    /* The separator equal to the removed data becomes the new first data of the leaf */
+    if ((0 == index) && (0 != leaf->size)) {
+        for (size_t iter = level; 0 != iter; --iter) {
+            if (0 != path_index[iter - 1]) {
+                memcpy(btree_node_data(tree, path[iter - 1], path_index[iter - 1] - 1), leaf->data, tree->data_size);
+                break;
+            }
+        }
+    }
+
+    /* Fix the nodes with less than half of the capacity */
+    if ((0 != level) && (leaf->size < tree->node_capacity / 2)) {
+        btree_fix_leaf(tree, path[level - 1], path_index[level - 1]);
+
+        for (--level; (0 != level) && (path[level]->size < tree->node_capacity / 2); --level) {
+            btree_fix_inner(tree, path[level - 1], path_index[level - 1]);
+        }
+    }
+
+    /* An empty inner root is replaced by its only child */
+    if ((0 == tree->root->is_leaf) && (0 == tree->root->size)) {
+        btree_node_t * const old_root = tree->root;
+
+        tree->root = btree_node_children(tree, old_root)[0];
+        --(tree->height);
+
+        free(old_root);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if a b+ tree object
+ * is empty or not.
+ * 
+ * @param tree an allocated b+ tree object
+ * @return uint8_t 1 if tree is empty or not allocated, 0 otherwise
+ */
+uint8_t is_btree_empty(const btree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (0 == tree->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Function to get the number of distinct data of the b+ tree.
+ * 
+ * @param tree an allocated b+ tree object
+ * @return size_t size of the b+ tree or `SIZE_MAX` if tree is not allocated
+ */
+size_t get_btree_size(const btree_t * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->size;
+}
+
+/**
+ * @brief Function to get the number of levels of the b+ tree,
+ * every search reads one node from every level.
+ * 
+ * @param tree an allocated b+ tree object
+ * @return size_t height of the b+ tree or `SIZE_MAX` if tree is not allocated
+ */
+size_t get_btree_height(const btree_t * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->height;
+}
+
+/**
+ * @brief Function to get the minimum data of the b+ tree in O(1).
+ * 
+ * @param tree an allocated b+ tree object
+ * @return const void* pointer to minimum data or `NULL` if tree is empty
+ */
+const void* btree_min_data(const btree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (0 == tree->size)) {
+        return NULL;
+    }
+
+    return tree->first_leaf->data;
+}
+
+/**
+ * @brief Function to get the maximum data of the b+ tree in O(1).
+ * 
+ * @param tree an allocated b+ tree object
+ * @return const void* pointer to maximum data or `NULL` if tree is empty
+ */
+const void* btree_max_data(const btree_t * const __restrict__ tree) {
+    if ((NULL == tree) || (0 == tree->size)) {
+        return NULL;
+    }
+
+    return btree_node_data(tree, tree->last_leaf, tree->last_leaf->size - 1);
+}
+
+/**
+ * @brief Function that will traverse all data in sorted order
+ * walking the linked leaves and will perform any action according
+ * to "action" function. The action MUST NOT change the order of
+ * the data.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param action a pointer to a function that will perform an action
+ * on every data from current working tree
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t btree_traverse_inorder(const btree_t * const __restrict__ tree, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BTREE;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    if (0 == tree->size) {
+
+        /* Tree is empty no data to traverse */
+        printf("(Null)\n");
+    } else {
+
+        /* Walk all the leaves */
+        for (btree_node_t *leaf = tree->first_leaf; NULL != leaf; leaf = leaf->next) {
+            for (size_t iter = 0; iter < leaf->size; ++iter) {
+                action(btree_node_data(tree, leaf, iter));
+            }
+        }
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to traverse in sorted order just the data
+ * from the range [lo, hi] and to perform an action on them.
+ * The leaf of lo is searched once and then the function walks
+ * the linked leaves, so it runs in O(log N + K) where K is the
+ * number of data from the range. The action MUST NOT change
+ * the order of the data.
+ * 
+ * @param tree an allocated b+ tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @param action a pointer to a function that will perform an action
+ * on every data from the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t btree_range_traverse(const btree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_BTREE;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    btree_node_t *leaf = btree_find_leaf(tree, lo, NULL, NULL);
+
+    uint8_t found = 0;
+    size_t index = btree_search_node(tree, leaf, lo, &found);
+
+    /* Walk from the first data of the range until the data is greater than hi */
+    for (; NULL != leaf; leaf = leaf->next, index = 0) {
+        for (; index < leaf->size; ++index) {
+            uint8_t * const data = btree_node_data(tree, leaf, index);
+
+            if (tree->cmp(data, hi) >= 1) {
+                return SCL_OK;
+            }
+
+            action(data);
+        }
+    }
+
+    return SCL_OK;
+}
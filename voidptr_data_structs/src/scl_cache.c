@@ -0,0 +1,760 @@
+/**
+ * @file scl_cache.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_cache.h"
+
+#define DEFAULT_CACHE_CAPACITY 16
+#define DEFAULT_CACHE_MAX_ALIGN 16
+
+#define CACHE_NO_ENTRY SIZE_MAX
+
+/**
+ * @brief Function to compute the alignment of a data type knowing
+ * just its length in bytes. The alignment of any data type divides its
+ * length, so the lowest set bit of the length is a safe alignment.
+ *
+ * @param type_size length in bytes of the data type
+ * @return size_t alignment in bytes of the data type
+ */
+static size_t cache_type_align(size_t type_size) {
+    /* Isolate the lowest set bit of the length */
+    size_t type_align = type_size & (~type_size + 1);
+
+    /* No fundamental data type needs a greater alignment */
+    if (DEFAULT_CACHE_MAX_ALIGN < type_align) {
+        type_align = DEFAULT_CACHE_MAX_ALIGN;
+    }
+
+    return type_align;
+}
+
+/**
+ * @brief Function to mix all the bits of a hash value (fmix64 finalizer of
+ * MurmurHash3), the buckets are selected with a mask of the low bits.
+ *
+ * @param hash hash value of one key computed with hash function of the cache
+ * @return size_t mixed hash value
+ */
+static size_t cache_mix_hash(size_t hash) {
+    uint64_t mixed_hash = (uint64_t)hash;
+
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xff51afd7ed558ccdULL;
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+    mixed_hash ^= mixed_hash >> 33;
+
+    return (size_t)mixed_hash;
+}
+
+/**
+ * @brief Function to get the location of the key stored
+ * inline for one entry.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param entry index of the entry
+ * @return void* pointer to the key of the selected entry
+ */
+static void* cache_key(const cache_t * const __restrict__ cache, size_t entry) {
+    return cache->pairs + entry * cache->pair_size;
+}
+
+/**
+ * @brief Function to get the location of the data stored
+ * inline for one entry.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param entry index of the entry
+ * @return void* pointer to the data of the selected entry
+ */
+static void* cache_data(const cache_t * const __restrict__ cache, size_t entry) {
+    return cache->pairs + entry * cache->pair_size + cache->data_offset;
+}
+
+/**
+ * @brief Create a cache object. At least one of the bounds must be set,
+ * when a new pair does not fit into the bounds the cache evicts pairs
+ * selected by the eviction policy. Allocation may fail if there is not
+ * enough memory on heap or the functions are not valid.
+ *
+ * @param max_entries maximum number of pairs (0 for no limit)
+ * @param max_bytes maximum number of bytes charged for the pairs (0 for no limit)
+ * @param policy eviction policy of the cache
+ * @param hash pointer to a function to hash the key into a size_t type
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return cache_t* a new allocated cache object or `NULL` (if function fails)
+ */
+cache_t* create_cache(size_t max_entries, size_t max_bytes, cache_policy_t policy, hash_func hash, compare_func cmp_key, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == hash) || (NULL == cmp_key)) {
+        errno = EINVAL;
+        perror("Compare or hash functions undefined in cache");
+        return NULL;
+    }
+
+    /* Check if data and key sizes are valid */
+    if ((0 == key_size) || (0 == data_size)) {
+        errno = EINVAL;
+        perror("Key or data size are zero");
+        return NULL;
+    }
+
+    /* Check if the cache is bounded and the policy is known */
+    if (((0 == max_entries) && (0 == max_bytes)) || ((CACHE_POLICY_LRU != policy) && (CACHE_POLICY_CLOCK != policy))) {
+        errno = EINVAL;
+        perror("Cache has no bounds or unknown eviction policy");
+        return NULL;
+    }
+
+    /* Allocate a new cache object on heap */
+    cache_t *new_cache = malloc(sizeof(*new_cache));
+
+    /* Check if cache was allocated successfully */
+    if (NULL == new_cache) {
+        errno = ENOMEM;
+        perror("Not enough memory for cache allocation");
+
+        return NULL;
+    }
+
+    /* Set function pointers of the cache */
+    new_cache->hash = hash;
+    new_cache->cmp_key = cmp_key;
+    new_cache->frd_key = frd_key;
+    new_cache->frd_dt = frd_dt;
+
+    /* Compute the layout of one inline {key, data} pair */
+    size_t key_align = cache_type_align(key_size);
+    size_t data_align = cache_type_align(data_size);
+    size_t pair_align = (key_align > data_align) ? key_align : data_align;
+
+    new_cache->key_size = key_size;
+    new_cache->data_size = data_size;
+    new_cache->data_offset = (key_size + data_align - 1) & ~(data_align - 1);
+    new_cache->pair_size = (new_cache->data_offset + data_size + pair_align - 1) & ~(pair_align - 1);
+
+    /* Set the bounds and the default values of the cache */
+    new_cache->policy = policy;
+    new_cache->max_entries = max_entries;
+    new_cache->max_bytes = max_bytes;
+    new_cache->capacity = 0;
+    new_cache->number_of_buckets = 0;
+    new_cache->size = 0;
+    new_cache->bytes = 0;
+    new_cache->head = CACHE_NO_ENTRY;
+    new_cache->free_entry = CACHE_NO_ENTRY;
+    new_cache->entries = NULL;
+    new_cache->pairs = NULL;
+    new_cache->buckets = NULL;
+
+    /* Reset the counters */
+    new_cache->stats.hits = 0;
+    new_cache->stats.misses = 0;
+    new_cache->stats.evictions = 0;
+
+    /* Return a new allocated cache, entries are allocated by the first insertion */
+    return new_cache;
+}
+
+/**
+ * @brief Function to delete all memory allocated for one cache. The
+ * content of every pair is freed with frd_key and frd_dt functions.
+ * Function will not automatically move cache pointer to `NULL`.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_cache(cache_t * const __restrict__ cache) {
+    /* Check if cache is allocated */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Free the content of every pair from the recency ring */
+    size_t entry = cache->head;
+
+    for (size_t iter = 0; iter < cache->size; ++iter) {
+        if (NULL != cache->frd_dt) {
+            cache->frd_dt(cache_data(cache, entry));
+        }
+
+        if (NULL != cache->frd_key) {
+            cache->frd_key(cache_key(cache, entry));
+        }
+
+        entry = cache->entries[entry].next;
+    }
+
+    /* Free the arrays of the cache */
+    free(cache->entries);
+    free(cache->pairs);
+    free(cache->buckets);
+
+    /* Free memory of the cache */
+    free(cache);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search the entry of one key.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @param hash mixed hash value of the key
+ * @return size_t index of the entry or CACHE_NO_ENTRY if key is not in the cache
+ */
+static size_t cache_find_entry(const cache_t * const __restrict__ cache, const void * const __restrict__ key, size_t hash) {
+    /* Entries are allocated by the first insertion */
+    if (NULL == cache->buckets) {
+        return CACHE_NO_ENTRY;
+    }
+
+    size_t entry = cache->buckets[hash & (cache->number_of_buckets - 1)];
+
+    /* Compare the keys just for entries having the same hash */
+    while (CACHE_NO_ENTRY != entry) {
+        if ((hash == cache->entries[entry].hash) && (0 == cache->cmp_key(cache_key(cache, entry), key))) {
+            return entry;
+        }
+
+        entry = cache->entries[entry].bucket_next;
+    }
+
+    return CACHE_NO_ENTRY;
+}
+
+/**
+ * @brief Function to link one entry into the recency ring just
+ * before the head, so it is the last entry reached from the head.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param entry index of the entry to link
+ */
+static void cache_ring_link(cache_t * const __restrict__ cache, size_t entry) {
+    /* First entry of the ring is linked to itself */
+    if (CACHE_NO_ENTRY == cache->head) {
+        cache->entries[entry].prev = cache->entries[entry].next = entry;
+        cache->head = entry;
+
+        return;
+    }
+
+    size_t tail = cache->entries[cache->head].prev;
+
+    cache->entries[entry].prev = tail;
+    cache->entries[entry].next = cache->head;
+    cache->entries[tail].next = entry;
+    cache->entries[cache->head].prev = entry;
+}
+
+/**
+ * @brief Function to unlink one entry from the recency ring. If
+ * the entry is the head, the next entry becomes the head.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param entry index of the entry to unlink
+ */
+static void cache_ring_unlink(cache_t * const __restrict__ cache, size_t entry) {
+    /* Last entry of the ring */
+    if (cache->entries[entry].next == entry) {
+        cache->head = CACHE_NO_ENTRY;
+
+        return;
+    }
+
+    size_t prev_entry = cache->entries[entry].prev;
+    size_t next_entry = cache->entries[entry].next;
+
+    cache->entries[prev_entry].next = next_entry;
+    cache->entries[next_entry].prev = prev_entry;
+
+    if (cache->head == entry) {
+        cache->head = next_entry;
+    }
+}
+
+/**
+ * @brief Function to mark one entry as used. An LRU cache moves the entry
+ * to the head of the recency ring, a CLOCK cache just sets its reference bit.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param entry index of the used entry
+ */
+static void cache_use_entry(cache_t * const __restrict__ cache, size_t entry) {
+    if (CACHE_POLICY_CLOCK == cache->policy) {
+        cache->entries[entry].referenced = 1;
+    } else if (cache->head != entry) {
+        cache_ring_unlink(cache, entry);
+        cache_ring_link(cache, entry);
+        cache->head = entry;
+    }
+}
+
+/**
+ * @brief Function to remove one entry from the cache. The content of the
+ * pair is freed and the entry is moved into the list of free entries.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param entry index of the entry to remove
+ */
+static void cache_remove_entry(cache_t * const __restrict__ cache, size_t entry) {
+    /* Unlink the entry from its bucket */
+    size_t *link = &cache->buckets[cache->entries[entry].hash & (cache->number_of_buckets - 1)];
+
+    while (entry != *link) {
+        link = &cache->entries[*link].bucket_next;
+    }
+
+    *link = cache->entries[entry].bucket_next;
+
+    /* Unlink the entry from the recency ring */
+    cache_ring_unlink(cache, entry);
+
+    /* Free the content of the pair */
+    if (NULL != cache->frd_dt) {
+        cache->frd_dt(cache_data(cache, entry));
+    }
+
+    if (NULL != cache->frd_key) {
+        cache->frd_key(cache_key(cache, entry));
+    }
+
+    /* Move the entry into the free list */
+    cache->entries[entry].bucket_next = cache->free_entry;
+    cache->free_entry = entry;
+
+    --(cache->size);
+    cache->bytes -= cache->entries[entry].cost;
+}
+
+/**
+ * @brief Function to evict one pair selected by the eviction policy. An LRU
+ * cache evicts the entry before the head (least recently used), a CLOCK cache
+ * moves the hand over the used entries, clearing their bits, and evicts the
+ * first entry not used since the hand passed it. The kept entry is never evicted.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param kept_entry index of an entry that must not be evicted (or CACHE_NO_ENTRY)
+ */
+static void cache_evict(cache_t * const __restrict__ cache, size_t kept_entry) {
+    size_t victim = cache->entries[cache->head].prev;
+
+    if (CACHE_POLICY_CLOCK == cache->policy) {
+        while ((kept_entry == cache->head) || (0 != cache->entries[cache->head].referenced)) {
+            cache->entries[cache->head].referenced = 0;
+            cache->head = cache->entries[cache->head].next;
+        }
+
+        victim = cache->head;
+    }
+
+    cache_remove_entry(cache, victim);
+    ++(cache->stats.evictions);
+}
+
+/**
+ * @brief Function to double the number of entries of the cache (but not over
+ * the maximum number of pairs). The new entries are added into the free list
+ * and the hash index is rebuilt from the stored hashes if it becomes too small.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t cache_grow(cache_t * const __restrict__ cache) {
+    size_t new_capacity = (0 == cache->capacity) ? DEFAULT_CACHE_CAPACITY : cache->capacity * 2;
+
+    if ((0 != cache->max_entries) && (cache->max_entries < new_capacity)) {
+        new_capacity = cache->max_entries;
+    }
+
+    /* Reallocate the entries arrays, the links are indices so they stay valid */
+    cache_entry_t *new_entries = realloc(cache->entries, sizeof(*new_entries) * new_capacity);
+
+    if (NULL == new_entries) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    cache->entries = new_entries;
+
+    uint8_t *new_pairs = realloc(cache->pairs, cache->pair_size * new_capacity);
+
+    if (NULL == new_pairs) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    cache->pairs = new_pairs;
+
+    /* Keep at most one entry for every bucket */
+    if (new_capacity > cache->number_of_buckets) {
+        size_t new_number_of_buckets = (0 == cache->number_of_buckets) ? DEFAULT_CACHE_CAPACITY : cache->number_of_buckets;
+
+        while (new_number_of_buckets < new_capacity) {
+            new_number_of_buckets <<= 1;
+        }
+
+        size_t *new_buckets = malloc(sizeof(*new_buckets) * new_number_of_buckets);
+
+        if (NULL == new_buckets) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        for (size_t iter = 0; iter < new_number_of_buckets; ++iter) {
+            new_buckets[iter] = CACHE_NO_ENTRY;
+        }
+
+        /* Relink every stored entry into its new bucket */
+        size_t entry = cache->head;
+
+        for (size_t iter = 0; iter < cache->size; ++iter) {
+            size_t bucket_index = cache->entries[entry].hash & (new_number_of_buckets - 1);
+
+            cache->entries[entry].bucket_next = new_buckets[bucket_index];
+            new_buckets[bucket_index] = entry;
+
+            entry = cache->entries[entry].next;
+        }
+
+        free(cache->buckets);
+        cache->buckets = new_buckets;
+        cache->number_of_buckets = new_number_of_buckets;
+    }
+
+    /* Add the new entries into the free list */
+    for (size_t iter = new_capacity; iter > cache->capacity; --iter) {
+        cache->entries[iter - 1].bucket_next = cache->free_entry;
+        cache->free_entry = iter - 1;
+    }
+
+    cache->capacity = new_capacity;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert one pair {key, data} into the cache charging a
+ * number of bytes for it, use it if the pair owns memory that should be
+ * counted by the byte bound (for example the length of a string). If the key
+ * is already in the cache its data is replaced and the pair is marked as used.
+ * Pairs are evicted until the new pair fits into the bounds of the cache.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @param data pointer to a location of a value representing data of the pair
+ * @param cost number of bytes charged for the pair
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_put_with_cost(cache_t * const __restrict__ cache, const void * const key, const void * const data, size_t cost) {
+    /* Check if cache is allocated */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data type pointer is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Pair can never fit into the cache */
+    if ((0 != cache->max_bytes) && (cost > cache->max_bytes)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    size_t hash = cache_mix_hash(cache->hash(key));
+    size_t entry = cache_find_entry(cache, key, hash);
+
+    if (CACHE_NO_ENTRY != entry) {
+
+        /* Replace the data of the key */
+        if (NULL != cache->frd_dt) {
+            cache->frd_dt(cache_data(cache, entry));
+        }
+
+        memcpy(cache_data(cache, entry), data, cache->data_size);
+
+        cache->bytes = cache->bytes - cache->entries[entry].cost + cost;
+        cache->entries[entry].cost = cost;
+
+        cache_use_entry(cache, entry);
+
+        /* Make room for the new cost of the pair */
+        while ((0 != cache->max_bytes) && (cache->bytes > cache->max_bytes)) {
+            cache_evict(cache, entry);
+        }
+
+        return SCL_OK;
+    }
+
+    /* Make room for the new pair */
+    while ((0 != cache->size) && (((0 != cache->max_entries) && (cache->size >= cache->max_entries)) || ((0 != cache->max_bytes) && (cache->bytes + cost > cache->max_bytes)))) {
+        cache_evict(cache, CACHE_NO_ENTRY);
+    }
+
+    /* Allocate more entries */
+    if (CACHE_NO_ENTRY == cache->free_entry) {
+        scl_error_t err = cache_grow(cache);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* Take one free entry */
+    entry = cache->free_entry;
+    cache->free_entry = cache->entries[entry].bucket_next;
+
+    /* Copy the pair */
+    memcpy(cache_key(cache, entry), key, cache->key_size);
+    memcpy(cache_data(cache, entry), data, cache->data_size);
+
+    cache->entries[entry].hash = hash;
+    cache->entries[entry].cost = cost;
+    cache->entries[entry].referenced = 0;
+
+    /* Link the entry into its bucket */
+    size_t bucket_index = hash & (cache->number_of_buckets - 1);
+
+    cache->entries[entry].bucket_next = cache->buckets[bucket_index];
+    cache->buckets[bucket_index] = entry;
+
+    /*
+     * Link the entry into the recency ring, a new entry is the most
+     * recently used one for LRU and is placed just behind the clock hand
+     */
+    cache_ring_link(cache, entry);
+
+    if (CACHE_POLICY_LRU == cache->policy) {
+        cache->head = entry;
+    }
+
+    ++(cache->size);
+    cache->bytes += cost;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert one pair {key, data} into the cache. The pair
+ * is charged with the length of the key and of the data types.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @param data pointer to a location of a value representing data of the pair
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_put(cache_t * const __restrict__ cache, const void * const key, const void * const data) {
+    /* Check if cache is allocated */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    return cache_put_with_cost(cache, key, data, cache->key_size + cache->data_size);
+}
+
+/**
+ * @brief Function to get the data of one key and to mark the pair as used.
+ * The hit and miss counters are updated. The returned pointer is valid just
+ * until the next insertion or deletion.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @return const void* pointer to the data of the key or `NULL` if key is not in the cache
+ */
+const void* cache_get(cache_t * const __restrict__ cache, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == cache) || (NULL == key)) {
+        return NULL;
+    }
+
+    size_t entry = cache_find_entry(cache, key, cache_mix_hash(cache->hash(key)));
+
+    if (CACHE_NO_ENTRY == entry) {
+        ++(cache->stats.misses);
+        return NULL;
+    }
+
+    ++(cache->stats.hits);
+    cache_use_entry(cache, entry);
+
+    return cache_data(cache, entry);
+}
+
+/**
+ * @brief Function to get the data of one key without marking the pair
+ * as used and without updating the counters.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @return const void* pointer to the data of the key or `NULL` if key is not in the cache
+ */
+const void* cache_peek(const cache_t * const __restrict__ cache, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == cache) || (NULL == key)) {
+        return NULL;
+    }
+
+    size_t entry = cache_find_entry(cache, key, cache_mix_hash(cache->hash(key)));
+
+    if (CACHE_NO_ENTRY == entry) {
+        return NULL;
+    }
+
+    return cache_data(cache, entry);
+}
+
+/**
+ * @brief Function to mark the pair of one key as used without getting
+ * its data and without updating the counters.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @return uint8_t 1 if key is in the cache, 0 otherwise
+ */
+uint8_t cache_touch(cache_t * const __restrict__ cache, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == cache) || (NULL == key)) {
+        return 0;
+    }
+
+    size_t entry = cache_find_entry(cache, key, cache_mix_hash(cache->hash(key)));
+
+    if (CACHE_NO_ENTRY == entry) {
+        return 0;
+    }
+
+    cache_use_entry(cache, entry);
+
+    return 1;
+}
+
+/**
+ * @brief Function to check if a cache object is empty or not.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @return uint8_t 1 if cache is empty or not allocated, 0 otherwise
+ */
+uint8_t is_cache_empty(const cache_t * const __restrict__ cache) {
+    if ((NULL == cache) || (0 == cache->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Function to get the number of pairs of the cache.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @return size_t number of pairs or `SIZE_MAX` if cache is not allocated
+ */
+size_t get_cache_size(const cache_t * const __restrict__ cache) {
+    if (NULL == cache) {
+        return SIZE_MAX;
+    }
+
+    return cache->size;
+}
+
+/**
+ * @brief Function to get the number of bytes charged for
+ * all the pairs of the cache.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @return size_t number of bytes or `SIZE_MAX` if cache is not allocated
+ */
+size_t get_cache_bytes(const cache_t * const __restrict__ cache) {
+    if (NULL == cache) {
+        return SIZE_MAX;
+    }
+
+    return cache->bytes;
+}
+
+/**
+ * @brief Function to get the hit, miss and eviction counters of the cache.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param stats pointer to a location to write the counters
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_get_stats(const cache_t * const __restrict__ cache, cache_stats_t * const __restrict__ stats) {
+    /* Check if cache is allocated */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Check if stats location is valid */
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    *stats = cache->stats;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete the pair of one key from the cache,
+ * the content of the pair is freed. Deletions are not counted
+ * as evictions.
+ *
+ * @param cache pointer to an allocated cache memory location
+ * @param key pointer to a location of a value representing key of the cache
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t cache_delete_key(cache_t * const __restrict__ cache, const void * const __restrict__ key) {
+    /* Check if cache is allocated */
+    if (NULL == cache) {
+        return SCL_NULL_CACHE;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    size_t entry = cache_find_entry(cache, key, cache_mix_hash(cache->hash(key)));
+
+    if (CACHE_NO_ENTRY == entry) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    cache_remove_entry(cache, entry);
+
+    /* All good */
+    return SCL_OK;
+}
@@ -0,0 +1,917 @@
+/**
+ * @file scl_concurrent_hash_table.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_concurrent_hash_table.h"
+
+#include <sched.h>
+
+#define DEFAULT_CONCURRENT_HASH_CAPACITY 64
+#define DEFAULT_CONCURRENT_HASH_RETIRE_BATCH 128
+#define DEFAULT_CONCURRENT_HASH_MAX_ALIGN 16
+
+/**
+ * @brief Counter used to give every thread its own readers shard
+ *
+ */
+static atomic_size_t concurrent_hash_table_next_shard = 0;
+
+/**
+ * @brief Readers shard of the calling thread (SIZE_MAX if not selected yet)
+ *
+ */
+static _Thread_local size_t concurrent_hash_table_thread_shard = SIZE_MAX;
+
+/**
+ * @brief Function to mix all the bits of a hash value (fmix64 finalizer of
+ * MurmurHash3), so the buckets and the stripes selected by a mask depend
+ * on the whole hash.
+ *
+ * @param hash hash value of one key computed with hash function of the table
+ * @return size_t mixed hash value
+ */
+static size_t concurrent_hash_table_mix_hash(size_t hash) {
+    uint64_t mixed_hash = (uint64_t)hash;
+
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xff51afd7ed558ccdULL;
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+    mixed_hash ^= mixed_hash >> 33;
+
+    return (size_t)mixed_hash;
+}
+
+/**
+ * @brief Function to get the readers shard of the calling thread. Every
+ * thread gets a shard the first time it reads, so readers from different
+ * threads do not write on the same cache line.
+ *
+ * @return size_t index of the readers shard
+ */
+static size_t concurrent_hash_table_shard(void) {
+    if (SIZE_MAX == concurrent_hash_table_thread_shard) {
+        concurrent_hash_table_thread_shard = atomic_fetch_add(&concurrent_hash_table_next_shard, 1) % CONCURRENT_HASH_TABLE_READER_SHARDS;
+    }
+
+    return concurrent_hash_table_thread_shard;
+}
+
+/**
+ * @brief Function to enter a read section. The reader is counted on the
+ * parity of the current epoch, memory retired before the next epoch change
+ * is not freed until the reader leaves the read section.
+ *
+ * The lookups take a const table, the readers counters are the only
+ * memory they change and the table is always allocated on heap, so the
+ * counters are reached through a non-const pointer.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param shard readers shard of the calling thread
+ * @return size_t parity of the epoch the reader is counted on
+ */
+static size_t concurrent_hash_table_read_lock(const concurrent_hash_table_t * const __restrict__ cht, size_t shard) {
+    concurrent_hash_table_readers_t (* const readers)[CONCURRENT_HASH_TABLE_READER_SHARDS] = (concurrent_hash_table_readers_t (*)[CONCURRENT_HASH_TABLE_READER_SHARDS])cht->readers;
+
+    for (;;) {
+        size_t epoch = atomic_load(&cht->epoch);
+
+        atomic_fetch_add(&readers[epoch & 1][shard].count, 1);
+
+        /* The epoch did not change, writers will wait for this reader */
+        if (atomic_load(&cht->epoch) == epoch) {
+            return epoch & 1;
+        }
+
+        /* Epoch changed meanwhile, register again on the new parity */
+        atomic_fetch_sub(&readers[epoch & 1][shard].count, 1);
+    }
+}
+
+/**
+ * @brief Function to leave a read section.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param shard readers shard of the calling thread
+ * @param parity parity of the epoch the reader is counted on
+ */
+static void concurrent_hash_table_read_unlock(const concurrent_hash_table_t * const __restrict__ cht, size_t shard, size_t parity) {
+    concurrent_hash_table_readers_t (* const readers)[CONCURRENT_HASH_TABLE_READER_SHARDS] = (concurrent_hash_table_readers_t (*)[CONCURRENT_HASH_TABLE_READER_SHARDS])cht->readers;
+
+    atomic_fetch_sub_explicit(&readers[parity][shard].count, 1, memory_order_release);
+}
+
+/**
+ * @brief Function to wait until every reader that entered a read section
+ * before the call leaves it. Memory unlinked before the call can be freed
+ * after the function returns.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ */
+static void concurrent_hash_table_synchronize(concurrent_hash_table_t * const __restrict__ cht) {
+    pthread_mutex_lock(&cht->reclaim_lock);
+
+    /* New readers are counted on the other parity */
+    size_t parity = atomic_fetch_add(&cht->epoch, 1) & 1;
+
+    /* Wait for the readers of the old parity */
+    for (size_t shard = 0; shard < CONCURRENT_HASH_TABLE_READER_SHARDS; ++shard) {
+        while (0 != atomic_load(&cht->readers[parity][shard].count)) {
+            sched_yield();
+        }
+    }
+
+    pthread_mutex_unlock(&cht->reclaim_lock);
+}
+
+/**
+ * @brief Function to get the alignment of a data type from its length,
+ * that is the greatest power of two dividing the length, but not greater
+ * than the alignment of any fundamental data type.
+ *
+ * @param type_size length in bytes of the data type
+ * @return size_t alignment in bytes of the data type
+ */
+static size_t concurrent_hash_table_type_align(size_t type_size) {
+    /* Isolate the lowest set bit of the length */
+    size_t type_align = type_size & (~type_size + 1);
+
+    /* No fundamental data type needs a greater alignment */
+    if (DEFAULT_CONCURRENT_HASH_MAX_ALIGN < type_align) {
+        type_align = DEFAULT_CONCURRENT_HASH_MAX_ALIGN;
+    }
+
+    return type_align;
+}
+
+/**
+ * @brief Function to allocate one node with its key and its data in
+ * the same block, the key and the data are left uninitialized.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return concurrent_hash_table_node_t* a new allocated node or `NULL` (if function fails)
+ */
+static concurrent_hash_table_node_t* concurrent_hash_table_alloc_node(const concurrent_hash_table_t * const __restrict__ cht) {
+    concurrent_hash_table_node_t *new_node = malloc(cht->node_size);
+
+    if (NULL == new_node) {
+        return NULL;
+    }
+
+    new_node->key = (uint8_t *)new_node + cht->key_offset;
+    new_node->data = (uint8_t *)new_node + cht->data_offset;
+    new_node->retired_next = NULL;
+
+    return new_node;
+}
+
+/**
+ * @brief Function to free one node, its key and its data.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param free_node pointer to a node that is not reachable any more
+ */
+static void free_concurrent_hash_table_node(const concurrent_hash_table_t * const __restrict__ cht, concurrent_hash_table_node_t * const __restrict__ free_node) {
+    if (NULL != cht->frd_key) {
+        cht->frd_key(free_node->key);
+    }
+
+    if (NULL != cht->frd_dt) {
+        cht->frd_dt(free_node->data);
+    }
+
+    /* Key and data are freed with their node */
+    free(free_node);
+}
+
+/**
+ * @brief Function to free one replaced buckets array. The keys and data
+ * of its nodes were copied into the nodes of the new buckets array, which
+ * own their content now, so just the nodes themselves are freed.
+ *
+ * @param buckets pointer to a buckets array that is not reachable any more
+ */
+static void free_concurrent_hash_table_buckets(concurrent_hash_table_buckets_t * const __restrict__ buckets) {
+    for (size_t iter = 0; iter < buckets->capacity; ++iter) {
+        concurrent_hash_table_node_t *iterator = atomic_load_explicit(&buckets->heads[iter], memory_order_relaxed);
+
+        while (NULL != iterator) {
+            concurrent_hash_table_node_t *next_node = atomic_load_explicit(&iterator->next, memory_order_relaxed);
+
+            free(iterator);
+            iterator = next_node;
+        }
+    }
+
+    free(buckets);
+}
+
+/**
+ * @brief Function to free all the memory retired before the call,
+ * after every reader that could still see it left its read section.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param retired_nodes list of retired nodes taken from the concurrent hash table
+ * @param retired_buckets list of retired buckets arrays taken from the concurrent hash table
+ */
+static void concurrent_hash_table_reclaim(concurrent_hash_table_t * const __restrict__ cht, concurrent_hash_table_node_t *retired_nodes, concurrent_hash_table_buckets_t *retired_buckets) {
+    /* Nothing to free */
+    if ((NULL == retired_nodes) && (NULL == retired_buckets)) {
+        return;
+    }
+
+    concurrent_hash_table_synchronize(cht);
+
+    /* Free the deleted nodes */
+    while (NULL != retired_nodes) {
+        concurrent_hash_table_node_t *next_node = retired_nodes->retired_next;
+
+        free_concurrent_hash_table_node(cht, retired_nodes);
+        retired_nodes = next_node;
+    }
+
+    /* Free the replaced buckets arrays */
+    while (NULL != retired_buckets) {
+        concurrent_hash_table_buckets_t *next_buckets = retired_buckets->retired_next;
+
+        free_concurrent_hash_table_buckets(retired_buckets);
+        retired_buckets = next_buckets;
+    }
+}
+
+/**
+ * @brief Function to retire one deleted node or one replaced buckets array.
+ * The memory is freed in batches, so the wait for the readers is paid
+ * once for many deletions.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param retired_node pointer to a node unlinked from its bucket or `NULL`
+ * @param retired_buckets pointer to a replaced buckets array or `NULL`
+ */
+static void concurrent_hash_table_retire(concurrent_hash_table_t * const __restrict__ cht, concurrent_hash_table_node_t * const retired_node, concurrent_hash_table_buckets_t * const retired_buckets) {
+    concurrent_hash_table_node_t *reclaim_nodes = NULL;
+    concurrent_hash_table_buckets_t *reclaim_buckets = NULL;
+
+    pthread_mutex_lock(&cht->retire_lock);
+
+    /* Push the retired memory */
+    if (NULL != retired_node) {
+        retired_node->retired_next = cht->retired_nodes;
+        cht->retired_nodes = retired_node;
+        ++(cht->number_of_retired_nodes);
+    }
+
+    if (NULL != retired_buckets) {
+        retired_buckets->retired_next = cht->retired_buckets;
+        cht->retired_buckets = retired_buckets;
+    }
+
+    /* Take the lists if there is enough memory to free */
+    if ((NULL != cht->retired_buckets) || (DEFAULT_CONCURRENT_HASH_RETIRE_BATCH <= cht->number_of_retired_nodes)) {
+        reclaim_nodes = cht->retired_nodes;
+        reclaim_buckets = cht->retired_buckets;
+
+        cht->retired_nodes = NULL;
+        cht->retired_buckets = NULL;
+        cht->number_of_retired_nodes = 0;
+    }
+
+    pthread_mutex_unlock(&cht->retire_lock);
+
+    /* Free the memory outside of the retire lock */
+    concurrent_hash_table_reclaim(cht, reclaim_nodes, reclaim_buckets);
+}
+
+/**
+ * @brief Function to allocate an array of empty buckets.
+ *
+ * @param capacity number of buckets, must be a power of two
+ * @return concurrent_hash_table_buckets_t* new allocated buckets array or `NULL`
+ */
+static concurrent_hash_table_buckets_t* concurrent_hash_table_alloc_buckets(size_t capacity) {
+    concurrent_hash_table_buckets_t *new_buckets = malloc(sizeof(*new_buckets) + capacity * sizeof(new_buckets->heads[0]));
+
+    /* Check if buckets were allocated */
+    if (NULL == new_buckets) {
+        errno = ENOMEM;
+        perror("Not enough memory for buckets of concurrent hash table");
+
+        return NULL;
+    }
+
+    new_buckets->capacity = capacity;
+    new_buckets->retired_next = NULL;
+
+    /* Set every bucket as empty */
+    for (size_t iter = 0; iter < capacity; ++iter) {
+        atomic_init(&new_buckets->heads[iter], NULL);
+    }
+
+    return new_buckets;
+}
+
+/**
+ * @brief Function to compute the number of buckets needed to
+ * keep the load factor under 0.75 for the selected number of pairs.
+ *
+ * @param number_of_pairs number of pairs to store
+ * @return size_t number of buckets, a power of two
+ */
+static size_t concurrent_hash_table_capacity_for(size_t number_of_pairs) {
+    size_t capacity = DEFAULT_CONCURRENT_HASH_CAPACITY;
+
+    while ((capacity / 4) * 3 < number_of_pairs) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+/**
+ * @brief Create a concurrent hash table object. Writers lock just the stripe
+ * of buckets of their key and readers do not lock at all, so the object can be
+ * used from many threads at once. Allocation may fail if there is not enough
+ * memory on heap, compare or hash functions are not valid or the locks cannot
+ * be initialized.
+ *
+ * @param init_capacity number of pairs that can be inserted without resizing
+ * @param hash pointer to a function to hash the key into a size_t type
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param cmp_dt pointer to a function to compare two sets of data
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return concurrent_hash_table_t* a new allocated concurrent hash table object or `NULL` (if function fails)
+ */
+concurrent_hash_table_t* create_concurrent_hash_table(size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == hash) || (NULL == cmp_key) || (NULL == cmp_dt)) {
+        errno = EINVAL;
+        perror("Compare or hash functions undefined in concurrent_hash_table");
+        return NULL;
+    }
+
+    /* Check if data and key sizes are valid */
+    if ((0 == key_size) || (0 == data_size)) {
+        errno = EINVAL;
+        perror("Key or data size are zero");
+        return NULL;
+    }
+
+    /* Check if one node with its key and data fits in memory */
+    if ((SIZE_MAX / 4 < key_size) || (SIZE_MAX / 4 < data_size)) {
+        errno = EINVAL;
+        perror("Key or data size are too big");
+        return NULL;
+    }
+
+    /* Allocate a new concurrent hash table object on heap */
+    concurrent_hash_table_t *new_cht = malloc(sizeof(*new_cht));
+
+    /* Check if concurrent hash table was allocated successfully */
+    if (NULL == new_cht) {
+        errno = ENOMEM;
+        perror("Not enough memory for concurrent hash table allocation");
+
+        return NULL;
+    }
+
+    /* Allocate the buckets */
+    concurrent_hash_table_buckets_t *new_buckets = concurrent_hash_table_alloc_buckets(concurrent_hash_table_capacity_for(init_capacity));
+
+    if (NULL == new_buckets) {
+        free(new_cht);
+
+        return NULL;
+    }
+
+    /* Set function pointers of the concurrent hash table */
+    new_cht->hash = hash;
+    new_cht->cmp_key = cmp_key;
+    new_cht->cmp_dt = cmp_dt;
+    new_cht->frd_key = frd_key;
+    new_cht->frd_dt = frd_dt;
+
+    /* Set sizes of the concurrent hash table */
+    new_cht->key_size = key_size;
+    new_cht->data_size = data_size;
+
+    /* The key and the data follow the node, each one at its own alignment */
+    size_t key_align = concurrent_hash_table_type_align(key_size);
+    size_t data_align = concurrent_hash_table_type_align(data_size);
+
+    new_cht->key_offset = (sizeof(concurrent_hash_table_node_t) + key_align - 1) / key_align * key_align;
+    new_cht->data_offset = (new_cht->key_offset + key_size + data_align - 1) / data_align * data_align;
+    new_cht->node_size = new_cht->data_offset + data_size;
+
+    atomic_init(&new_cht->table, new_buckets);
+    atomic_init(&new_cht->size, 0);
+    atomic_init(&new_cht->epoch, 0);
+
+    /* Set the readers counters */
+    for (size_t iter = 0; iter < CONCURRENT_HASH_TABLE_READER_SHARDS; ++iter) {
+        atomic_init(&new_cht->readers[0][iter].count, 0);
+        atomic_init(&new_cht->readers[1][iter].count, 0);
+    }
+
+    new_cht->retired_nodes = NULL;
+    new_cht->number_of_retired_nodes = 0;
+    new_cht->retired_buckets = NULL;
+
+    /* Initialize all the locks */
+    int err = pthread_mutex_init(&new_cht->reclaim_lock, NULL);
+
+    if (0 == err) {
+        err = pthread_mutex_init(&new_cht->retire_lock, NULL);
+
+        if (0 != err) {
+            pthread_mutex_destroy(&new_cht->reclaim_lock);
+        }
+    }
+
+    if (0 == err) {
+        size_t number_of_stripes = 0;
+
+        for (; number_of_stripes < CONCURRENT_HASH_TABLE_STRIPES; ++number_of_stripes) {
+            err = pthread_mutex_init(&new_cht->stripes[number_of_stripes].lock, NULL);
+
+            if (0 != err) {
+                break;
+            }
+        }
+
+        /* Destroy the locks initialized so far */
+        if (0 != err) {
+            while (0 != number_of_stripes) {
+                pthread_mutex_destroy(&new_cht->stripes[--number_of_stripes].lock);
+            }
+
+            pthread_mutex_destroy(&new_cht->reclaim_lock);
+            pthread_mutex_destroy(&new_cht->retire_lock);
+        }
+    }
+
+    /* Check if locks were initialized */
+    if (0 != err) {
+        free(new_buckets);
+        free(new_cht);
+
+        errno = err;
+        perror("Cannot initialize the locks of concurrent hash table");
+
+        return NULL;
+    }
+
+    /* Return a new allocated concurrent hash table */
+    return new_cht;
+}
+
+/**
+ * @brief Function to free every node from concurrent hash table object and
+ * the concurrent hash table object itself. No other thread may use the object
+ * while it is freed.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_concurrent_hash_table(concurrent_hash_table_t * const __restrict__ cht) {
+    /* Check if concurrent hash table is allocated */
+    if (NULL == cht) {
+        return SCL_NULL_CONCURRENT_HASH_TABLE;
+    }
+
+    /* Free the memory waiting for the readers */
+    concurrent_hash_table_reclaim(cht, cht->retired_nodes, cht->retired_buckets);
+
+    /* Free every node of the current buckets */
+    concurrent_hash_table_buckets_t *buckets = atomic_load(&cht->table);
+
+    for (size_t iter = 0; iter < buckets->capacity; ++iter) {
+        concurrent_hash_table_node_t *iterator = atomic_load_explicit(&buckets->heads[iter], memory_order_relaxed);
+
+        while (NULL != iterator) {
+            concurrent_hash_table_node_t *next_node = atomic_load_explicit(&iterator->next, memory_order_relaxed);
+
+            free_concurrent_hash_table_node(cht, iterator);
+            iterator = next_node;
+        }
+    }
+
+    free(buckets);
+
+    /* Destroy all the locks */
+    for (size_t iter = 0; iter < CONCURRENT_HASH_TABLE_STRIPES; ++iter) {
+        pthread_mutex_destroy(&cht->stripes[iter].lock);
+    }
+
+    pthread_mutex_destroy(&cht->reclaim_lock);
+    pthread_mutex_destroy(&cht->retire_lock);
+
+    /* Free concurrent hash table object */
+    free(cht);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move all the nodes into a new buckets array with the
+ * selected capacity. Every stripe is locked, so no writer changes the buckets
+ * meanwhile. The nodes are copied with their key and data, because the
+ * readers may still walk the old buckets, which are freed after them. The
+ * copies own the content of the keys and data from then on.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param new_capacity number of buckets after resizing, a power of two
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t concurrent_hash_table_resize(concurrent_hash_table_t * const __restrict__ cht, size_t new_capacity) {
+    /* Stop all the writers */
+    for (size_t iter = 0; iter < CONCURRENT_HASH_TABLE_STRIPES; ++iter) {
+        pthread_mutex_lock(&cht->stripes[iter].lock);
+    }
+
+    concurrent_hash_table_buckets_t *old_buckets = atomic_load_explicit(&cht->table, memory_order_relaxed);
+    concurrent_hash_table_buckets_t *new_buckets = NULL;
+
+    scl_error_t err = SCL_OK;
+
+    /* Another writer could have already resized the buckets */
+    if (old_buckets->capacity < new_capacity) {
+        new_buckets = concurrent_hash_table_alloc_buckets(new_capacity);
+
+        if (NULL == new_buckets) {
+            err = SCL_REHASHING_FAILED;
+        }
+    }
+
+    /* Copy every node into the new buckets */
+    for (size_t iter = 0; (NULL != new_buckets) && (iter < old_buckets->capacity); ++iter) {
+        const concurrent_hash_table_node_t *iterator = atomic_load_explicit(&old_buckets->heads[iter], memory_order_relaxed);
+
+        while (NULL != iterator) {
+            concurrent_hash_table_node_t *copy_node = concurrent_hash_table_alloc_node(cht);
+
+            /* Drop the new buckets, the old ones are still valid */
+            if (NULL == copy_node) {
+                free_concurrent_hash_table_buckets(new_buckets);
+                new_buckets = NULL;
+
+                errno = ENOMEM;
+                perror("Not enough memory for concurrent hash table resizing");
+
+                err = SCL_REHASHING_FAILED;
+
+                break;
+            }
+
+            size_t bucket_index = iterator->hash & (new_capacity - 1);
+
+            memcpy(copy_node->key, iterator->key, cht->key_size);
+            memcpy(copy_node->data, iterator->data, cht->data_size);
+            copy_node->hash = iterator->hash;
+
+            atomic_init(&copy_node->next, atomic_load_explicit(&new_buckets->heads[bucket_index], memory_order_relaxed));
+            atomic_init(&new_buckets->heads[bucket_index], copy_node);
+
+            iterator = atomic_load_explicit(&iterator->next, memory_order_relaxed);
+        }
+    }
+
+    /* Publish the new buckets */
+    if (NULL != new_buckets) {
+        atomic_store_explicit(&cht->table, new_buckets, memory_order_release);
+    }
+
+    for (size_t iter = CONCURRENT_HASH_TABLE_STRIPES; iter > 0; --iter) {
+        pthread_mutex_unlock(&cht->stripes[iter - 1].lock);
+    }
+
+    /* Free the old buckets after the readers */
+    if (NULL != new_buckets) {
+        concurrent_hash_table_retire(cht, NULL, old_buckets);
+    }
+
+    return err;
+}
+
+/**
+ * @brief Function to make room in the concurrent hash table for the
+ * selected number of pairs, so they can be inserted without resizing.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param number_of_pairs number of pairs the concurrent hash table should hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_reserve(concurrent_hash_table_t * const __restrict__ cht, size_t number_of_pairs) {
+    /* Check if concurrent hash table is allocated */
+    if (NULL == cht) {
+        return SCL_NULL_CONCURRENT_HASH_TABLE;
+    }
+
+    return concurrent_hash_table_resize(cht, concurrent_hash_table_capacity_for(number_of_pairs));
+}
+
+/**
+ * @brief Function to insert one pair {key, data} into the concurrent hash
+ * table. Just the stripe of the key is locked. If the key is already in the
+ * concurrent hash table nothing is changed. The buckets are doubled when the
+ * load factor becomes greater than 0.75.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of the hash
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_insert(concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data) {
+    /* Check if concurrent hash table is allocated */
+    if (NULL == cht) {
+        return SCL_NULL_CONCURRENT_HASH_TABLE;
+    }
+
+    /* Check if key and data are valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Allocate the new node with its key and data before locking */
+    concurrent_hash_table_node_t *new_node = concurrent_hash_table_alloc_node(cht);
+
+    if (NULL == new_node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    memcpy(new_node->key, key, cht->key_size);
+    memcpy(new_node->data, data, cht->data_size);
+
+    new_node->hash = concurrent_hash_table_mix_hash(cht->hash(key));
+
+    /* Every bucket of a stripe has the same low bits */
+    pthread_mutex_t * const stripe_lock = &cht->stripes[new_node->hash & (CONCURRENT_HASH_TABLE_STRIPES - 1)].lock;
+
+    pthread_mutex_lock(stripe_lock);
+
+    /* Buckets cannot be replaced while a stripe is locked */
+    concurrent_hash_table_buckets_t *buckets = atomic_load_explicit(&cht->table, memory_order_acquire);
+    size_t bucket_index = new_node->hash & (buckets->capacity - 1);
+
+    concurrent_hash_table_node_t *head_node = atomic_load_explicit(&buckets->heads[bucket_index], memory_order_relaxed);
+
+    /* Keys are unique */
+    for (const concurrent_hash_table_node_t *iterator = head_node; NULL != iterator; iterator = atomic_load_explicit(&iterator->next, memory_order_relaxed)) {
+        if ((new_node->hash == iterator->hash) && (0 == cht->cmp_key(iterator->key, key))) {
+            pthread_mutex_unlock(stripe_lock);
+
+            free(new_node);
+
+            return SCL_OK;
+        }
+    }
+
+    /* Publish the node at the head of the bucket */
+    atomic_init(&new_node->next, head_node);
+    atomic_store_explicit(&buckets->heads[bucket_index], new_node, memory_order_release);
+
+    size_t new_size = atomic_fetch_add_explicit(&cht->size, 1, memory_order_relaxed) + 1;
+    size_t capacity = buckets->capacity;
+
+    pthread_mutex_unlock(stripe_lock);
+
+    /* Double the buckets if load factor is too big */
+    if ((capacity / 4) * 3 < new_size) {
+        return concurrent_hash_table_resize(cht, capacity * 2);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search the node of one key, must be
+ * called from a read section or with the stripe of the key locked.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return const concurrent_hash_table_node_t* node of the key or `NULL`
+ */
+static const concurrent_hash_table_node_t* concurrent_hash_table_find_node(const concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key) {
+    size_t hash = concurrent_hash_table_mix_hash(cht->hash(key));
+
+    const concurrent_hash_table_buckets_t *buckets = atomic_load_explicit(&cht->table, memory_order_acquire);
+    const concurrent_hash_table_node_t *iterator = atomic_load_explicit(&buckets->heads[hash & (buckets->capacity - 1)], memory_order_acquire);
+
+    while (NULL != iterator) {
+        if ((hash == iterator->hash) && (0 == cht->cmp_key(iterator->key, key))) {
+            return iterator;
+        }
+
+        iterator = atomic_load_explicit(&iterator->next, memory_order_acquire);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function to copy the data of one key into a location of the
+ * caller. The function does not lock, it can run at the same time with
+ * writers and resizing. The data is copied because a returned pointer
+ * could be freed by another thread right after the call.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location to copy the data of the key (`data_size` bytes)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_find_data(const concurrent_hash_table_t * const __restrict__ cht, const void * const key, void * const data) {
+    /* Check if concurrent hash table is allocated */
+    if (NULL == cht) {
+        return SCL_NULL_CONCURRENT_HASH_TABLE;
+    }
+
+    /* Check if key and data location are valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    size_t shard = concurrent_hash_table_shard();
+    size_t parity = concurrent_hash_table_read_lock(cht, shard);
+
+    const concurrent_hash_table_node_t * const find_node = concurrent_hash_table_find_node(cht, key);
+
+    if (NULL != find_node) {
+        memcpy(data, find_node->data, cht->data_size);
+    }
+
+    concurrent_hash_table_read_unlock(cht, shard, parity);
+
+    if (NULL == find_node) {
+        return SCL_DATA_NOT_FOUND;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to check if one key is in the concurrent
+ * hash table. The function does not lock.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return uint8_t 1 if key is in the concurrent hash table, 0 otherwise
+ */
+uint8_t concurrent_hash_table_contains_key(const concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == cht) || (NULL == key)) {
+        return 0;
+    }
+
+    size_t shard = concurrent_hash_table_shard();
+    size_t parity = concurrent_hash_table_read_lock(cht, shard);
+
+    uint8_t contains_key = (NULL != concurrent_hash_table_find_node(cht, key));
+
+    concurrent_hash_table_read_unlock(cht, shard, parity);
+
+    return contains_key;
+}
+
+/**
+ * @brief Function to check if one pair {key, data} is in the
+ * concurrent hash table. The function does not lock.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of the hash
+ * @return uint8_t 1 if pair is in the concurrent hash table, 0 otherwise
+ */
+uint8_t concurrent_hash_table_contains_key_data(const concurrent_hash_table_t * const __restrict__ cht, const void * const key, const void * const data) {
+    /* Check if input data is valid */
+    if ((NULL == cht) || (NULL == key) || (NULL == data)) {
+        return 0;
+    }
+
+    size_t shard = concurrent_hash_table_shard();
+    size_t parity = concurrent_hash_table_read_lock(cht, shard);
+
+    const concurrent_hash_table_node_t * const find_node = concurrent_hash_table_find_node(cht, key);
+    uint8_t contains_pair = ((NULL != find_node) && (0 == cht->cmp_dt(find_node->data, data)));
+
+    concurrent_hash_table_read_unlock(cht, shard, parity);
+
+    return contains_pair;
+}
+
+/**
+ * @brief Function to get the number of pairs from concurrent hash table.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return size_t number of pairs or SIZE_MAX if concurrent hash table is not allocated
+ */
+size_t get_concurrent_hash_table_size(const concurrent_hash_table_t * const __restrict__ cht) {
+    if (NULL == cht) {
+        return SIZE_MAX;
+    }
+
+    return atomic_load_explicit(&cht->size, memory_order_relaxed);
+}
+
+/**
+ * @brief Function to get the number of buckets from concurrent hash table.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @return size_t number of buckets or SIZE_MAX if concurrent hash table is not allocated
+ */
+size_t get_concurrent_hash_table_capacity(const concurrent_hash_table_t * const __restrict__ cht) {
+    if (NULL == cht) {
+        return SIZE_MAX;
+    }
+
+    return atomic_load_explicit(&cht->table, memory_order_acquire)->capacity;
+}
+
+/**
+ * @brief Function to delete one key and its data from the concurrent hash
+ * table. Just the stripe of the key is locked. The node is unlinked at once,
+ * but it is freed after all the readers that could still see it.
+ *
+ * @param cht pointer to an allocated concurrent hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t concurrent_hash_table_delete_key(concurrent_hash_table_t * const __restrict__ cht, const void * const __restrict__ key) {
+    /* Check if concurrent hash table is allocated */
+    if (NULL == cht) {
+        return SCL_NULL_CONCURRENT_HASH_TABLE;
+    }
+
+    /* Check if key is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    size_t hash = concurrent_hash_table_mix_hash(cht->hash(key));
+    pthread_mutex_t * const stripe_lock = &cht->stripes[hash & (CONCURRENT_HASH_TABLE_STRIPES - 1)].lock;
+
+    pthread_mutex_lock(stripe_lock);
+
+    /* Buckets cannot be replaced while a stripe is locked */
+    concurrent_hash_table_buckets_t *buckets = atomic_load_explicit(&cht->table, memory_order_acquire);
+
+    _Atomic(concurrent_hash_table_node_t *) *link = &buckets->heads[hash & (buckets->capacity - 1)];
+    concurrent_hash_table_node_t *iterator = atomic_load_explicit(link, memory_order_relaxed);
+
+    /* Search the node and the link pointing to it */
+    while ((NULL != iterator) && ((hash != iterator->hash) || (0 != cht->cmp_key(iterator->key, key)))) {
+        link = &iterator->next;
+        iterator = atomic_load_explicit(link, memory_order_relaxed);
+    }
+
+    /* Unlink the node, readers standing on it still see the rest of the bucket */
+    if (NULL != iterator) {
+        atomic_store_explicit(link, atomic_load_explicit(&iterator->next, memory_order_relaxed), memory_order_release);
+        atomic_fetch_sub_explicit(&cht->size, 1, memory_order_relaxed);
+    }
+
+    pthread_mutex_unlock(stripe_lock);
+
+    /* Check if the key was found */
+    if (NULL == iterator) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Free the node after the readers */
+    concurrent_hash_table_retire(cht, iterator, NULL);
+
+    /* All good */
+    return SCL_OK;
+}
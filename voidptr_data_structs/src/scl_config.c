@@ -245,6 +245,50 @@ void scl_error_message(scl_error_t error_message) {
         printf("The number to add to the selected graph is zero, so no action needed\n");
         break;
 
+    case SCL_NULL_FLAT_MAP:
+        printf("Flat Map pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_NULL_FLAT_MAP_SLOTS:
+        printf("The slots of the flat map object are not allocated\n");
+        break;
+
+    case SCL_NULL_CONCURRENT_HASH_TABLE:
+        printf("Concurrent Hash Table pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_NULL_HASH_TABLE_ITER:
+        printf("Hash Table iterator pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_NULL_HASH_TABLE_FILTER:
+        printf("Hash Table has no membership filter\n");
+        break;
+
+    case SCL_NULL_CACHE:
+        printf("Cache pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_NULL_HASH_TABLE_SNAPSHOT:
+        printf("Hash Table snapshot pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_SNAPSHOT_WRITE_FAILED:
+        printf("Hash Table snapshot file could not be written\n");
+        break;
+
+    case SCL_NULL_POOL:
+        printf("Pool pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_NULL_BTREE:
+        printf("B+ Tree pointer sent into the function is NULL\n");
+        break;
+
+    case SCL_NULL_STATIC_INDEX:
+        printf("Static index pointer sent into the function is NULL\n");
+        break;
+
     default:
         printf("Unknown error check again\n");
     }
@@ -0,0 +1,812 @@
+/**
+ * @file scl_flat_map.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_flat_map.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define DEFAULT_FLAT_MAP_CAPACITY 16
+#define DEFAULT_FLAT_MAP_GROUP_WIDTH 16
+#define DEFAULT_FLAT_MAP_MAX_ALIGN 16
+
+#define FLAT_MAP_CTRL_EMPTY ((int8_t)-128)
+#define FLAT_MAP_CTRL_DELETED ((int8_t)-2)
+
+/**
+ * @brief Function to compute the alignment of a data type knowing
+ * just its length in bytes. The alignment of any data type divides its
+ * length, so the lowest set bit of the length is a safe alignment.
+ *
+ * @param type_size length in bytes of the data type
+ * @return size_t alignment in bytes of the data type
+ */
+static size_t flat_map_type_align(size_t type_size) {
+    /* Isolate the lowest set bit of the length */
+    size_t type_align = type_size & (~type_size + 1);
+
+    /* No fundamental data type needs a greater alignment */
+    if (DEFAULT_FLAT_MAP_MAX_ALIGN < type_align) {
+        type_align = DEFAULT_FLAT_MAP_MAX_ALIGN;
+    }
+
+    return type_align;
+}
+
+/**
+ * @brief Function to compute the number of pairs that can be stored
+ * into a flat map with the selected capacity. At most 7 of every 8 slots
+ * are used, so probing always finds an empty slot quickly.
+ *
+ * @param capacity number of slots of the flat map
+ * @return size_t maximum number of pairs
+ */
+static size_t flat_map_max_load(size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+/**
+ * @brief Function to compute the number of slots needed to store
+ * the selected number of pairs. The result is a power of two and
+ * it is never less than the width of one group.
+ *
+ * @param number_of_pairs number of pairs to store
+ * @return size_t number of slots
+ */
+static size_t flat_map_capacity_for(size_t number_of_pairs) {
+    size_t capacity = DEFAULT_FLAT_MAP_CAPACITY;
+
+    while (flat_map_max_load(capacity) < number_of_pairs) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+/**
+ * @brief Function to mix all the bits of a hash value (fmix64 finalizer of
+ * MurmurHash3). The low 7 bits are stored into the control byte and the
+ * high bits select the group, so both must depend on the whole hash.
+ *
+ * @param hash hash value of one key computed with hash function of the map
+ * @return size_t mixed hash value
+ */
+static size_t flat_map_mix_hash(size_t hash) {
+    uint64_t mixed_hash = (uint64_t)hash;
+
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xff51afd7ed558ccdULL;
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+    mixed_hash ^= mixed_hash >> 33;
+
+    return (size_t)mixed_hash;
+}
+
+/**
+ * @brief Function to get the location of the key stored
+ * inline in one slot.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param slot index of the slot
+ * @return void* pointer to the key of the selected slot
+ */
+static void* flat_map_key(const flat_map_t * const __restrict__ fm, size_t slot) {
+    return fm->entries + slot * fm->entry_size;
+}
+
+/**
+ * @brief Function to get the location of the data stored
+ * inline in one slot.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param slot index of the slot
+ * @return void* pointer to the data of the selected slot
+ */
+static void* flat_map_data(const flat_map_t * const __restrict__ fm, size_t slot) {
+    return fm->entries + slot * fm->entry_size + fm->data_offset;
+}
+
+/**
+ * @brief Function to find all the control bytes of one group
+ * equal to the selected value. SSE2 compares all 16 control
+ * bytes at once, otherwise the bytes are checked one by one.
+ *
+ * @param group pointer to the first control byte of the group
+ * @param value control byte value to search
+ * @return uint32_t bit mask, bit i is set if control byte i matches
+ */
+static uint32_t flat_map_group_match(const int8_t * const __restrict__ group, int8_t value) {
+#if defined(__SSE2__)
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+    uint32_t mask = 0;
+
+    for (uint32_t iter = 0; iter < DEFAULT_FLAT_MAP_GROUP_WIDTH; ++iter) {
+        if (value == group[iter]) {
+            mask |= (1U << iter);
+        }
+    }
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Function to find all the free (empty or deleted) slots of one
+ * group. Only the free control bytes have the sign bit set.
+ *
+ * @param group pointer to the first control byte of the group
+ * @return uint32_t bit mask, bit i is set if slot i is free
+ */
+static uint32_t flat_map_group_match_free(const int8_t * const __restrict__ group) {
+#if defined(__SSE2__)
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else
+    uint32_t mask = 0;
+
+    for (uint32_t iter = 0; iter < DEFAULT_FLAT_MAP_GROUP_WIDTH; ++iter) {
+        if (0 > group[iter]) {
+            mask |= (1U << iter);
+        }
+    }
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Function to get the index of the lowest set bit of a mask.
+ *
+ * @param mask non-zero bit mask
+ * @return uint32_t index of the lowest set bit
+ */
+static uint32_t flat_map_lowest_bit(uint32_t mask) {
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctz(mask);
+#else
+    uint32_t index = 0;
+
+    while (0 == (mask & 1U)) {
+        mask >>= 1;
+        ++index;
+    }
+
+    return index;
+#endif
+}
+
+/**
+ * @brief Create a flat map object. Allocation may fail if there is not enough
+ * memory on heap, compare or hash functions are not valid. The pairs are stored
+ * inline, so the pointers returned by find functions are valid until the next
+ * insertion or deletion.
+ *
+ * @param init_capacity number of pairs that can be inserted without rehashing
+ * @param hash pointer to a function to hash the key into a size_t type
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param cmp_dt pointer to a function to compare two sets of data
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return flat_map_t* a new allocated flat map object or `NULL` (if function fails)
+ */
+flat_map_t* create_flat_map(size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == hash) || (NULL == cmp_key) || (NULL == cmp_dt)) {
+        errno = EINVAL;
+        perror("Compare or hash functions undefined in flat_map");
+        return NULL;
+    }
+
+    /* Check if data and key sizes are valid */
+    if ((0 == key_size) || (0 == data_size)) {
+        errno = EINVAL;
+        perror("Key or data size are zero");
+        return NULL;
+    }
+
+    /* Allocate a new flat map object on heap */
+    flat_map_t *new_flat_map = malloc(sizeof(*new_flat_map));
+
+    /* Check if flat map was allocated successfully */
+    if (NULL == new_flat_map) {
+        errno = ENOMEM;
+        perror("Not enough memory for flat map allocation");
+
+        return NULL;
+    }
+
+    /* Set function pointers of the flat map */
+    new_flat_map->hash = hash;
+    new_flat_map->cmp_key = cmp_key;
+    new_flat_map->cmp_dt = cmp_dt;
+    new_flat_map->frd_key = frd_key;
+    new_flat_map->frd_dt = frd_dt;
+
+    /* Compute the layout of one inline {key, data} pair */
+    size_t key_align = flat_map_type_align(key_size);
+    size_t data_align = flat_map_type_align(data_size);
+    size_t entry_align = (key_align > data_align) ? key_align : data_align;
+
+    new_flat_map->key_size = key_size;
+    new_flat_map->data_size = data_size;
+    new_flat_map->data_offset = (key_size + data_align - 1) & ~(data_align - 1);
+    new_flat_map->entry_size = (new_flat_map->data_offset + data_size + entry_align - 1) & ~(entry_align - 1);
+
+    /* Set capacity and default size of the flat map */
+    new_flat_map->capacity = flat_map_capacity_for(init_capacity);
+    new_flat_map->size = 0;
+    new_flat_map->growth_left = flat_map_max_load(new_flat_map->capacity);
+
+    /* Allocate the control bytes and the inline pairs */
+    new_flat_map->ctrl = malloc(new_flat_map->capacity);
+    new_flat_map->entries = malloc(new_flat_map->entry_size * new_flat_map->capacity);
+
+    /* Check if slots were allocated successfully */
+    if ((NULL == new_flat_map->ctrl) || (NULL == new_flat_map->entries)) {
+
+        /* Slots were not allocated wipe flat map's memory */
+        free(new_flat_map->ctrl);
+        free(new_flat_map->entries);
+        free(new_flat_map);
+        new_flat_map = NULL;
+
+        errno = ENOMEM;
+        perror("Not enough memory for slots of flat map");
+
+        return NULL;
+    }
+
+    /* Set all slots as empty */
+    memset(new_flat_map->ctrl, FLAT_MAP_CTRL_EMPTY, new_flat_map->capacity);
+
+    /* Return a new allocated flat map */
+    return new_flat_map;
+}
+
+/**
+ * @brief Function to free the content of one pair
+ * stored inline in one slot.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param slot index of the slot
+ */
+static void free_flat_map_entry(const flat_map_t * const __restrict__ fm, size_t slot) {
+    if (NULL != fm->frd_dt) {
+        fm->frd_dt(flat_map_data(fm, slot));
+    }
+
+    if (NULL != fm->frd_key) {
+        fm->frd_key(flat_map_key(fm, slot));
+    }
+}
+
+/**
+ * @brief Function to free every pair from flat map object
+ * and the flat map object itself.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_flat_map(flat_map_t * const __restrict__ fm) {
+    /* Check if flat map is allocated */
+    if (NULL == fm) {
+        return SCL_NULL_FLAT_MAP;
+    }
+
+    /* Free the content of every stored pair */
+    if (NULL != fm->ctrl) {
+        for (size_t iter = 0; iter < fm->capacity; ++iter) {
+            if (0 <= fm->ctrl[iter]) {
+                free_flat_map_entry(fm, iter);
+            }
+        }
+    }
+
+    /* Free the slots arrays */
+    free(fm->ctrl);
+    free(fm->entries);
+
+    /* Free flat map object */
+    free(fm);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search the slot holding the key specified in input.
+ * Groups of 16 control bytes are probed, just the slots having the same
+ * 7 bits of the hash are compared with the key. The search stops at the
+ * first group having an empty slot.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @return size_t index of the slot holding the key or SIZE_MAX if key is not found
+ */
+static size_t flat_map_find_slot(const flat_map_t * const __restrict__ fm, const void * const __restrict__ key) {
+    /* Split the hash into the group selector and the control byte */
+    size_t hash = flat_map_mix_hash(fm->hash(key));
+    int8_t hash_tag = (int8_t)(hash & 0x7f);
+
+    size_t number_of_groups = fm->capacity / DEFAULT_FLAT_MAP_GROUP_WIDTH;
+    size_t group = (hash >> 7) & (number_of_groups - 1);
+
+    /* Triangular probing visits every group once */
+    for (size_t step = 1; step <= number_of_groups; ++step) {
+        const int8_t * const group_ctrl = fm->ctrl + group * DEFAULT_FLAT_MAP_GROUP_WIDTH;
+
+        /* Compare keys just for the slots with the same tag */
+        for (uint32_t mask = flat_map_group_match(group_ctrl, hash_tag); 0 != mask; mask &= mask - 1) {
+            size_t slot = group * DEFAULT_FLAT_MAP_GROUP_WIDTH + flat_map_lowest_bit(mask);
+
+            if (0 == fm->cmp_key(flat_map_key(fm, slot), key)) {
+                return slot;
+            }
+        }
+
+        /* An empty slot means that the key was never pushed further */
+        if (0 != flat_map_group_match(group_ctrl, FLAT_MAP_CTRL_EMPTY)) {
+            break;
+        }
+
+        /* Go to the next group */
+        group = (group + step) & (number_of_groups - 1);
+    }
+
+    /* Key was not found */
+    return SIZE_MAX;
+}
+
+/**
+ * @brief Function to place one pair into the first free slot of its
+ * probe sequence. The key must not be in the flat map and one free
+ * slot must exist.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param hash mixed hash value of the key
+ * @param key pointer to a location of a value representing key of the pair
+ * @param data pointer to a location of a value representing data of the pair
+ */
+static void flat_map_place(flat_map_t * const __restrict__ fm, size_t hash, const void * const key, const void * const data) {
+    size_t number_of_groups = fm->capacity / DEFAULT_FLAT_MAP_GROUP_WIDTH;
+    size_t group = (hash >> 7) & (number_of_groups - 1);
+
+    /* Search the first group with a free slot */
+    uint32_t mask = flat_map_group_match_free(fm->ctrl + group * DEFAULT_FLAT_MAP_GROUP_WIDTH);
+
+    for (size_t step = 1; 0 == mask; ++step) {
+        group = (group + step) & (number_of_groups - 1);
+        mask = flat_map_group_match_free(fm->ctrl + group * DEFAULT_FLAT_MAP_GROUP_WIDTH);
+    }
+
+    size_t slot = group * DEFAULT_FLAT_MAP_GROUP_WIDTH + flat_map_lowest_bit(mask);
+
+    /* Reusing a deleted slot does not consume the growth */
+    if (FLAT_MAP_CTRL_EMPTY == fm->ctrl[slot]) {
+        --(fm->growth_left);
+    }
+
+    /* Copy the pair inline and mark the slot as full */
+    fm->ctrl[slot] = (int8_t)(hash & 0x7f);
+
+    memcpy(flat_map_key(fm, slot), key, fm->key_size);
+    memcpy(flat_map_data(fm, slot), data, fm->data_size);
+
+    ++(fm->size);
+}
+
+/**
+ * @brief Function to move all the pairs into new slots arrays with the
+ * selected capacity. The deleted slots are dropped. The pairs are moved
+ * with memcpy, so no user function is called, except the hash function.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param new_capacity number of slots after rehashing
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t flat_map_rehash(flat_map_t * const __restrict__ fm, size_t new_capacity) {
+    /* Allocate new slots arrays */
+    int8_t *new_ctrl = malloc(new_capacity);
+    uint8_t *new_entries = malloc(fm->entry_size * new_capacity);
+
+    /* Check if slots were allocated */
+    if ((NULL == new_ctrl) || (NULL == new_entries)) {
+        free(new_ctrl);
+        free(new_entries);
+
+        errno = ENOMEM;
+        perror("Not enough memory for slots of flat map");
+
+        return SCL_REHASHING_FAILED;
+    }
+
+    memset(new_ctrl, FLAT_MAP_CTRL_EMPTY, new_capacity);
+
+    /* Change old slots pointers to new slots pointers */
+    int8_t *old_ctrl = fm->ctrl;
+    uint8_t *old_entries = fm->entries;
+    size_t old_capacity = fm->capacity;
+
+    fm->ctrl = new_ctrl;
+    fm->entries = new_entries;
+    fm->capacity = new_capacity;
+    fm->growth_left = flat_map_max_load(new_capacity);
+    fm->size = 0;
+
+    /* Place every pair into the new slots */
+    for (size_t iter = 0; iter < old_capacity; ++iter) {
+        if (0 <= old_ctrl[iter]) {
+            const uint8_t * const old_key = old_entries + iter * fm->entry_size;
+
+            flat_map_place(fm, flat_map_mix_hash(fm->hash(old_key)), old_key, old_key + fm->data_offset);
+        }
+    }
+
+    /* Free old slots arrays */
+    free(old_ctrl);
+    free(old_entries);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to make room in the flat map for the selected number of
+ * pairs, so they can be inserted without any rehashing. If the flat map is
+ * already big enough nothing is changed.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param number_of_pairs number of pairs the flat map should hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_map_reserve(flat_map_t * const __restrict__ fm, size_t number_of_pairs) {
+    /* Check if flat map is allocated */
+    if (NULL == fm) {
+        return SCL_NULL_FLAT_MAP;
+    }
+
+    /* Check if flat map slots are allocated */
+    if (NULL == fm->ctrl) {
+        return SCL_NULL_FLAT_MAP_SLOTS;
+    }
+
+    /* Compute the needed number of slots */
+    size_t new_capacity = flat_map_capacity_for(number_of_pairs);
+
+    /* Flat map is big enough */
+    if (new_capacity <= fm->capacity) {
+        return SCL_OK;
+    }
+
+    return flat_map_rehash(fm, new_capacity);
+}
+
+/**
+ * @brief Function to insert one pair {key, data} into the flat map. If the key
+ * is already in the flat map nothing is changed. The flat map is rehashed when
+ * 7 of every 8 slots are used or deleted.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @param data pointer to a location of a value representing data of the pair
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_map_insert(flat_map_t * const __restrict__ fm, const void * const key, const void * const data) {
+    /* Check if flat map is allocated */
+    if (NULL == fm) {
+        return SCL_NULL_FLAT_MAP;
+    }
+
+    /* Check if flat map slots are allocated */
+    if (NULL == fm->ctrl) {
+        return SCL_NULL_FLAT_MAP_SLOTS;
+    }
+
+    /* Check if key and data are valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Keys are unique */
+    if (SIZE_MAX != flat_map_find_slot(fm, key)) {
+        return SCL_OK;
+    }
+
+    /* No empty slot is left to use */
+    if (0 == fm->growth_left) {
+
+        /* Grow if the pairs fill the map, otherwise just drop the deleted slots */
+        size_t new_capacity = fm->capacity;
+
+        if (fm->size >= flat_map_max_load(fm->capacity) / 2) {
+            new_capacity <<= 1;
+        }
+
+        scl_error_t err = flat_map_rehash(fm, new_capacity);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    /* Place the pair into the first free slot */
+    flat_map_place(fm, flat_map_mix_hash(fm->hash(key)), key, data);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the data of one pair {key, data} if
+ * the pair is in the flat map.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @param data pointer to a location of a value representing data of the pair
+ * @return const void* pointer to the data of the pair or `NULL`
+ */
+const void* flat_map_find_key_data(const flat_map_t * const __restrict__ fm, const void * const key, const void * const data) {
+    /* Check if input data is valid */
+    if ((NULL == fm) || (NULL == fm->ctrl) || (NULL == key) || (NULL == data)) {
+        return NULL;
+    }
+
+    /* Search the slot of the key */
+    size_t slot = flat_map_find_slot(fm, key);
+
+    /* Check if the data of the key is the selected data */
+    if ((SIZE_MAX != slot) && (0 == fm->cmp_dt(flat_map_data(fm, slot), data))) {
+        return flat_map_data(fm, slot);
+    }
+
+    /* Pair was not found */
+    return NULL;
+}
+
+/**
+ * @brief Function to find the data of one key.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @return const void* pointer to the data of the key or `NULL`
+ */
+const void* flat_map_find_data(const flat_map_t * const __restrict__ fm, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == fm) || (NULL == fm->ctrl) || (NULL == key)) {
+        return NULL;
+    }
+
+    /* Search the slot of the key */
+    size_t slot = flat_map_find_slot(fm, key);
+
+    /* Key was not found */
+    if (SIZE_MAX == slot) {
+        return NULL;
+    }
+
+    return flat_map_data(fm, slot);
+}
+
+/**
+ * @brief Function to check if one pair {key, data}
+ * is in the flat map.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @param data pointer to a location of a value representing data of the pair
+ * @return uint8_t 1 if pair is in the flat map, 0 otherwise
+ */
+uint8_t flat_map_contains_key_data(const flat_map_t * const __restrict__ fm, const void * const key, const void * const data) {
+    return (NULL != flat_map_find_key_data(fm, key, data));
+}
+
+/**
+ * @brief Function to check if flat map is empty.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @return uint8_t 1 if flat map is empty or not allocated, 0 otherwise
+ */
+uint8_t is_flat_map_empty(const flat_map_t * const __restrict__ fm) {
+    if ((NULL == fm) || (NULL == fm->ctrl) || (0 == fm->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Function to get the number of pairs from flat map.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @return size_t number of pairs or SIZE_MAX if flat map is not allocated
+ */
+size_t get_flat_map_size(const flat_map_t * const __restrict__ fm) {
+    if (NULL == fm) {
+        return SIZE_MAX;
+    }
+
+    return fm->size;
+}
+
+/**
+ * @brief Function to get the number of slots from flat map.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @return size_t number of slots or SIZE_MAX if flat map is not allocated
+ */
+size_t get_flat_map_capacity(const flat_map_t * const __restrict__ fm) {
+    if (NULL == fm) {
+        return SIZE_MAX;
+    }
+
+    return fm->capacity;
+}
+
+/**
+ * @brief Function to free one pair and to release its slot. If the group
+ * of the slot has an empty slot no probe sequence passes over it, so the
+ * slot becomes empty, otherwise it is marked as deleted.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param slot index of the slot to release
+ */
+static void flat_map_delete_slot(flat_map_t * const __restrict__ fm, size_t slot) {
+    free_flat_map_entry(fm, slot);
+
+    const int8_t * const group_ctrl = fm->ctrl + (slot / DEFAULT_FLAT_MAP_GROUP_WIDTH) * DEFAULT_FLAT_MAP_GROUP_WIDTH;
+
+    if (0 != flat_map_group_match(group_ctrl, FLAT_MAP_CTRL_EMPTY)) {
+        fm->ctrl[slot] = FLAT_MAP_CTRL_EMPTY;
+        ++(fm->growth_left);
+    } else {
+        fm->ctrl[slot] = FLAT_MAP_CTRL_DELETED;
+    }
+
+    --(fm->size);
+}
+
+/**
+ * @brief Function to delete one pair {key, data} from
+ * the flat map, the data of the key must be the selected data.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @param data pointer to a location of a value representing data of the pair
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_map_delete_key_data(flat_map_t * const __restrict__ fm, const void * const key, const void * const data) {
+    /* Check if flat map is allocated */
+    if (NULL == fm) {
+        return SCL_NULL_FLAT_MAP;
+    }
+
+    /* Check if flat map slots are allocated */
+    if (NULL == fm->ctrl) {
+        return SCL_NULL_FLAT_MAP_SLOTS;
+    }
+
+    /* Check if key and data are valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Search the slot of the key */
+    size_t slot = flat_map_find_slot(fm, key);
+
+    /* Check if the pair is in the flat map */
+    if ((SIZE_MAX == slot) || (0 != fm->cmp_dt(flat_map_data(fm, slot), data))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    flat_map_delete_slot(fm, slot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to delete one key and its data from the flat map.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param key pointer to a location of a value representing key of the pair
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_map_delete_key(flat_map_t * const __restrict__ fm, const void * const __restrict__ key) {
+    /* Check if flat map is allocated */
+    if (NULL == fm) {
+        return SCL_NULL_FLAT_MAP;
+    }
+
+    /* Check if flat map slots are allocated */
+    if (NULL == fm->ctrl) {
+        return SCL_NULL_FLAT_MAP_SLOTS;
+    }
+
+    /* Check if key is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Search the slot of the key */
+    size_t slot = flat_map_find_slot(fm, key);
+
+    /* Check if the key is in the flat map */
+    if (SIZE_MAX == slot) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    flat_map_delete_slot(fm, slot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to call an action function for the data of every
+ * pair from the flat map, in the order of the slots.
+ *
+ * @param fm pointer to an allocated flat map memory location
+ * @param action a pointer function to perform an action on the data of one pair
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t flat_map_traverse(const flat_map_t * const __restrict__ fm, action_func action) {
+    /* Check if flat map is allocated */
+    if (NULL == fm) {
+        return SCL_NULL_FLAT_MAP;
+    }
+
+    /* Check if flat map slots are allocated */
+    if (NULL == fm->ctrl) {
+        return SCL_NULL_FLAT_MAP_SLOTS;
+    }
+
+    /* Check if action function is valid */
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Call the action for every full slot */
+    for (size_t iter = 0; iter < fm->capacity; ++iter) {
+        if (0 <= fm->ctrl[iter]) {
+            action(flat_map_data(fm, iter));
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
@@ -772,3 +772,402 @@ int32_t compare_string(const void * const data1, const void * const data2) {
         return strcmp(typed_data1, typed_data2);
     }
 }
+
+/**
+ * @brief Secret constants of the wyhash algorithm, used to
+ * mix the bytes of the hashed data types.
+ * 
+ */
+static const uint64_t hash_secret[4] = {
+    0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL,
+    0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL
+};
+
+/**
+ * @brief Function to multiply two 64 bits values into a 128 bits value,
+ * the low half is stored into the first value and the high half
+ * into the second value.
+ * 
+ * @param low pointer to the first value, will hold the low half
+ * @param high pointer to the second value, will hold the high half
+ */
+static void hash_mum(uint64_t * const __restrict__ low, uint64_t * const __restrict__ high) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t result = (__uint128_t)(*low) * (*high);
+
+    *low = (uint64_t)result;
+    *high = (uint64_t)(result >> 64);
+#else
+    /* Multiply the 32 bits halves of the values */
+    uint64_t a_high = *low >> 32, a_low = (uint32_t)(*low);
+    uint64_t b_high = *high >> 32, b_low = (uint32_t)(*high);
+
+    uint64_t high_high = a_high * b_high, high_low = a_high * b_low;
+    uint64_t low_high = a_low * b_high, low_low = a_low * b_low;
+
+    uint64_t middle = high_low + low_high;
+    uint64_t middle_carry = (middle < high_low) ? (1ULL << 32) : 0;
+
+    uint64_t result_low = low_low + (middle << 32);
+    uint64_t result_carry = (result_low < low_low);
+
+    *low = result_low;
+    *high = high_high + (middle >> 32) + middle_carry + result_carry;
+#endif
+}
+
+/**
+ * @brief Function to mix two 64 bits values by multiplying them
+ * and by folding the 128 bits result.
+ * 
+ * @param first_value first value to mix
+ * @param second_value second value to mix
+ * @return uint64_t mixed value
+ */
+static uint64_t hash_mix(uint64_t first_value, uint64_t second_value) {
+    hash_mum(&first_value, &second_value);
+
+    return first_value ^ second_value;
+}
+
+/**
+ * @brief Function to load 8 bytes as one word, the
+ * location does not have to be aligned.
+ * 
+ * @param data pointer to the bytes location
+ * @return uint64_t loaded word
+ */
+static uint64_t hash_read_u64(const uint8_t * const data) {
+    uint64_t word = 0;
+    memcpy(&word, data, sizeof(word));
+
+    return word;
+}
+
+/**
+ * @brief Function to load 4 bytes as one word, the
+ * location does not have to be aligned.
+ * 
+ * @param data pointer to the bytes location
+ * @return uint64_t loaded word
+ */
+static uint64_t hash_read_u32(const uint8_t * const data) {
+    uint32_t word = 0;
+    memcpy(&word, data, sizeof(word));
+
+    return word;
+}
+
+/**
+ * @brief Function to mix all the bits of one integer value
+ * (splitmix64 finalizer). The function is a bijection, so
+ * different integers never have the same hash.
+ * 
+ * @param value integer value to mix
+ * @return size_t hash of the integer value
+ */
+static size_t hash_integer(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+
+    return (size_t)(value ^ (value >> 31));
+}
+
+/**
+ * @brief Function to check if the data type
+ * location is valid before hashing it.
+ * 
+ * @param data pointer to data type location
+ */
+static void hash_check_data(const void * const data) {
+    /* Check if data is valid */
+    if (NULL == data) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * @brief Function to hash a block of bytes (wyhash algorithm). The bytes
+ * are loaded 8 at a time and three lanes are mixed in parallel for
+ * long blocks. It is the building block for hashing user defined types.
+ * 
+ * @param data pointer to the bytes location
+ * @param data_size number of bytes to hash
+ * @return size_t hash of the bytes
+ */
+size_t hash_bytes(const void * const data, size_t data_size) {
+    /* Check if data is valid */
+    if ((NULL == data) && (0 != data_size)) {
+        errno = ENODATA;
+        perror("Data is not allocated");
+        exit(EXIT_FAILURE);
+    }
+
+    const uint8_t *iterator = data;
+    uint64_t seed = hash_mix(hash_secret[0], hash_secret[1]);
+    uint64_t first_word = 0, second_word = 0;
+
+    if (data_size <= 16) {
+
+        /* Small blocks are loaded with overlapping words */
+        if (data_size >= 4) {
+            size_t shift = (data_size >> 3) << 2;
+
+            first_word = (hash_read_u32(iterator) << 32) | hash_read_u32(iterator + shift);
+            second_word = (hash_read_u32(iterator + data_size - 4) << 32) | hash_read_u32(iterator + data_size - 4 - shift);
+        } else if (data_size > 0) {
+            first_word = ((uint64_t)iterator[0] << 16) | ((uint64_t)iterator[data_size >> 1] << 8) | iterator[data_size - 1];
+        }
+    } else {
+        size_t bytes_left = data_size;
+
+        /* Mix three lanes of 16 bytes at a time */
+        if (bytes_left > 48) {
+            uint64_t first_lane = seed, second_lane = seed;
+
+            do {
+                seed = hash_mix(hash_read_u64(iterator) ^ hash_secret[1], hash_read_u64(iterator + 8) ^ seed);
+                first_lane = hash_mix(hash_read_u64(iterator + 16) ^ hash_secret[2], hash_read_u64(iterator + 24) ^ first_lane);
+                second_lane = hash_mix(hash_read_u64(iterator + 32) ^ hash_secret[3], hash_read_u64(iterator + 40) ^ second_lane);
+
+                iterator += 48;
+                bytes_left -= 48;
+            } while (bytes_left > 48);
+
+            seed ^= first_lane ^ second_lane;
+        }
+
+        /* Mix the remaining blocks of 16 bytes */
+        while (bytes_left > 16) {
+            seed = hash_mix(hash_read_u64(iterator) ^ hash_secret[1], hash_read_u64(iterator + 8) ^ seed);
+
+            iterator += 16;
+            bytes_left -= 16;
+        }
+
+        /* Last 16 bytes are loaded from the end of the block */
+        first_word = hash_read_u64(iterator + bytes_left - 16);
+        second_word = hash_read_u64(iterator + bytes_left - 8);
+    }
+
+    /* Mix the last words and the length of the block */
+    first_word ^= hash_secret[1];
+    second_word ^= seed;
+
+    hash_mum(&first_word, &second_word);
+
+    return (size_t)hash_mix(first_word ^ hash_secret[0] ^ data_size, second_word ^ hash_secret[1]);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the short int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_short_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const short int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the unsigned short int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_ushort_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const unsigned short int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the unsigned int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_uint(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const unsigned int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the long int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_long_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const long int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the unsigned long int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_ulong_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const unsigned long int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the long long int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_llong_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const long long int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the unsigned long long int data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_ullong_int(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const unsigned long long int * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the char data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_char(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const char * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the unsigned char data type.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_uchar(const void * const data) {
+    hash_check_data(data);
+
+    return hash_integer((uint64_t)*(const unsigned char * const)data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the float data type. Positive and negative
+ * zero are equal, so they have the same hash.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_float(const void * const data) {
+    hash_check_data(data);
+
+    /* Normalize negative zero */
+    float typed_data = *(const float * const)data;
+
+    if (0.0f == typed_data) {
+        typed_data = 0.0f;
+    }
+
+    uint32_t bits = 0;
+    memcpy(&bits, &typed_data, sizeof(bits));
+
+    return hash_integer(bits);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the double data type. Positive and negative
+ * zero are equal, so they have the same hash.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_double(const void * const data) {
+    hash_check_data(data);
+
+    /* Normalize negative zero */
+    double typed_data = *(const double * const)data;
+
+    if (0.0 == typed_data) {
+        typed_data = 0.0;
+    }
+
+    uint64_t bits = 0;
+    memcpy(&bits, &typed_data, sizeof(bits));
+
+    return hash_integer(bits);
+}
+
+/**
+ * @brief Function to hash one element of the long
+ * double data type. The value is hashed as a double,
+ * because the padding bytes of a long double are not
+ * defined, so equal values always have the same hash.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_long_double(const void * const data) {
+    hash_check_data(data);
+
+    double typed_data = (double)*(const long double * const)data;
+
+    return hash_double(&typed_data);
+}
+
+/**
+ * @brief Function to hash one element of
+ * the string data type. Strings equal by
+ * compare_string or compare_string_lexi
+ * have the same hash.
+ * 
+ * @param data pointer to data type location
+ * @return size_t hash of the data type
+ */
+size_t hash_string(const void * const data) {
+    hash_check_data(data);
+
+    return hash_bytes(data, strlen((const char * const)data));
+}
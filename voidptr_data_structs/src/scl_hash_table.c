@@ -25,9 +25,66 @@
 #include "./include/scl_hash_table.h"
 #include "./include/scl_queue.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #define DEFAULT_HASH_CAPACITY 50
 #define DEFAULT_HASH_LOAD_FACTOR 0.75
 #define DEFAULT_HASH_CAPACITY_RATIO 2
+#define DEFAULT_HASH_MAX_ALIGN 16
+#define DEFAULT_HASH_BATCH_SIZE 16
+#define DEFAULT_HASH_FILTER_BLOCK_BITS 512
+#define DEFAULT_HASH_FILTER_MAX_HASHES 16
+#define DEFAULT_HASH_SNAPSHOT_VERSION 1
+#define DEFAULT_HASH_SNAPSHOT_ALIGN 64
+#define DEFAULT_HASH_SNAPSHOT_BYTE_ORDER 0x01020304
+
+#if defined(__GNUC__)
+#define HASH_TABLE_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+#define HASH_TABLE_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * @brief Function to compute the alignment of a data type knowing
+ * just its length in bytes. The alignment of any data type divides its
+ * length, so the lowest set bit of the length is a safe alignment.
+ * 
+ * @param type_size length in bytes of the data type
+ * @return size_t alignment in bytes of the data type
+ */
+static size_t hash_table_type_align(size_t type_size) {
+    /* Isolate the lowest set bit of the length */
+    size_t type_align = type_size & (~type_size + 1);
+
+    /* No fundamental data type needs a greater alignment */
+    if (DEFAULT_HASH_MAX_ALIGN < type_align) {
+        type_align = DEFAULT_HASH_MAX_ALIGN;
+    }
+
+    return type_align;
+}
+
+/**
+ * @brief Function to compute the layout of one inline {key, data} pair,
+ * the data is placed after the key at its own alignment and the whole
+ * pair is rounded up to the greatest alignment of the two types.
+ * 
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @param data_offset pointer to write the offset in bytes of the data inside one pair
+ * @param entry_size pointer to write the length in bytes of one pair
+ */
+static void hash_table_entry_layout(size_t key_size, size_t data_size, size_t * const __restrict__ data_offset, size_t * const __restrict__ entry_size) {
+    size_t key_align = hash_table_type_align(key_size);
+    size_t data_align = hash_table_type_align(data_size);
+    size_t entry_align = (key_align > data_align) ? key_align : data_align;
+
+    *data_offset = (key_size + data_align - 1) / data_align * data_align;
+    *entry_size = (*data_offset + data_size + entry_align - 1) / entry_align * entry_align;
+}
 
 /**
  * @brief Create a hash table object. Allocation may fail if there is not enough
@@ -44,6 +101,32 @@
  * @return hash_table_t* a new allocated hash table object or `NULL` (if function fails)
  */
 hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size) {
+    /* Buckets are red black trees by default */
+    return create_hash_table_with_engine(init_capacity, hash, cmp_key, cmp_dt, frd_key, frd_dt, key_size, data_size, HASH_ENGINE_RBK);
+}
+
+/**
+ * @brief Create a hash table object using the selected storage engine.
+ * HASH_ENGINE_RBK keeps every bucket as a red black tree of nodes, while
+ * HASH_ENGINE_LINEAR and HASH_ENGINE_ROBIN_HOOD store the {key, data} pairs
+ * inline in flat arrays (open addressing), so one lookup will touch one or two
+ * cache lines instead of chasing node pointers. For the open addressing engines
+ * the pointers returned by find functions are valid until the next insertion
+ * or deletion. Allocation may fail if there is not enough memory on heap,
+ * compare or hash functions are not valid.
+ * 
+ * @param init_capacity initial capacity for the hash table (should be >= |All data| * 0.75)
+ * @param hash pointer to a function to hash the key into a size_t type (should not apply modulo)
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param cmp_dt pointer to a function to compare two sets of data
+ * @param frd_key pointer to a function to free memory allocated for the CONTENT of the key pointer
+ * @param frd_dt pointer to a function to free memory allocated for the CONTENT of the data pointer
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @param engine storage engine of the hash table
+ * @return hash_table_t* a new allocated hash table object or `NULL` (if function fails)
+ */
+hash_table_t* create_hash_table_with_engine(size_t init_capacity, hash_func hash, compare_func cmp_key, compare_func cmp_dt, free_func frd_key, free_func frd_dt, size_t key_size, size_t data_size, hash_table_engine_t engine) {
     /* Check if hash function and compare function are valid */
     if ((NULL == hash) || (NULL == cmp_key) || (NULL == cmp_dt)) {
         errno = EINVAL;
@@ -58,6 +141,13 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
         return NULL;
     }
 
+    /* Check if storage engine is known */
+    if ((HASH_ENGINE_RBK != engine) && (HASH_ENGINE_LINEAR != engine) && (HASH_ENGINE_ROBIN_HOOD != engine)) {
+        errno = EINVAL;
+        perror("Unknown storage engine for hash_table");
+        return NULL;
+    }
+
     /* Check if initial capacity is valid if not set it as default value */
     if (10 >= init_capacity) {
         init_capacity = DEFAULT_HASH_CAPACITY;
@@ -67,75 +157,450 @@ hash_table_t* create_hash_table(size_t init_capacity, hash_func hash, compare_fu
     hash_table_t *new_hash_table = malloc(sizeof(*new_hash_table));
 
     /* Check if hash table was allocated successfully */
-    if (NULL != new_hash_table) {
-
-        /* Set function pointers of the hash table */
-        new_hash_table->hash = hash;
-        new_hash_table->cmp_key = cmp_key;
-        new_hash_table->cmp_dt = cmp_dt;
-        new_hash_table->frd_key = frd_key;
-        new_hash_table->frd_dt = frd_dt;
-
-        /* Set capacity and default size of the hash table */
-        new_hash_table->key_size = key_size;
-        new_hash_table->data_size = data_size;
-        new_hash_table->capacity = init_capacity;
-        new_hash_table->size = 0;
-
-        /* Create the black hole node */
-        new_hash_table->nil = malloc(sizeof(*new_hash_table->nil));
-
-        /* Check if black hole node was created */
-        if (NULL != new_hash_table->nil) {
-
-            /* Set functionality for black hole node */
-            new_hash_table->nil->key = NULL;
-            new_hash_table->nil->data = NULL;
-            new_hash_table->nil->color = HASH_BLACK;
-            new_hash_table->nil->count = 1;
-            new_hash_table->nil->left = new_hash_table->nil->right = new_hash_table->nil;
-            new_hash_table->nil->parent = new_hash_table->nil;
-
-            /* Allocate all buckets from hash table */
-            new_hash_table->buckets = malloc(sizeof(*new_hash_table->buckets) * init_capacity);
-
-            /* Check if buckets were allocated successfully */
-            if (NULL != new_hash_table->buckets) {
-
-                /* Set every bucket to point to black hole node */
-                for (size_t iter = 0; iter < init_capacity; ++iter) {
-                    new_hash_table->buckets[iter] = new_hash_table->nil;
-                }
-            } else {
+    if (NULL == new_hash_table) {
+
+        /* Hash table was not allocated return `NULL` */
+        errno = ENOMEM;
+        perror("Not enough memory for hash table allocation");
+
+        return NULL;
+    }
+
+    /* Set function pointers of the hash table */
+    new_hash_table->hash = hash;
+    new_hash_table->cmp_key = cmp_key;
+    new_hash_table->cmp_dt = cmp_dt;
+    new_hash_table->frd_key = frd_key;
+    new_hash_table->frd_dt = frd_dt;
+
+    /* Set capacity and default size of the hash table */
+    new_hash_table->key_size = key_size;
+    new_hash_table->data_size = data_size;
+    new_hash_table->capacity = init_capacity;
+    new_hash_table->size = 0;
+
+    /* Set the storage engine members */
+    new_hash_table->engine = engine;
+    new_hash_table->buckets = NULL;
+    new_hash_table->nil = NULL;
+    new_hash_table->slots = NULL;
+    new_hash_table->entries = NULL;
+    new_hash_table->swap_entry = NULL;
+
+    /* Set the incremental rehashing members */
+    new_hash_table->old_buckets = NULL;
+    new_hash_table->old_capacity = 0;
+    new_hash_table->rehash_index = 0;
+    new_hash_table->rehash_step = 0;
+
+    /* Select buckets with the modulo of the capacity by default */
+    new_hash_table->pow2_capacity = 0;
+
+    /* Never shrink the hash table by default */
+    new_hash_table->shrink_load_factor = 0;
+
+    /* No membership filter by default */
+    new_hash_table->filter = NULL;
+
+    new_hash_table->number_of_rehashes = 0;
+
+    /* Compute the layout of one inline {key, data} pair */
+    hash_table_entry_layout(key_size, data_size, &new_hash_table->data_offset, &new_hash_table->entry_size);
+
+    if (HASH_ENGINE_RBK != engine) {
+
+        /* Allocate the open addressing arrays, all slots are empty */
+        new_hash_table->slots = calloc(init_capacity, sizeof(*new_hash_table->slots));
+        new_hash_table->entries = malloc(new_hash_table->entry_size * init_capacity);
+        new_hash_table->swap_entry = malloc(new_hash_table->entry_size);
+
+        /* Check if slots were allocated successfully */
+        if ((NULL == new_hash_table->slots) || (NULL == new_hash_table->entries) || (NULL == new_hash_table->swap_entry)) {
+
+            /* Slots were not allocated wipe hash table's memory */
+            free(new_hash_table->slots);
+            free(new_hash_table->entries);
+            free(new_hash_table->swap_entry);
+            free(new_hash_table);
+            new_hash_table = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for slots of hash table");
+        }
+
+        /* Return an allocated hash table or `NULL` */
+        return new_hash_table;
+    }
+
+    /* Create the black hole node */
+    new_hash_table->nil = malloc(sizeof(*new_hash_table->nil));
+
+    /* Check if black hole node was created */
+    if (NULL != new_hash_table->nil) {
+
+        /* Set functionality for black hole node */
+        new_hash_table->nil->key = NULL;
+        new_hash_table->nil->data = NULL;
+        new_hash_table->nil->color = HASH_BLACK;
+        new_hash_table->nil->count = 1;
+        new_hash_table->nil->left = new_hash_table->nil->right = new_hash_table->nil;
+        new_hash_table->nil->parent = new_hash_table->nil;
+
+        /* Allocate all buckets from hash table */
+        new_hash_table->buckets = malloc(sizeof(*new_hash_table->buckets) * init_capacity);
 
-                /* Trees were not allocated wipe hash table's memory */
-                free(new_hash_table->nil);
-                free(new_hash_table);
-                new_hash_table = NULL;
+        /* Check if buckets were allocated successfully */
+        if (NULL != new_hash_table->buckets) {
 
-                errno = ENOMEM;
-                perror("Not enough memory for buckets of hash table");
+            /* Set every bucket to point to black hole node */
+            for (size_t iter = 0; iter < init_capacity; ++iter) {
+                new_hash_table->buckets[iter] = new_hash_table->nil;
             }
         } else {
 
-            /* Black hole node was not allocated wipe hash table's mempry */
+            /* Trees were not allocated wipe hash table's memory */
+            free(new_hash_table->nil);
             free(new_hash_table);
             new_hash_table = NULL;
 
             errno = ENOMEM;
-            perror("Not enough memory for nil hash table allocation");
+            perror("Not enough memory for buckets of hash table");
         }
     } else {
 
-        /* Hash table was not allocated return `NULL` */
+        /* Black hole node was not allocated wipe hash table's mempry */
+        free(new_hash_table);
+        new_hash_table = NULL;
+
         errno = ENOMEM;
-        perror("Not enough memory for hash table allocation");
+        perror("Not enough memory for nil hash table allocation");
     }
 
     /* Return an allocated hash table or `NULL` */
     return new_hash_table;
 }
 
+/**
+ * @brief Function to mix all the bits of a hash value (fmix64 finalizer of
+ * MurmurHash3), so the low bits selected by a mask depend on the whole hash.
+ * It protects power of two hash tables against weak hash functions.
+ * 
+ * @param hash hash value of one key computed with hash function of the table
+ * @return size_t mixed hash value
+ */
+static size_t hash_table_mix_hash(size_t hash) {
+    uint64_t mixed_hash = (uint64_t)hash;
+
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xff51afd7ed558ccdULL;
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+    mixed_hash ^= mixed_hash >> 33;
+
+    return (size_t)mixed_hash;
+}
+
+/**
+ * @brief Function to compute the index of the bucket of one hash value for
+ * a buckets array with the selected capacity. Power of two hash tables mix
+ * the hash and select the bucket with a mask instead of a division.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of one key computed with hash function of the table
+ * @param capacity number of buckets of the working buckets array
+ * @return size_t index of the bucket of the hash value
+ */
+static size_t hash_table_hash_index(const hash_table_t * const __restrict__ ht, size_t hash, size_t capacity) {
+    if (0 != ht->pow2_capacity) {
+        return hash_table_mix_hash(hash) & (capacity - 1);
+    }
+
+    return hash % capacity;
+}
+
+/**
+ * @brief Function to compute the index of the bucket (the home slot for
+ * open addressing engines) of one key type value.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return size_t index of the bucket of the key
+ */
+static size_t hash_table_bucket_index(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    return hash_table_hash_index(ht, ht->hash(key), ht->capacity);
+}
+
+/**
+ * @brief Function to round up a capacity to the next power of two.
+ * 
+ * @param capacity number of buckets to round up
+ * @return size_t smallest power of two greater than or equal to capacity
+ */
+static size_t hash_table_round_pow2(size_t capacity) {
+    size_t pow2 = 1;
+
+    while (pow2 < capacity) {
+        pow2 <<= 1;
+    }
+
+    return pow2;
+}
+
+/**
+ * @brief Function to count the set bits of one word.
+ * 
+ * @param word word to count its bits
+ * @return size_t number of set bits
+ */
+static size_t hash_table_popcount(uint64_t word) {
+#if defined(__GNUC__)
+    return (size_t)__builtin_popcountll(word);
+#else
+    size_t count = 0;
+
+    while (0 != word) {
+        word &= word - 1;
+        ++count;
+    }
+
+    return count;
+#endif
+}
+
+/**
+ * @brief Function to compute the number of blocks of the membership
+ * filter sized for the maximum number of pairs a capacity can hold.
+ * 
+ * @param filter pointer to an allocated membership filter
+ * @param capacity capacity of the hash table
+ * @return size_t number of blocks of the filter (at least one)
+ */
+static size_t hash_table_filter_number_of_blocks(const hash_table_filter_t * const __restrict__ filter, size_t capacity) {
+    size_t number_of_bits = (size_t)(capacity * DEFAULT_HASH_LOAD_FACTOR * filter->bits_per_key) + 1;
+
+    return (number_of_bits + DEFAULT_HASH_FILTER_BLOCK_BITS - 1) / DEFAULT_HASH_FILTER_BLOCK_BITS;
+}
+
+/**
+ * @brief Function to allocate the zeroed bits of a membership filter,
+ * every block is aligned to one cache line.
+ * 
+ * @param number_of_blocks number of blocks to allocate
+ * @return uint64_t* pointer to the allocated bits or `NULL`
+ */
+static uint64_t* hash_table_filter_alloc_blocks(size_t number_of_blocks) {
+    uint64_t *blocks = aligned_alloc(DEFAULT_HASH_FILTER_BLOCK_BITS / 8, number_of_blocks * (DEFAULT_HASH_FILTER_BLOCK_BITS / 8));
+
+    if (NULL != blocks) {
+        memset(blocks, 0, number_of_blocks * (DEFAULT_HASH_FILTER_BLOCK_BITS / 8));
+    }
+
+    return blocks;
+}
+
+/**
+ * @brief Function to set or to test the bits of one key inside a blocked
+ * bloom filter. All the bits of a key are in one block, selected with the
+ * high half of the mixed hash, so one key touches one cache line.
+ * 
+ * @param blocks pointer to the bits of the filter
+ * @param number_of_blocks number of blocks of the filter
+ * @param number_of_hashes number of bits of one key
+ * @param hash hash value of the key computed with hash function of the table
+ * @param set_bits 1 to set the bits of the key, 0 just to test them
+ * @return uint8_t 1 if all bits of the key are set, 0 otherwise
+ */
+static uint8_t hash_table_filter_bits(uint64_t * const __restrict__ blocks, size_t number_of_blocks, uint32_t number_of_hashes, size_t hash, uint8_t set_bits) {
+    uint64_t mixed_hash = hash_table_mix_hash(hash);
+
+    /* Select the block without a division */
+    uint64_t * const block = blocks + (size_t)(((mixed_hash >> 32) * number_of_blocks) >> 32) * (DEFAULT_HASH_FILTER_BLOCK_BITS / 64);
+
+    /* Derive the bit positions by double hashing */
+    uint32_t bit_hash = (uint32_t)mixed_hash;
+    uint32_t bit_step = (uint32_t)((mixed_hash * 0x9e3779b97f4a7c15ULL) >> 32) | 1;
+
+    for (uint32_t iter = 0; iter < number_of_hashes; ++iter) {
+        uint32_t bit = bit_hash & (DEFAULT_HASH_FILTER_BLOCK_BITS - 1);
+        uint64_t mask = (uint64_t)1 << (bit & 63);
+
+        if (0 != set_bits) {
+            block[bit >> 6] |= mask;
+        } else if (0 == (block[bit >> 6] & mask)) {
+            return 0;
+        }
+
+        bit_hash += bit_step;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Function to add one key into the membership filter of the hash
+ * table, and into the filter being rebuilt if the hash table is resized.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of the key computed with hash function of the table
+ */
+static void hash_table_filter_insert(const hash_table_t * const __restrict__ ht, size_t hash) {
+    hash_table_filter_t * const filter = ht->filter;
+
+    if (NULL == filter) {
+        return;
+    }
+
+    hash_table_filter_bits(filter->blocks, filter->number_of_blocks, filter->number_of_hashes, hash, 1);
+
+    if (NULL != filter->next_blocks) {
+        hash_table_filter_bits(filter->next_blocks, filter->next_number_of_blocks, filter->number_of_hashes, hash, 1);
+    }
+}
+
+/**
+ * @brief Function to add one moved key into the filter being rebuilt.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of the key computed with hash function of the table
+ */
+static void hash_table_filter_rebuild_insert(const hash_table_t * const __restrict__ ht, size_t hash) {
+    hash_table_filter_t * const filter = ht->filter;
+
+    if ((NULL != filter) && (NULL != filter->next_blocks)) {
+        hash_table_filter_bits(filter->next_blocks, filter->next_number_of_blocks, filter->number_of_hashes, hash, 1);
+    }
+}
+
+/**
+ * @brief Function to start rebuilding the membership filter for a new
+ * capacity. The keys are added into the new filter while they are moved
+ * into the new buckets, until then the old filter is still used. If the
+ * new filter cannot be allocated the old one is kept, it holds all the keys.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param new_capacity capacity of the hash table after resizing
+ */
+static void hash_table_filter_rebuild_start(const hash_table_t * const __restrict__ ht, size_t new_capacity) {
+    hash_table_filter_t * const filter = ht->filter;
+
+    if (NULL == filter) {
+        return;
+    }
+
+    free(filter->next_blocks);
+
+    filter->next_number_of_blocks = hash_table_filter_number_of_blocks(filter, new_capacity);
+    filter->next_blocks = hash_table_filter_alloc_blocks(filter->next_number_of_blocks);
+}
+
+/**
+ * @brief Function to replace the membership filter with the rebuilt one,
+ * after all the keys were moved into the new buckets. The bits of the
+ * deleted keys are dropped.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ */
+static void hash_table_filter_rebuild_finish(const hash_table_t * const __restrict__ ht) {
+    hash_table_filter_t * const filter = ht->filter;
+
+    if ((NULL == filter) || (NULL == filter->next_blocks)) {
+        return;
+    }
+
+    free(filter->blocks);
+
+    filter->blocks = filter->next_blocks;
+    filter->number_of_blocks = filter->next_number_of_blocks;
+
+    filter->next_blocks = NULL;
+    filter->next_number_of_blocks = 0;
+}
+
+/**
+ * @brief Function to check the membership filter before searching a key.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of the key computed with hash function of the table
+ * @return uint8_t 0 if the key is surely not in the hash table, 1 if it may be
+ */
+static uint8_t hash_table_filter_may_contain(const hash_table_t * const __restrict__ ht, size_t hash) {
+    const hash_table_filter_t * const filter = ht->filter;
+
+    if (NULL == filter) {
+        return 1;
+    }
+
+    return hash_table_filter_bits(filter->blocks, filter->number_of_blocks, filter->number_of_hashes, hash, 0);
+}
+
+/**
+ * @brief Function to delete all memory of the membership filter.
+ * 
+ * @param filter pointer to an allocated membership filter or `NULL`
+ */
+static void free_hash_table_filter(hash_table_filter_t * const __restrict__ filter) {
+    if (NULL != filter) {
+        free(filter->blocks);
+        free(filter->next_blocks);
+        free(filter);
+    }
+}
+
+/**
+ * @brief Function to fold a hash value into the tag stored
+ * in one open addressing slot.
+ * 
+ * @param hash hash value of one key computed with hash function of the table
+ * @return uint32_t tag of the key
+ */
+static uint32_t hash_table_flat_tag(size_t hash) {
+    return (uint32_t)((uint64_t)hash ^ ((uint64_t)hash >> 32));
+}
+
+/**
+ * @brief Function to get the location of the key stored
+ * inline in one open addressing slot.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param slot index of the slot
+ * @return void* pointer to the key of the selected slot
+ */
+static void* hash_table_flat_key(const hash_table_t * const __restrict__ ht, size_t slot) {
+    return ht->entries + slot * ht->entry_size;
+}
+
+/**
+ * @brief Function to get the location of the data stored
+ * inline in one open addressing slot.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param slot index of the slot
+ * @return void* pointer to the data of the selected slot
+ */
+static void* hash_table_flat_data(const hash_table_t * const __restrict__ ht, size_t slot) {
+    return ht->entries + slot * ht->entry_size + ht->data_offset;
+}
+
+/**
+ * @brief Function to delete the content of the {key, data} pair
+ * stored inline in one open addressing slot. The slot itself is not
+ * marked as empty.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param slot index of the slot to free
+ */
+static void free_hash_table_flat_entry(const hash_table_t * const __restrict__ ht, size_t slot) {
+    /* Check if content of the data was allocated dynamically */
+    if (NULL != ht->frd_dt) {
+        ht->frd_dt(hash_table_flat_data(ht, slot));
+    }
+
+    /* Check if content of the key was allocated dynamically */
+    if (NULL != ht->frd_key) {
+        ht->frd_key(hash_table_flat_key(ht, slot));
+    }
+}
+
 /**
  * @brief Function to delete memory of selected node of the
  * hash table from heap zone
@@ -152,31 +617,13 @@ static void free_hash_table_node(const hash_table_t * const __restrict__ ht, has
             ht->frd_dt((*free_node)->data);
         }
 
-        /* Free data pointer of the node */
-        if (NULL != (*free_node)->data) {
-            free((*free_node)->data);
-        }
-
-        /* Point to default value */
-        (*free_node)->data = NULL;
-
-        /* Check if content of the data node was allocated dynamically */
+        /* Check if content of the key node was allocated dynamically */
         if ((NULL != ht->frd_key) && (NULL != (*free_node)->key)) {
             ht->frd_key((*free_node)->key);
         }
 
-        /* Free key pointer of the node */
-        if (NULL != (*free_node)->key) {
-            free((*free_node)->key);
-        }
-
-        /* Point to default value */
-        (*free_node)->key = NULL;
-
-        /* Free hash table node from heap */
-        if (ht->nil != *free_node) {
-            free(*free_node);
-        }
+        /* Key and data live inside the node, free the whole block */
+        free(*free_node);
 
         /* Point to default value */
         *free_node = ht->nil;
@@ -217,6 +664,27 @@ scl_error_t free_hash_table(hash_table_t * const __restrict__ ht) {
     /* Check if hash table can be freed */
     if (NULL != ht) {
 
+        /* Check if open addressing slots are allocated */
+        if (NULL != ht->slots) {
+
+            /* Free the content of every occupied slot */
+            for (size_t iter = 0; iter < ht->capacity; ++iter) {
+                if (0 != ht->slots[iter].dist) {
+                    free_hash_table_flat_entry(ht, iter);
+                }
+            }
+
+            /* Free memory for slots arrays */
+            free(ht->slots);
+            ht->slots = NULL;
+
+            free(ht->entries);
+            ht->entries = NULL;
+
+            free(ht->swap_entry);
+            ht->swap_entry = NULL;
+        }
+
         /* Check if hash table roots are allocated */
         if (NULL != ht->buckets) {
 
@@ -225,6 +693,16 @@ scl_error_t free_hash_table(hash_table_t * const __restrict__ ht) {
                 free_hash_table_helper(ht, &ht->buckets[iter]);
             }
 
+            /* Free the old trees not moved yet by incremental rehashing */
+            if (NULL != ht->old_buckets) {
+                for (size_t iter = 0; iter < ht->old_capacity; ++iter) {
+                    free_hash_table_helper(ht, &ht->old_buckets[iter]);
+                }
+
+                free(ht->old_buckets);
+                ht->old_buckets = NULL;
+            }
+
             /* Free memory for the black hole node */
             free(ht->nil);
             ht->nil = NULL;
@@ -234,6 +712,10 @@ scl_error_t free_hash_table(hash_table_t * const __restrict__ ht) {
             ht->buckets = NULL;
         }
 
+        /* Free memory of the membership filter */
+        free_hash_table_filter(ht->filter);
+        ht->filter = NULL;
+
         /* Free memory of the hash table */
         free(ht);
 
@@ -260,8 +742,8 @@ static hash_table_node_t* create_hash_table_node(const hash_table_t * const __re
         return ht->nil;
     }
 
-    /* Allocate a new hash table node */
-    hash_table_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new hash table node together with its {key, data} pair */
+    hash_table_node_t *new_node = malloc(sizeof(*new_node) + ht->entry_size);
 
     /* Check if node was allocated successfully */
     if (NULL != new_node) {
@@ -272,47 +754,16 @@ static hash_table_node_t* create_hash_table_node(const hash_table_t * const __re
         new_node->count = 1;
         new_node->color = HASH_RED;
 
-        /* Allocate memory for data value */
-        new_node->data = malloc(ht->data_size);
-
-        /* Check if data memory was allocated */
-        if (NULL != new_node->data) {
-
-            /* 
-             * Copy all bytes from data pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->data, data, ht->data_size);
-        } else {
-
-            /* Data memory was not allocated wipe node's memory */
-            free(new_node);
-            new_node = ht->nil;
-
-            errno = ENOMEM;
-            perror("Not enough memory for node hash table data allocation");
-        }
-
-        /* Allocate memory for key value */
-        new_node->key = malloc(ht->key_size);
-
-        /* Check if key memory was allocated */
-        if (NULL != new_node->key) {
-
-            /* 
-             * Copy all bytes from key pointer
-             * to memory allocated on heap
-             */
-            memcpy(new_node->key, key, ht->key_size);
-        } else {
-
-            /* Key memory was not allocated wipe node's memory */
-            free(new_node->data);
-            new_node->data = NULL;
+        /* Key and data are laid out as one inline pair after the node */
+        new_node->key = new_node->entry;
+        new_node->data = new_node->entry + ht->data_offset;
 
-            free(new_node);
-            new_node = ht->nil;
-        }
+        /* 
+         * Copy all bytes from key and data pointers
+         * to memory allocated on heap
+         */
+        memcpy(new_node->key, key, ht->key_size);
+        memcpy(new_node->data, data, ht->data_size);
     } else {
 
         /* Node memory was not allocated, set default value */
@@ -589,36 +1040,370 @@ static scl_error_t hash_table_insert_fix_node_up(const hash_table_t * const __re
 static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht);
 
 /**
- * @brief 
+ * @brief Function to search the open addressing slot holding the
+ * key specified in input. Slots are probed starting from the home slot
+ * of the key, the tag of every slot is checked before comparing the keys.
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
- * @return scl_error_t enum object for handling errors
+ * @param hash hash value of the key computed with hash function of the table
+ * @return size_t index of the slot holding the key or SIZE_MAX if key is not found
  */
-scl_error_t hash_table_insert(hash_table_t * const __restrict__ ht, const void *key, const void *data) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
+static size_t hash_table_flat_find_slot(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key, size_t hash) {
+    /* Compute tag and home slot of the key */
+    uint32_t tag = hash_table_flat_tag(hash);
+    size_t slot = hash_table_hash_index(ht, hash, ht->capacity);
+
+    /* Probe slots until an empty one is found */
+    for (size_t dist = 1; (0 != ht->slots[slot].dist) && (dist <= ht->capacity); ++dist) {
+
+        /*
+         * Robin hood keeps every probe sequence sorted by distance,
+         * a closer pair means that the key cannot be further
+         */
+        if ((HASH_ENGINE_ROBIN_HOOD == ht->engine) && (ht->slots[slot].dist < dist)) {
+            break;
+        }
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
+        /* Compare keys just if the tags are the same */
+        if ((tag == ht->slots[slot].tag) && (0 == ht->cmp_key(hash_table_flat_key(ht, slot), key))) {
+            return slot;
+        }
+
+        /* Go to the next slot */
+        if (ht->capacity == ++slot) {
+            slot = 0;
+        }
+    }
+
+    /* Key was not found */
+    return SIZE_MAX;
+}
+
+/**
+ * @brief Function to swap the bytes of two memory locations
+ * having the same length, without any auxiliary buffer.
+ * 
+ * @param first_entry pointer to first memory location
+ * @param second_entry pointer to second memory location
+ * @param entry_size length in bytes of the memory locations
+ */
+static void hash_table_flat_swap_bytes(uint8_t * const __restrict__ first_entry, uint8_t * const __restrict__ second_entry, size_t entry_size) {
+    for (size_t iter = 0; iter < entry_size; ++iter) {
+        uint8_t temp = first_entry[iter];
+        first_entry[iter] = second_entry[iter];
+        second_entry[iter] = temp;
+    }
+}
+
+/**
+ * @brief Function to place a {key, data} pair into the open addressing
+ * slots of the hash table. Function does not check if key already exists
+ * and it does not change the size of the hash table. For robin hood engine
+ * every pair that is closer to its home slot than the carried pair is
+ * displaced further.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of the key computed with hash function of the table
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ */
+static void hash_table_flat_place(hash_table_t * const __restrict__ ht, size_t hash, const void * const key, const void * const data) {
+    /* Copy the pair into the carried entry */
+    memcpy(ht->swap_entry, key, ht->key_size);
+    memcpy(ht->swap_entry + ht->data_offset, data, ht->data_size);
+
+    /* Set metadata of the carried entry */
+    hash_table_slot_t carried = { .dist = 1, .tag = hash_table_flat_tag(hash) };
+    size_t slot = hash_table_hash_index(ht, hash, ht->capacity);
+
+    /* Find an empty slot for the carried pair */
+    while (0 != ht->slots[slot].dist) {
+
+        /* Take the slot from a richer pair and carry it further */
+        if ((HASH_ENGINE_ROBIN_HOOD == ht->engine) && (ht->slots[slot].dist < carried.dist)) {
+            hash_table_flat_swap_bytes(ht->swap_entry, hash_table_flat_key(ht, slot), ht->entry_size);
+
+            hash_table_slot_t temp = ht->slots[slot];
+            ht->slots[slot] = carried;
+            carried = temp;
+        }
+
+        /* Go to the next slot */
+        ++(carried.dist);
+
+        if (ht->capacity == ++slot) {
+            slot = 0;
+        }
+    }
+
+    /* Store the carried pair into the empty slot */
+    memcpy(hash_table_flat_key(ht, slot), ht->swap_entry, ht->entry_size);
+    ht->slots[slot] = carried;
+}
+
+/**
+ * @brief Function to remove a {key, data} pair from an open addressing
+ * slot. The following pairs of the cluster are moved back so no tombstone
+ * is needed and every pair stays reachable from its home slot.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param slot index of the slot to delete
+ */
+static void hash_table_flat_delete_slot(hash_table_t * const __restrict__ ht, size_t slot) {
+    /* Free the content of the pair */
+    free_hash_table_flat_entry(ht, slot);
+
+    /* Index of the next slot to check */
+    size_t next_slot = (slot + 1) % ht->capacity;
+
+    if (HASH_ENGINE_ROBIN_HOOD == ht->engine) {
+
+        /* Shift back every pair that is not in its home slot */
+        while (1 < ht->slots[next_slot].dist) {
+            memcpy(hash_table_flat_key(ht, slot), hash_table_flat_key(ht, next_slot), ht->entry_size);
+            ht->slots[slot] = ht->slots[next_slot];
+            --(ht->slots[slot].dist);
+
+            slot = next_slot;
+            next_slot = (next_slot + 1) % ht->capacity;
+        }
+    } else {
+
+        /*
+         * Linear probing does not keep clusters sorted, so move back
+         * just the pairs whose home slot is not between the empty
+         * slot and their current slot
+         */
+        while (0 != ht->slots[next_slot].dist) {
+            size_t home_slot = (next_slot + ht->capacity - (ht->slots[next_slot].dist - 1)) % ht->capacity;
+            uint8_t can_stay = 0;
+
+            if (slot <= next_slot) {
+                can_stay = ((slot < home_slot) && (home_slot <= next_slot));
+            } else {
+                can_stay = ((slot < home_slot) || (home_slot <= next_slot));
+            }
+
+            if (0 == can_stay) {
+                memcpy(hash_table_flat_key(ht, slot), hash_table_flat_key(ht, next_slot), ht->entry_size);
+                ht->slots[slot] = ht->slots[next_slot];
+                ht->slots[slot].dist = (uint32_t)((slot + ht->capacity - home_slot) % ht->capacity + 1);
+
+                slot = next_slot;
+            }
+
+            next_slot = (next_slot + 1) % ht->capacity;
+        }
+    }
+
+    /* Mark the last moved slot as empty */
+    ht->slots[slot].dist = 0;
+
+    /* Decrease hash table size */
+    --(ht->size);
+}
+
+/**
+ * @brief Function to insert a {key, data} pair into an open addressing
+ * hash table. If key already exists the hash table is not changed.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @param hash hash value of the key computed with hash function of the table
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_flat_insert(hash_table_t * const __restrict__ ht, const void * const key, const void * const data, size_t hash) {
+    /* Check if open addressing slots are allocated */
+    if (NULL == ht->slots) {
         return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Check if key pointer is not `NULL` */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
+    /* Key already exists in the hash table */
+    if (SIZE_MAX != hash_table_flat_find_slot(ht, key, hash)) {
+        return SCL_OK;
     }
 
-    /* Check if data pointer is not `NULL` */
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
+    /* Last rehashing failed, keep at least one empty slot */
+    if (ht->size + 1 >= ht->capacity) {
+        return SCL_REHASHING_FAILED;
+    }
+
+    /* Place the new pair and increase hash table size */
+    hash_table_flat_place(ht, hash, key, data);
+    hash_table_filter_insert(ht, hash);
+    ++(ht->size);
+
+    /* Check if has table needs to be rehashed */
+    if (1 == hash_table_need_to_rehash(ht)) {
+        return hash_table_rehash(ht);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to count the pairs of an open addressing hash table
+ * having the same home slot. All of them are stored in the cluster
+ * starting from the home slot.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param home_slot index of the home slot (bucket)
+ * @return size_t number of pairs having the selected home slot
+ */
+static size_t hash_table_flat_count_home(const hash_table_t * const __restrict__ ht, size_t home_slot) {
+    size_t total_pairs = 0;
+    size_t slot = home_slot;
+
+    /* A pair is at distance `dist` from the home slot just if its home is the same */
+    for (size_t dist = 1; (0 != ht->slots[slot].dist) && (dist <= ht->capacity); ++dist) {
+        if (dist == ht->slots[slot].dist) {
+            ++total_pairs;
+        }
+
+        if (ht->capacity == ++slot) {
+            slot = 0;
+        }
+    }
+
+    /* Return the number of pairs */
+    return total_pairs;
+}
+
+/**
+ * @brief Function to delete all the pairs of an open addressing
+ * hash table having the same home slot.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param home_slot index of the home slot (bucket)
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_flat_delete_home(hash_table_t * const __restrict__ ht, size_t home_slot) {
+    size_t total_deleted = 0;
+    size_t slot = home_slot;
+
+    for (size_t dist = 1; (0 != ht->slots[slot].dist) && (dist <= ht->capacity);) {
+        if (dist == ht->slots[slot].dist) {
+
+            /* Slot will be filled with the next pair of the cluster, check it again */
+            hash_table_flat_delete_slot(ht, slot);
+            ++total_deleted;
+        } else {
+            if (ht->capacity == ++slot) {
+                slot = 0;
+            }
+
+            ++dist;
+        }
+    }
+
+    /* Bucket had no pair */
+    if (0 == total_deleted) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to perform one action on one slot of an open addressing
+ * hash table. Every slot holds at most one pair so all traversal orders of
+ * one bucket are the same.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the slot from hash table
+ * @param action a pointer function to perform an action on one hash table pair
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_flat_bucket_traverse(const hash_table_t * const __restrict__ ht, size_t bucket_index, action_func action) {
+    /* Check if open addressing slots are allocated */
+    if (NULL == ht->slots) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Make sure that bucket index does not exceed hash capacity */
+    bucket_index = bucket_index % ht->capacity;
+
+    printf("(%ld): ", bucket_index);
+
+    if (0 == ht->slots[bucket_index].dist) {
+
+        /* Slot is empty no pair to traverse */
+        printf("(Null)");
+    } else {
+
+        /* Call action function on the slot data */
+        action(hash_table_flat_data(ht, bucket_index));
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to migrate a bounded number of buckets from the old
+ * buckets array into the new one, while an incremental rehashing is in
+ * progress. The old bucket of the key (if key is not `NULL`) is migrated
+ * first so the key can be searched, inserted or deleted just in the new
+ * buckets array.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash or `NULL`
+ */
+static void hash_table_rehash_advance(hash_table_t * const __restrict__ ht, const void * const __restrict__ key);
+
+/**
+ * @brief Subroutine function to link one node under its parent node found
+ * by searching the bucket, and to fix the bucket as a red black tree. If the
+ * parent node is `nil` the node becomes the root of the bucket.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the working red black tree from hash table
+ * @param parent_node pointer to the parent of the new node or `nil`
+ * @param new_node pointer to a hash table node to link into the bucket
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_bucket_attach(hash_table_t * const __restrict__ ht, size_t bucket_index, hash_table_node_t * const parent_node, hash_table_node_t * const new_node) {
+    if (ht->nil != parent_node) {
+
+        /* Update parent links */
+        new_node->parent = parent_node;
+
+        /* Update children links */
+        if (ht->cmp_key(parent_node->key, new_node->key) >= 1) {
+            parent_node->left = new_node;
+        } else {
+            parent_node->right = new_node;
+        }
+
+        /* Fix the bucket */
+        return hash_table_insert_fix_node_up(ht, bucket_index, new_node);
     }
 
+    /* Node is root node */
+    ht->buckets[bucket_index] = new_node;
+    new_node->color = HASH_BLACK;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Subroutine function to insert one pair {key, data} into its
+ * bucket from the buckets array. Function will not rehash the hash table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @param hash hash value of the key computed with hash function of the table
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_bucket_insert(hash_table_t * const __restrict__ ht, const void * const key, const void * const data, size_t hash) {
     /* Compute index of the current working tree */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    size_t bucket_index = hash_table_hash_index(ht, hash, ht->capacity);
 
     /* Set iterator pointers */
     hash_table_node_t *iterator = ht->buckets[bucket_index];
@@ -650,137 +1435,865 @@ scl_error_t hash_table_insert(hash_table_t * const __restrict__ ht, const void *
     if (ht->nil == new_node) {
         return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
     }
-    
-    scl_error_t err = SCL_OK;
-
-    if (ht->nil != parent_iterator) {
-
-        /* Update parent links */
-        new_node->parent = parent_iterator;
-
-        /* Update children links */
-        if (ht->cmp_key(parent_iterator->key, new_node->key) >= 1) {
-            parent_iterator->left = new_node;
-        } else {
-            parent_iterator->right = new_node;
-        }
-
-        /* Fix the bucket */
-        err = hash_table_insert_fix_node_up(ht, bucket_index, new_node);
-    } else {
 
-        /* Created node is root node */
-        ht->buckets[bucket_index] = new_node;
-        new_node->color = HASH_BLACK;
-    }
+    /* Link the new node into the bucket */
+    scl_error_t err = hash_table_bucket_attach(ht, bucket_index, parent_iterator, new_node);
 
     /* Increase hash table size */
     ++(ht->size);
 
-    /* Check if has table needs to be rehashed */
-    if (1 == hash_table_need_to_rehash(ht)) {
-        return hash_table_rehash(ht);
-    }
-
-    /* Insertion in hash table went successfully, or not */
+    /* Insertion in bucket went successfully, or not */
     return err;
 }
 
 /**
- * @brief Subroutine function of hash_table rehash, to traverse all
- * nodes from a bucket as in a red black tree and to insert all nodes
- * into the new buckets.
+ * @brief Subroutine function to insert one pair {key, data} into the hash
+ * table, knowing the hash of the key. The hash table and the pair must be valid.
  * 
  * @param ht pointer to an allocated hash table memory location
- * @param bucket pointer to current working hash table(red black tree) node to re-insert
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @param hash hash value of the key computed with hash function of the table
+ * @return scl_error_t enum object for handling errors
  */
-static void hash_table_rehash_helper(hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket) {
-    /* Check if current root can be inserted */
-    if (ht->nil == bucket) {
-        return;
+static scl_error_t hash_table_insert_hash(hash_table_t * const __restrict__ ht, const void * const key, const void * const data, size_t hash) {
+    /* Pairs are stored inline for open addressing engines */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_insert(ht, key, data, hash);
+    }
+
+    /* Check if hash table roots are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Reinsert current node into the hash table */
-    hash_table_insert(ht, bucket->key, bucket->data);
+    /* Move some old buckets if an incremental rehashing is in progress */
+    hash_table_rehash_advance(ht, key);
 
-    /* Reinsert left node child */
-    hash_table_rehash_helper(ht, bucket->left);
-    
-    /* Reinsert right node child */
-    hash_table_rehash_helper(ht, bucket->right);
+    /* Insert the pair in its bucket */
+    scl_error_t err = hash_table_bucket_insert(ht, key, data, hash);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    hash_table_filter_insert(ht, hash);
+
+    /* Check if has table needs to be rehashed (and it is not rehashing already) */
+    if ((NULL == ht->old_buckets) && (1 == hash_table_need_to_rehash(ht))) {
+        return hash_table_rehash(ht);
+    }
+
+    /* Insertion in hash table went successfully */
+    return SCL_OK;
 }
 
 /**
- * @brief Function to rehash a hash table and to double the capacity
- * of the table (double number of red black trees). Function may fail
- * if hash table is not allocated or has NULL trees or not enough
- * memory is left on heap to allocate new red black trees.
+ * @brief Function to insert one pair {key, data} into the hash table.
+ * If the key already exists the pair is not inserted again.
  * 
  * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
  * @return scl_error_t enum object for handling errors
  */
-static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht) {
+scl_error_t hash_table_insert(hash_table_t * const __restrict__ ht, const void *key, const void *data) {
     /* Check if hash table is allocated */
     if (NULL == ht) {
         return SCL_NULL_HASH_TABLE;
     }
 
-    /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+    /* Check if key pointer is not `NULL` */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
     }
 
-    /* Check if hash function is valid */
-    if (NULL == ht->hash) {
-        return SCL_NULL_HASH_FUNCTION;
+    /* Check if data pointer is not `NULL` */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
     }
 
-    /* Remember old capacity and compute new capacity */
-    size_t old_capacity = ht->capacity;
-    ht->capacity *= DEFAULT_HASH_CAPACITY_RATIO;
+    return hash_table_insert_hash(ht, key, data, ht->hash(key));
+}
 
-    /* Allocate new array of tree roots */
-    hash_table_node_t **new_buckets = malloc(sizeof(*new_buckets) * ht->capacity);
+/**
+ * @brief Subroutine function of hash_table rehash, to link one existing
+ * node into its bucket from the buckets array. The node keeps its key
+ * and data memory, so nothing is allocated or copied.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param relink_node pointer to a hash table node detached from its old bucket
+ */
+static void hash_table_relink_node(hash_table_t * const __restrict__ ht, hash_table_node_t * const __restrict__ relink_node) {
+    /* Compute index of the new working tree */
+    size_t hash = ht->hash(relink_node->key);
+    size_t bucket_index = hash_table_hash_index(ht, hash, ht->capacity);
 
-    /* Check if roots were allocated */
-    if (NULL == new_buckets) {
-        ht->capacity = old_capacity;
+    /* Add the key into the rebuilt membership filter */
+    hash_table_filter_rebuild_insert(ht, hash);
 
-        errno = ENOMEM;
-        perror("Not enough memory for buckets of hash table");
+    /* Set iterator pointers */
+    hash_table_node_t *iterator = ht->buckets[bucket_index];
+    hash_table_node_t *parent_iterator = ht->nil;
 
-        return SCL_REHASHING_FAILED;
+    /* Find a valid position for the node, keys are unique */
+    while (ht->nil != iterator) {
+        parent_iterator = iterator;
+
+        if (ht->cmp_key(iterator->key, relink_node->key) >= 1) {
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
     }
 
-    /* Change old roots pointer to new roots pointer */
-    hash_table_node_t **old_buckets = ht->buckets;
-    ht->buckets = new_buckets;
+    /* Reset the links of the node as for a new node */
+    relink_node->left = relink_node->right = ht->nil;
+    relink_node->parent = ht->nil;
+    relink_node->color = HASH_RED;
 
-    /* Set all buckets to black hole node */
-    for (size_t iter = 0; iter < ht->capacity; ++iter) {
-        new_buckets[iter] = ht->nil;
+    /* Link the node into the bucket */
+    hash_table_bucket_attach(ht, bucket_index, parent_iterator, relink_node);
+}
+
+/**
+ * @brief Subroutine function of hash_table rehash, to traverse all
+ * nodes from a bucket as in a red black tree and to relink all nodes
+ * into the new buckets. The old bucket is left with dangling links,
+ * so its root must be reset by the caller.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current working hash table(red black tree) node to relink
+ */
+static void hash_table_rehash_helper(hash_table_t * const __restrict__ ht, hash_table_node_t * const __restrict__ bucket) {
+    /* Check if current root can be relinked */
+    if (ht->nil == bucket) {
+        return;
     }
 
-    /* Set size of the hash table as default */
-    ht->size = 0;
+    /* Remember the children before the links are reset */
+    hash_table_node_t * const left_child = bucket->left;
+    hash_table_node_t * const right_child = bucket->right;
 
-    /* 
-     * Insert one bucket at a time in the new allocated trees
-     * and delete one bucket at a time from old roots pointer
-     */
+    /* Relink current node into the hash table */
+    hash_table_relink_node(ht, bucket);
+
+    /* Relink left node child */
+    hash_table_rehash_helper(ht, left_child);
+    
+    /* Relink right node child */
+    hash_table_rehash_helper(ht, right_child);
+}
+
+/**
+ * @brief Function to rehash an open addressing hash table into a new
+ * number of slots. Pairs are moved byte by byte, so no memory is allocated
+ * for them and no user function is called, except the hash function.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param new_capacity number of slots after rehashing (must be greater than size)
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_flat_rehash(hash_table_t * const __restrict__ ht, size_t new_capacity) {
+    /* Allocate new arrays of slots */
+    hash_table_slot_t *new_slots = calloc(new_capacity, sizeof(*new_slots));
+    uint8_t *new_entries = malloc(ht->entry_size * new_capacity);
+
+    /* Check if slots were allocated */
+    if ((NULL == new_slots) || (NULL == new_entries)) {
+        free(new_slots);
+        free(new_entries);
+
+        errno = ENOMEM;
+        perror("Not enough memory for slots of hash table");
+
+        return SCL_REHASHING_FAILED;
+    }
+
+    /* Change old slots pointers to new slots pointers */
+    hash_table_slot_t *old_slots = ht->slots;
+    uint8_t *old_entries = ht->entries;
+    size_t old_capacity = ht->capacity;
+
+    ht->slots = new_slots;
+    ht->entries = new_entries;
+    ht->capacity = new_capacity;
+
+    hash_table_filter_rebuild_start(ht, new_capacity);
+
+    /* Place every pair into the new slots */
     for (size_t iter = 0; iter < old_capacity; ++iter) {
-        if (ht->nil != old_buckets[iter]) {
-            hash_table_rehash_helper(ht, old_buckets[iter]);
-            free_hash_table_helper(ht, &old_buckets[iter]);
+        if (0 != old_slots[iter].dist) {
+            const uint8_t * const old_key = old_entries + iter * ht->entry_size;
+            size_t hash = ht->hash(old_key);
+
+            hash_table_flat_place(ht, hash, old_key, old_key + ht->data_offset);
+            hash_table_filter_rebuild_insert(ht, hash);
         }
     }
 
+    hash_table_filter_rebuild_finish(ht);
+
+    /* Free old slots arrays */
+    free(old_slots);
+    free(old_entries);
+
+    ++(ht->number_of_rehashes);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to allocate a buckets array with every
+ * bucket pointing to the black hole node.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param new_capacity number of buckets to allocate
+ * @return hash_table_node_t** new allocated buckets array or `NULL`
+ */
+static hash_table_node_t** hash_table_alloc_buckets(const hash_table_t * const __restrict__ ht, size_t new_capacity) {
+    /* Allocate new array of tree roots */
+    hash_table_node_t **new_buckets = malloc(sizeof(*new_buckets) * new_capacity);
+
+    /* Check if roots were allocated */
+    if (NULL == new_buckets) {
+        errno = ENOMEM;
+        perror("Not enough memory for buckets of hash table");
+
+        return NULL;
+    }
+
+    /* Set all buckets to black hole node */
+    for (size_t iter = 0; iter < new_capacity; ++iter) {
+        new_buckets[iter] = ht->nil;
+    }
+
+    return new_buckets;
+}
+
+/**
+ * @brief Function to resize a hash table to a new number of buckets at once.
+ * The nodes of red black buckets are relinked into the new buckets, so the
+ * only allocation is the new buckets array. Function must not be called while
+ * an incremental rehashing is in progress.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param new_capacity number of buckets (or slots) after resizing
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_resize(hash_table_t * const __restrict__ ht, size_t new_capacity) {
+    /* Open addressing engines just move the inline pairs */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_rehash(ht, new_capacity);
+    }
+
+    /* Allocate new array of tree roots */
+    hash_table_node_t **new_buckets = hash_table_alloc_buckets(ht, new_capacity);
+
+    /* Check if roots were allocated */
+    if (NULL == new_buckets) {
+        return SCL_REHASHING_FAILED;
+    }
+
+    /* Change old roots pointer to new roots pointer */
+    hash_table_node_t **old_buckets = ht->buckets;
+    size_t old_capacity = ht->capacity;
+
+    ht->buckets = new_buckets;
+    ht->capacity = new_capacity;
+
+    hash_table_filter_rebuild_start(ht, new_capacity);
+
+    /* Relink one bucket at a time into the new allocated trees */
+    for (size_t iter = 0; iter < old_capacity; ++iter) {
+        hash_table_rehash_helper(ht, old_buckets[iter]);
+    }
+
+    hash_table_filter_rebuild_finish(ht);
+
     /* Free pointer of the old roots pointer */
     free(old_buckets);
     old_buckets = NULL;
 
-    /* All good */
-    return SCL_OK;
+    ++(ht->number_of_rehashes);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to compute the smallest capacity that holds a number of
+ * pairs without exceeding the load factor. The capacity is rounded up to
+ * a power of two if the hash table selects buckets with a mask.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param number_of_pairs number of pairs to hold
+ * @return size_t capacity of the hash table
+ */
+static size_t hash_table_fit_capacity(const hash_table_t * const __restrict__ ht, size_t number_of_pairs) {
+    size_t new_capacity = (size_t)(number_of_pairs / DEFAULT_HASH_LOAD_FACTOR) + 1;
+
+    if (0 != ht->pow2_capacity) {
+        new_capacity = hash_table_round_pow2(new_capacity);
+    }
+
+    return new_capacity;
+}
+
+/**
+ * @brief Function to halve the capacity of the hash table after a deletion
+ * if its load factor fell under the low-water mark. The hash table is never
+ * shrunk under the default capacity or while an incremental rehashing is in
+ * progress. If the new buckets cannot be allocated the hash table is kept as
+ * it is, the deletion was already done.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ */
+static void hash_table_shrink(hash_table_t * const __restrict__ ht) {
+    /* Check if shrinking is enabled */
+    if ((0 == ht->shrink_load_factor) || (NULL != ht->old_buckets)) {
+        return;
+    }
+
+    size_t new_capacity = ht->capacity / DEFAULT_HASH_CAPACITY_RATIO;
+
+    /* Check if current load factor is under the low-water mark */
+    if ((DEFAULT_HASH_CAPACITY > new_capacity) || ((1.0 * ht->size) / ht->capacity >= ht->shrink_load_factor)) {
+        return;
+    }
+
+    /* Move all the pairs at once into the smaller buckets */
+    hash_table_resize(ht, new_capacity);
+}
+
+/**
+ * @brief Function to rehash a hash table and to double the capacity
+ * of the table (double number of red black trees). Function may fail
+ * if hash table is not allocated or has NULL trees or not enough
+ * memory is left on heap to allocate new red black trees.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_rehash(hash_table_t * const __restrict__ ht) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if hash function is valid */
+    if (NULL == ht->hash) {
+        return SCL_NULL_HASH_FUNCTION;
+    }
+
+    /* Compute new capacity */
+    size_t new_capacity = ht->capacity * DEFAULT_HASH_CAPACITY_RATIO;
+
+    /* Move all the nodes at once */
+    if ((HASH_ENGINE_RBK != ht->engine) || (0 == ht->rehash_step)) {
+        return hash_table_resize(ht, new_capacity);
+    }
+
+    /* Allocate new array of tree roots */
+    hash_table_node_t **new_buckets = hash_table_alloc_buckets(ht, new_capacity);
+
+    /* Check if roots were allocated */
+    if (NULL == new_buckets) {
+        return SCL_REHASHING_FAILED;
+    }
+
+    /* Keep the old buckets alive and move them a few at a time */
+    ht->old_buckets = ht->buckets;
+    ht->old_capacity = ht->capacity;
+    ht->rehash_index = 0;
+
+    ht->buckets = new_buckets;
+    ht->capacity = new_capacity;
+
+    hash_table_filter_rebuild_start(ht, new_capacity);
+
+    ++(ht->number_of_rehashes);
+
+    hash_table_rehash_advance(ht, NULL);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to move one bucket from the old buckets array into
+ * the new buckets array while an incremental rehashing is in progress.
+ * The old bucket will point to the black hole node after migration.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param old_bucket_index index of the bucket from the old buckets array
+ */
+static void hash_table_migrate_bucket(hash_table_t * const __restrict__ ht, size_t old_bucket_index) {
+    /* Relink all nodes of the old bucket */
+    hash_table_rehash_helper(ht, ht->old_buckets[old_bucket_index]);
+    ht->old_buckets[old_bucket_index] = ht->nil;
+}
+
+static void hash_table_rehash_advance(hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if an incremental rehashing is in progress */
+    if (NULL == ht->old_buckets) {
+        return;
+    }
+
+    /* Move the bucket of the key out of order */
+    if (NULL != key) {
+        hash_table_migrate_bucket(ht, hash_table_hash_index(ht, ht->hash(key), ht->old_capacity));
+    }
+
+    /* Move the next old buckets */
+    for (size_t iter = 0; (iter < ht->rehash_step) && (ht->rehash_index < ht->old_capacity); ++iter) {
+        hash_table_migrate_bucket(ht, ht->rehash_index);
+        ++(ht->rehash_index);
+    }
+
+    /* Check if all old buckets were moved */
+    if (ht->rehash_index >= ht->old_capacity) {
+        hash_table_filter_rebuild_finish(ht);
+
+        free(ht->old_buckets);
+        ht->old_buckets = NULL;
+
+        ht->old_capacity = 0;
+        ht->rehash_index = 0;
+    }
+}
+
+/**
+ * @brief Function to move all the remaining old buckets if an
+ * incremental rehashing is in progress.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ */
+static void hash_table_rehash_finish(hash_table_t * const __restrict__ ht) {
+    /* Check if an incremental rehashing is in progress */
+    if (NULL == ht->old_buckets) {
+        return;
+    }
+
+    /* Move every old bucket that was not moved yet */
+    for (; ht->rehash_index < ht->old_capacity; ++(ht->rehash_index)) {
+        hash_table_migrate_bucket(ht, ht->rehash_index);
+    }
+
+    hash_table_filter_rebuild_finish(ht);
+
+    /* Free the old buckets array */
+    free(ht->old_buckets);
+    ht->old_buckets = NULL;
+
+    ht->old_capacity = 0;
+    ht->rehash_index = 0;
+}
+
+/**
+ * @brief Function to set the number of old buckets moved by every insertion
+ * or deletion after the hash table was resized. If rehash_step is zero the
+ * hash table will move all the nodes at once when it is resized (default
+ * behavior), otherwise both buckets arrays are kept alive and the cost of
+ * rehashing is spread over the next operations, so no single insertion will
+ * stall. If rehash_step is set to zero while an incremental rehashing is in
+ * progress, all the remaining old buckets are moved. Open addressing engines
+ * always move their inline pairs at once.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param rehash_step number of old buckets to move for every insertion or deletion
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_set_rehash_step(hash_table_t * const __restrict__ ht, size_t rehash_step) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Finish the incremental rehashing in progress */
+    if (0 == rehash_step) {
+        hash_table_rehash_finish(ht);
+    }
+
+    /* Set the new number of buckets to move at once */
+    ht->rehash_step = rehash_step;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to make room in the hash table for the selected number of
+ * pairs, so they can be inserted without any rehashing. The hash table is
+ * resized at once (an incremental rehashing in progress is finished first).
+ * If the hash table is already big enough nothing is changed.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param number_of_pairs number of pairs the hash table should hold
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_reserve(hash_table_t * const __restrict__ ht, size_t number_of_pairs) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Compute the capacity keeping the load factor under its limit */
+    size_t new_capacity = hash_table_fit_capacity(ht, number_of_pairs);
+
+    /* Hash table is big enough */
+    if (new_capacity <= ht->capacity) {
+        return SCL_OK;
+    }
+
+    /* Buckets can be resized just from one array */
+    hash_table_rehash_finish(ht);
+
+    return hash_table_resize(ht, new_capacity);
+}
+
+/**
+ * @brief Function to set the low-water mark of the load factor. After a
+ * deletion leaves the load factor under it, the capacity of the hash table
+ * is halved and all the pairs are moved at once, so a hash table that grew
+ * big and then was drained does not keep a mostly empty buckets array. The
+ * low-water mark is zero by default, which disables shrinking. It cannot be
+ * greater than a quarter of the maximum load factor, so a halved hash table
+ * is never rehashed back right away.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param shrink_load_factor low-water mark of the load factor (0 to never shrink)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_set_shrink_load_factor(hash_table_t * const __restrict__ ht, double shrink_load_factor) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if low-water mark is valid */
+    if (!((0 <= shrink_load_factor) && (shrink_load_factor <= DEFAULT_HASH_LOAD_FACTOR / (2 * DEFAULT_HASH_CAPACITY_RATIO)))) {
+        return SCL_INVALID_INPUT;
+    }
+
+    ht->shrink_load_factor = shrink_load_factor;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to shrink the hash table to the smallest capacity that
+ * holds its pairs without exceeding the load factor (but not under the
+ * default capacity). All the pairs are moved at once into the new buckets.
+ * The hash table is never grown by this function.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_shrink_to_fit(hash_table_t * const __restrict__ ht) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Buckets can be resized just from one array */
+    hash_table_rehash_finish(ht);
+
+    /* Compute the capacity keeping the load factor under its limit */
+    size_t new_capacity = hash_table_fit_capacity(ht, ht->size);
+
+    if (DEFAULT_HASH_CAPACITY > new_capacity) {
+        new_capacity = (0 != ht->pow2_capacity) ? hash_table_round_pow2(DEFAULT_HASH_CAPACITY) : DEFAULT_HASH_CAPACITY;
+    }
+
+    /* Hash table is small enough */
+    if (new_capacity >= ht->capacity) {
+        return SCL_OK;
+    }
+
+    return hash_table_resize(ht, new_capacity);
+}
+
+/**
+ * @brief Subroutine function of hash_table_set_filter, to add all the
+ * keys of one red black bucket into the membership filter.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current working hash table node
+ */
+static void hash_table_filter_insert_bucket(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket) {
+    if (ht->nil == bucket) {
+        return;
+    }
+
+    hash_table_filter_insert(ht, ht->hash(bucket->key));
+
+    hash_table_filter_insert_bucket(ht, bucket->left);
+    hash_table_filter_insert_bucket(ht, bucket->right);
+}
+
+/**
+ * @brief Function to keep a compact membership filter (a blocked bloom
+ * filter) alongside the hash table. Every lookup checks the filter first,
+ * so most of the missing keys are rejected after reading one cache line,
+ * without searching their bucket. The filter is sized for the capacity of
+ * the hash table and rebuilt when the hash table is resized, the bits of
+ * the deleted keys are dropped just then. If false_positive_rate is zero
+ * the filter is removed. The statistics of the filter are reset.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param false_positive_rate wanted rate of missing keys passed by the filter, between 0 and 1 (0 to remove the filter)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_set_filter(hash_table_t * const __restrict__ ht, double false_positive_rate) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if false positive rate is valid */
+    if (!((0 <= false_positive_rate) && (false_positive_rate < 1))) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Remove the old filter */
+    free_hash_table_filter(ht->filter);
+    ht->filter = NULL;
+
+    if (0 == false_positive_rate) {
+        return SCL_OK;
+    }
+
+    /* Keys can be found just in one buckets array */
+    hash_table_rehash_finish(ht);
+
+    hash_table_filter_t *new_filter = malloc(sizeof(*new_filter));
+
+    if (NULL == new_filter) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /*
+     * A bloom filter sets log2(1 / rate) bits of every key and needs
+     * log2(1 / rate) / ln(2) bits of memory for every key, a few more
+     * for low rates because the bits of one key share one block. The
+     * logarithm is counted in doublings of the rate, linear between them
+     */
+    double log2_rate = 0;
+
+    while (false_positive_rate < 0.5) {
+        false_positive_rate *= 2;
+        ++log2_rate;
+    }
+
+    log2_rate += 2 * (1 - false_positive_rate);
+
+    new_filter->number_of_hashes = (uint32_t)(log2_rate + 0.5);
+
+    if (DEFAULT_HASH_FILTER_MAX_HASHES < new_filter->number_of_hashes) {
+        new_filter->number_of_hashes = DEFAULT_HASH_FILTER_MAX_HASHES;
+    }
+
+    if (0 == new_filter->number_of_hashes) {
+        new_filter->number_of_hashes = 1;
+    }
+
+    new_filter->bits_per_key = log2_rate * 1.4427 * (1 + log2_rate / 40);
+    new_filter->number_of_blocks = hash_table_filter_number_of_blocks(new_filter, ht->capacity);
+    new_filter->blocks = hash_table_filter_alloc_blocks(new_filter->number_of_blocks);
+    new_filter->next_blocks = NULL;
+    new_filter->next_number_of_blocks = 0;
+
+    if (NULL == new_filter->blocks) {
+        free(new_filter);
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    ht->filter = new_filter;
+
+    /* Add all the keys of the hash table */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        for (size_t iter = 0; iter < ht->capacity; ++iter) {
+            if (0 != ht->slots[iter].dist) {
+                hash_table_filter_insert(ht, ht->hash(hash_table_flat_key(ht, iter)));
+            }
+        }
+    } else {
+        for (size_t iter = 0; iter < ht->capacity; ++iter) {
+            hash_table_filter_insert_bucket(ht, ht->buckets[iter]);
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the statistics of the membership filter of
+ * the hash table. The fill ratio is computed by counting all the bits
+ * of the filter and the false positive rate is estimated from it, the
+ * lookups never write into the filter.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param stats pointer to a location to write the statistics
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_get_filter_stats(const hash_table_t * const __restrict__ ht, hash_table_filter_stats_t * const __restrict__ stats) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if stats location is valid */
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Check if hash table has a filter */
+    if (NULL == ht->filter) {
+        return SCL_NULL_HASH_TABLE_FILTER;
+    }
+
+    const hash_table_filter_t * const filter = ht->filter;
+    const size_t number_of_words = filter->number_of_blocks * (DEFAULT_HASH_FILTER_BLOCK_BITS / 64);
+    size_t set_bits = 0;
+
+    for (size_t iter = 0; iter < number_of_words; ++iter) {
+        set_bits += hash_table_popcount(filter->blocks[iter]);
+    }
+
+    stats->memory_size = number_of_words * sizeof(*filter->blocks);
+    stats->number_of_hashes = filter->number_of_hashes;
+    stats->fill_ratio = (1.0 * set_bits) / (number_of_words * 64);
+
+    /* A missing key passes if all its bits are set, each one with the fill ratio */
+    stats->false_positive_rate = 1;
+
+    for (uint32_t iter = 0; iter < filter->number_of_hashes; ++iter) {
+        stats->false_positive_rate *= stats->fill_ratio;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to keep the capacity of the hash table a power of two.
+ * In this mode the hash value is mixed with a finalizer and the bucket is
+ * selected with a mask, so no division is done for every operation. The
+ * capacity is rounded up to the next power of two and all pairs are moved
+ * at once into their new buckets.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param pow2_capacity 1 to keep a power of two capacity, 0 to select buckets with modulo
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_set_pow2_capacity(hash_table_t * const __restrict__ ht, uint8_t pow2_capacity) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    pow2_capacity = (0 != pow2_capacity);
+
+    /* Nothing to change */
+    if (pow2_capacity == ht->pow2_capacity) {
+        return SCL_OK;
+    }
+
+    /* Buckets can be moved just from one array */
+    hash_table_rehash_finish(ht);
+
+    /* Every pair changes its bucket with the new index function */
+    ht->pow2_capacity = pow2_capacity;
+
+    scl_error_t err = hash_table_resize(ht, (0 != pow2_capacity) ? hash_table_round_pow2(ht->capacity) : ht->capacity);
+
+    /* Pairs were not moved, keep the old index function */
+    if (SCL_OK != err) {
+        ht->pow2_capacity = !pow2_capacity;
+    }
+
+    return err;
+}
+
+/**
+ * @brief Subroutine function to search one node having as node value
+ * current key specified in input, starting from the root of one bucket.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to the root of the bucket
+ * @param key pointer to a location of a value representing key of the hash
+ * @return hash_table_node_t* an allocated hash table node object containing
+ * desired key or `nil` if such key does not exist in the bucket
+ */
+static hash_table_node_t* hash_table_search_bucket(const hash_table_t * const __restrict__ ht, hash_table_node_t * const bucket, const void * const __restrict__ key) {
+    /* Set iterator pointer */
+    hash_table_node_t *iterator = bucket;
+
+    /* Search for input key in all tree */
+    while (ht->nil != iterator) {
+        if (ht->cmp_key(iterator->key, key) <= -1) {
+            iterator = iterator->right;
+        } else if (ht->cmp_key(iterator->key, key) >= 1) {
+            iterator = iterator->left;
+        } else {
+            return iterator;
+        }
+    }
+
+    /* Key was not found */
+    return ht->nil;
+}
+
+/**
+ * @brief Subroutine function to search one node having as node value
+ * current key specified in input, knowing the hash of the key.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param hash hash value of the key computed with hash function of the table
+ * @return hash_table_node_t* node containing desired key or `nil`
+ */
+static hash_table_node_t* hash_table_find_node_hash(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key, size_t hash) {
+    /* Key may still be in the old buckets while rehashing incrementally */
+    if (NULL != ht->old_buckets) {
+        hash_table_node_t * const old_node = hash_table_search_bucket(ht, ht->old_buckets[hash_table_hash_index(ht, hash, ht->old_capacity)], key);
+
+        if (ht->nil != old_node) {
+            return old_node;
+        }
+    }
+
+    /* Search the key in its current bucket */
+    return hash_table_search_bucket(ht, ht->buckets[hash_table_hash_index(ht, hash, ht->capacity)], key);
 }
 
 /**
@@ -800,25 +2313,59 @@ static hash_table_node_t* hash_table_find_node(const hash_table_t * const __rest
         return ht->nil;
     }
 
-    /* Make sure that current working tree exists */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    /* Compute the hash of the key just once */
+    return hash_table_find_node_hash(ht, key, ht->hash(key));
+}
 
-    /* Set iterator pointer */
-    hash_table_node_t *iterator = ht->buckets[bucket_index];
+/**
+ * @brief Function to search the data of one key knowing the hash of the key,
+ * for any storage engine of the hash table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param hash hash value of the key computed with hash function of the table
+ * @return void* pointer to memory location of the data of the key
+ * or `NULL` if key does not exist in the hash table
+ */
+static void* hash_table_find_key_location_hash(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key, size_t hash) {
+    /* Most of the missing keys are rejected by the membership filter */
+    if (0 == hash_table_filter_may_contain(ht, hash)) {
+        return NULL;
+    }
 
-    /* Search for input data (void *data) in all tree */
-    while (ht->nil != iterator) {
-        if (ht->cmp_key(iterator->key, key) <= -1) {
-            iterator = iterator->right;
-        } else if (ht->cmp_key(iterator->key, key) >= 1) {
-            iterator = iterator->left;
-        } else {
-            return iterator;
+    void *data = NULL;
+
+    if (HASH_ENGINE_RBK != ht->engine) {
+
+        /* Search the key in the open addressing slots */
+        if (NULL != ht->slots) {
+            size_t slot = hash_table_flat_find_slot(ht, key, hash);
+
+            if (SIZE_MAX != slot) {
+                data = hash_table_flat_data(ht, slot);
+            }
         }
+    } else if (NULL != ht->buckets) {
+
+        /* Get the node data or `NULL` if node is `nil` */
+        data = hash_table_find_node_hash(ht, key, hash)->data;
     }
 
-    /* Data was not found */
-    return ht->nil;
+    return data;
+}
+
+/**
+ * @brief Subroutine function to search the data of one key
+ * specified in input, for any storage engine of the hash table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return void* pointer to memory location of the data of the key
+ * or `NULL` if key does not exist in the hash table
+ */
+static void* hash_table_find_key_location(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Compute the hash of the key just once */
+    return hash_table_find_key_location_hash(ht, key, ht->hash(key));
 }
 
 /**
@@ -834,14 +2381,14 @@ static hash_table_node_t* hash_table_find_node(const hash_table_t * const __rest
  */
 const void* hash_table_find_key_data(const hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
     /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key) || (NULL == data)) {
+    if ((NULL == ht) || (NULL == key) || (NULL == data)) {
         return NULL;
     }
 
-    /* Get the node data or `NULL` if node is `nil` */
-    const void * const search_data = hash_table_find_node(ht, key)->data;
+    /* Get the data of the key or `NULL` if key does not exist */
+    const void * const search_data = hash_table_find_key_location(ht, key);
 
-    if (ht->cmp_dt(search_data, data) == 0) {
+    if ((NULL != search_data) && (ht->cmp_dt(search_data, data) == 0)) {
         return search_data;
     }
 
@@ -860,12 +2407,12 @@ const void* hash_table_find_key_data(const hash_table_t * const __restrict__ ht,
  */
 const void* hash_table_find_data(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
     /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == key)) {
+    if ((NULL == ht) || (NULL == key)) {
         return NULL;
     }
 
     /* Key was not found it means no data */
-    return hash_table_find_node(ht, key)->data;
+    return hash_table_find_key_location(ht, key);
 }
 
 /**
@@ -886,6 +2433,181 @@ uint8_t hash_table_contains_key_data(const hash_table_t * const __restrict__ ht,
     return 1;
 }
 
+/**
+ * @brief Function to prefetch the first memory location touched by the
+ * search of one key: the bucket pointer for red black buckets, the slot
+ * metadata and the inline pair for open addressing engines.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of the key computed with hash function of the table
+ */
+static void hash_table_prefetch_bucket(const hash_table_t * const __restrict__ ht, size_t hash) {
+    size_t bucket_index = hash_table_hash_index(ht, hash, ht->capacity);
+
+    if (HASH_ENGINE_RBK != ht->engine) {
+        HASH_TABLE_PREFETCH(&ht->slots[bucket_index]);
+        HASH_TABLE_PREFETCH(hash_table_flat_key(ht, bucket_index));
+    } else {
+        HASH_TABLE_PREFETCH(&ht->buckets[bucket_index]);
+    }
+}
+
+/**
+ * @brief Function to prefetch the root node of the bucket of one key, the
+ * bucket pointer should be already in cache. Open addressing engines have
+ * no second level to prefetch.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param hash hash value of the key computed with hash function of the table
+ */
+static void hash_table_prefetch_root(const hash_table_t * const __restrict__ ht, size_t hash) {
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return;
+    }
+
+    const hash_table_node_t * const root = ht->buckets[hash_table_hash_index(ht, hash, ht->capacity)];
+
+    if (ht->nil != root) {
+        HASH_TABLE_PREFETCH(root);
+        HASH_TABLE_PREFETCH(root->key);
+    }
+}
+
+/**
+ * @brief Function to find the data of many keys at once. The keys are
+ * processed in groups, every group is hashed first, then the buckets and
+ * their roots are prefetched and just after that the keys are searched,
+ * so the cache misses of different keys overlap instead of being paid
+ * one after another.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param keys pointer to an array of keys stored one after another (key_size bytes each)
+ * @param number_of_keys number of keys from the array
+ * @param data pointer to an array of number_of_keys pointers, data[i] is set to the
+ * data of keys[i] or to `NULL` if the key is not in the hash table
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_find_batch(const hash_table_t * const __restrict__ ht, const void * const keys, size_t number_of_keys, const void ** const data) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if keys and data arrays are valid */
+    if (NULL == keys) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    const uint8_t * const typed_keys = keys;
+    size_t hashes[DEFAULT_HASH_BATCH_SIZE];
+
+    for (size_t batch_start = 0; batch_start < number_of_keys; batch_start += DEFAULT_HASH_BATCH_SIZE) {
+        size_t batch_size = number_of_keys - batch_start;
+
+        if (DEFAULT_HASH_BATCH_SIZE < batch_size) {
+            batch_size = DEFAULT_HASH_BATCH_SIZE;
+        }
+
+        /* Hash all the keys and prefetch their buckets */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            hashes[iter] = ht->hash(typed_keys + (batch_start + iter) * ht->key_size);
+            hash_table_prefetch_bucket(ht, hashes[iter]);
+        }
+
+        /* Prefetch the roots of the buckets */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            hash_table_prefetch_root(ht, hashes[iter]);
+        }
+
+        /* Search all the keys */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            data[batch_start + iter] = hash_table_find_key_location_hash(ht, typed_keys + (batch_start + iter) * ht->key_size, hashes[iter]);
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to insert many pairs {key, data} at once. The hash table
+ * is first resized to fit all the pairs, then the pairs are processed in groups
+ * as in hash_table_find_batch. If one insertion fails the function stops and
+ * the pairs before it stay in the hash table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param keys pointer to an array of keys stored one after another (key_size bytes each)
+ * @param data pointer to an array of data stored one after another (data_size bytes each)
+ * @param number_of_pairs number of pairs to insert
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_insert_batch(hash_table_t * const __restrict__ ht, const void * const keys, const void * const data, size_t number_of_pairs) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if keys and data arrays are valid */
+    if (NULL == keys) {
+        return SCL_INVALID_KEY;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Make room for all the pairs, so no rehashing happens meanwhile */
+    scl_error_t err = hash_table_reserve(ht, ht->size + number_of_pairs);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    const uint8_t * const typed_keys = keys;
+    const uint8_t * const typed_data = data;
+    size_t hashes[DEFAULT_HASH_BATCH_SIZE];
+
+    for (size_t batch_start = 0; batch_start < number_of_pairs; batch_start += DEFAULT_HASH_BATCH_SIZE) {
+        size_t batch_size = number_of_pairs - batch_start;
+
+        if (DEFAULT_HASH_BATCH_SIZE < batch_size) {
+            batch_size = DEFAULT_HASH_BATCH_SIZE;
+        }
+
+        /* Hash all the keys and prefetch their buckets */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            hashes[iter] = ht->hash(typed_keys + (batch_start + iter) * ht->key_size);
+            hash_table_prefetch_bucket(ht, hashes[iter]);
+        }
+
+        /* Prefetch the roots of the buckets */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            hash_table_prefetch_root(ht, hashes[iter]);
+        }
+
+        /* Insert all the pairs */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            err = hash_table_insert_hash(ht, typed_keys + (batch_start + iter) * ht->key_size, typed_data + (batch_start + iter) * ht->data_size, hashes[iter]);
+
+            if (SCL_OK != err) {
+                return err;
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to check if hash table is empty or not.
  * 
@@ -894,7 +2616,7 @@ uint8_t hash_table_contains_key_data(const hash_table_t * const __restrict__ ht,
  */
 uint8_t is_hash_table_empty(const hash_table_t * const __restrict__ ht) {
     /* Hash table is empty */
-    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || (0 == ht->size)) {
+    if ((NULL == ht) || ((NULL == ht->buckets) && (NULL == ht->slots)) || (0 == ht->capacity) || (0 == ht->size)) {
         return 1;
     }
 
@@ -911,12 +2633,26 @@ uint8_t is_hash_table_empty(const hash_table_t * const __restrict__ ht) {
  * @return uint8_t 0 if hash table bucket is not empty or 1 otherwise
  */
 uint8_t is_hash_table_bucket_key_empty(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Hast table is empty */
+    if ((NULL == ht) || (NULL == key) || (0 == ht->capacity) || (0 == ht->size)) {
+        return 1;
+    }
+
     /* Compute the curent bucket index */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    size_t bucket_index = hash_table_bucket_index(ht, key);
+
+    /* Open addressing bucket is empty if no pair has it as home slot */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        if ((NULL == ht->slots) || (0 == hash_table_flat_count_home(ht, bucket_index))) {
+            return 1;
+        }
+
+        return 0;
+    }
 
     /* Hast table bucket is empty */
-    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || 
-        (0 == ht->size) || (ht->nil == ht->buckets[bucket_index])) {
+    if ((NULL == ht->buckets) || ((ht->nil == ht->buckets[bucket_index]) && 
+        ((NULL == ht->old_buckets) || (0 == hash_table_count_bucket_elements(ht, key))))) {
         return 1;
     }
 
@@ -968,39 +2704,293 @@ static size_t hash_table_count_bucket_elements_helper(const hash_table_t * const
         return 0;
     }
 
-    /* Count current node */
-    size_t total_nodes = 1;
+    /* Count current node */
+    size_t total_nodes = 1;
+
+    /* Count nodes from left subtree */
+    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->left);
+    
+    /* Count nodes from right subtree */
+    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->right);
+
+    /* Return total count of the all tree(bucket) */
+    return total_nodes;
+}
+
+/**
+ * @brief Helper function to count the nodes of one old bucket that belong
+ * to the selected bucket of the new buckets array, while an incremental
+ * rehashing is in progress.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current old hash table node to start counting size
+ * @param bucket_index index of the bucket from the new buckets array
+ * @return size_t number of nodes that will be moved into the selected bucket
+ */
+static size_t hash_table_count_old_bucket_elements_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, size_t bucket_index) {
+    /* Check if node can be counted */
+    if (ht->nil == bucket) {
+        return 0;
+    }
+
+    /* Count current node just if it belongs to the selected bucket */
+    size_t total_nodes = (bucket_index == hash_table_bucket_index(ht, bucket->key));
+
+    /* Count nodes from left and right subtrees */
+    total_nodes += hash_table_count_old_bucket_elements_helper(ht, bucket->left, bucket_index);
+    total_nodes += hash_table_count_old_bucket_elements_helper(ht, bucket->right, bucket_index);
+
+    /* Return total count of the old bucket */
+    return total_nodes;
+}
+
+/**
+ * @brief Function to compute the size of one bucket according to key type
+ * value. Bucket index is computed with hashing function of the current
+ * hast table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @return size_t SIZE_MAX if hash table is not valid or size of desired bucket
+ */
+size_t hash_table_count_bucket_elements(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || ((NULL == ht->buckets) && (NULL == ht->slots))) {
+        return SIZE_MAX;
+    }
+
+    /* Compute the bucket index */
+    size_t bucket_index = hash_table_bucket_index(ht, key);
+
+    /* Count the pairs having the bucket as home slot */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_count_home(ht, bucket_index);
+    }
+
+    /* Compute the size of the bucket */
+    size_t total_nodes = hash_table_count_bucket_elements_helper(ht, ht->buckets[bucket_index]);
+
+    /*
+     * The buckets array doubles when rehashing incrementally, so the nodes not
+     * moved yet into the selected bucket are all in one old bucket
+     */
+    if (NULL != ht->old_buckets) {
+        total_nodes += hash_table_count_old_bucket_elements_helper(ht, ht->old_buckets[bucket_index % ht->old_capacity], bucket_index);
+    }
+
+    return total_nodes;
+}
+
+/**
+ * @brief Helper function to measure the shape of one red black bucket.
+ * The depth of the root is one, so the depth of a node is the number of
+ * nodes visited to find it and the depth of a missing child is the number
+ * of nodes visited to miss a key ending there.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket pointer to current hash table node to start measuring
+ * @param depth depth of the current node
+ * @param depth_sum pointer to the sum of the depths of all nodes
+ * @param miss_sum pointer to the sum of the depths of all missing children
+ * @return size_t height of the subtree of the current node
+ */
+static size_t hash_table_stats_bucket_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, size_t depth, size_t * const __restrict__ depth_sum, size_t * const __restrict__ miss_sum) {
+    /* Missing child of the parent node */
+    if (ht->nil == bucket) {
+        *miss_sum += depth - 1;
+        return depth - 1;
+    }
+
+    *depth_sum += depth;
+
+    /* Measure left and right subtrees */
+    size_t left_height = hash_table_stats_bucket_helper(ht, bucket->left, depth + 1, depth_sum, miss_sum);
+    size_t right_height = hash_table_stats_bucket_helper(ht, bucket->right, depth + 1, depth_sum, miss_sum);
+
+    return (left_height > right_height) ? left_height : right_height;
+}
+
+/**
+ * @brief Helper function to measure the pairs of an open addressing hash
+ * table having the same home slot. A missed key visits the slots of the
+ * cluster just as the search does, robin hood probing stops at the first
+ * closer pair.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param home_slot index of the home slot (bucket)
+ * @param max_dist pointer to the greatest probe distance of the pairs
+ * @param miss_probes pointer to the number of slots visited to miss a key
+ * @return size_t number of pairs having the selected home slot
+ */
+static size_t hash_table_stats_flat_home(const hash_table_t * const __restrict__ ht, size_t home_slot, size_t * const __restrict__ max_dist, size_t * const __restrict__ miss_probes) {
+    size_t total_pairs = 0;
+    size_t slot = home_slot;
+    uint8_t missed = 0;
+
+    *max_dist = 0;
+    *miss_probes = 0;
+
+    for (size_t dist = 1; (0 != ht->slots[slot].dist) && (dist <= ht->capacity); ++dist) {
+        if ((HASH_ENGINE_ROBIN_HOOD == ht->engine) && (ht->slots[slot].dist < dist)) {
+            missed = 1;
+        }
+
+        if (0 == missed) {
+            ++(*miss_probes);
+        }
+
+        if (dist == ht->slots[slot].dist) {
+            ++total_pairs;
+            *max_dist = dist;
+        }
+
+        if (ht->capacity == ++slot) {
+            slot = 0;
+        }
+    }
+
+    return total_pairs;
+}
+
+/**
+ * @brief Function to compute occupancy and probe length statistics of the
+ * hash table, they show how well the hash function spreads the keys and
+ * help to select the initial capacity. Every bucket is visited once, so the
+ * function is as slow as a traversal. The hash table is not changed, while
+ * an incremental rehashing is in progress a bucket also holds the pairs not
+ * moved yet from its old bucket and, as the lookups do, every search visits
+ * the old bucket before the new one.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param stats pointer to a location to write the statistics
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_get_stats(const hash_table_t * const __restrict__ ht, hash_table_stats_t * const __restrict__ stats) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Check if stats location is valid */
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    stats->size = ht->size;
+    stats->capacity = ht->capacity;
+    stats->load_factor = (1.0 * ht->size) / ht->capacity;
+    stats->max_bucket_size = 0;
+    stats->max_bucket_depth = 0;
+    stats->number_of_rehashes = ht->number_of_rehashes;
+
+    for (size_t iter = 0; iter < HASH_TABLE_STATS_HISTOGRAM_SIZE; ++iter) {
+        stats->bucket_histogram[iter] = 0;
+    }
+
+    size_t total_depth = 0;
+    size_t used_buckets = 0;
+    double total_hit_probes = 0;
+    double total_miss_probes = 0;
+
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        size_t bucket_size = 0;
+        size_t bucket_depth = 0;
+
+        if (HASH_ENGINE_RBK != ht->engine) {
+            size_t miss_probes = 0;
+
+            bucket_size = hash_table_stats_flat_home(ht, iter, &bucket_depth, &miss_probes);
+            total_miss_probes += miss_probes;
+
+            /* A stored pair is found after visiting `dist` slots */
+            if (0 != ht->slots[iter].dist) {
+                total_hit_probes += ht->slots[iter].dist;
+            }
+        } else {
+            size_t depth_sum = 0;
+            size_t miss_sum = 0;
+
+            bucket_depth = hash_table_stats_bucket_helper(ht, ht->buckets[iter], 1, &depth_sum, &miss_sum);
+            bucket_size = hash_table_count_bucket_elements_helper(ht, ht->buckets[iter]);
+
+            /* A tree of n nodes has n + 1 missing children */
+            double miss_probes = (1.0 * miss_sum) / (bucket_size + 1);
+
+            /*
+             * The buckets array doubles when rehashing incrementally, so the
+             * nodes not moved yet into this bucket are all in one old bucket
+             */
+            const hash_table_node_t * const old_bucket = (NULL != ht->old_buckets) ? ht->old_buckets[iter % ht->old_capacity] : ht->nil;
+
+            if (ht->nil != old_bucket) {
+                size_t old_depth_sum = 0;
+                size_t old_miss_sum = 0;
+                size_t old_depth = hash_table_stats_bucket_helper(ht, old_bucket, 1, &old_depth_sum, &old_miss_sum);
+                double old_miss_probes = (1.0 * old_miss_sum) / (hash_table_count_bucket_elements_helper(ht, old_bucket) + 1);
+
+                /* Every search misses the old bucket before finding a node of the new one */
+                total_hit_probes += bucket_size * old_miss_probes;
+                miss_probes += old_miss_probes;
+
+                /* Count the old nodes once, from the first bucket they move into */
+                if (iter < ht->old_capacity) {
+                    total_hit_probes += old_depth_sum;
+                }
+
+                bucket_size += hash_table_count_old_bucket_elements_helper(ht, old_bucket, iter);
+                bucket_depth += old_depth;
+            }
+
+            total_hit_probes += depth_sum;
+            total_miss_probes += miss_probes;
+        }
 
-    /* Count nodes from left subtree */
-    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->left);
-    
-    /* Count nodes from right subtree */
-    total_nodes += hash_table_count_bucket_elements_helper(ht, bucket->right);
+        /* Update the histogram and the extremes */
+        ++(stats->bucket_histogram[(bucket_size < HASH_TABLE_STATS_HISTOGRAM_SIZE) ? bucket_size : HASH_TABLE_STATS_HISTOGRAM_SIZE - 1]);
 
-    /* Return total count of the all tree(bucket) */
-    return total_nodes;
-}
+        if (0 != bucket_size) {
+            total_depth += bucket_depth;
+            ++used_buckets;
+        }
 
-/**
- * @brief Function to compute the size of one bucket according to key type
- * value. Bucket index is computed with hashing function of the current
- * hast table.
- * 
- * @param ht pointer to an allocated hash table memory location
- * @param key pointer to a location of a value representing key of the hash
- * @return size_t SIZE_MAX if hash table is not valid or size of desired bucket
- */
-size_t hash_table_count_bucket_elements(const hash_table_t * const __restrict__ ht, const void * const __restrict__ key) {
-    /* Check if input data is valid */
-    if ((NULL == ht) || (NULL == ht->buckets)) {
-        return SIZE_MAX;
+        if (bucket_size > stats->max_bucket_size) {
+            stats->max_bucket_size = bucket_size;
+        }
+
+        if (bucket_depth > stats->max_bucket_depth) {
+            stats->max_bucket_depth = bucket_depth;
+        }
     }
 
-    /* Compute the bucket index */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    stats->average_bucket_depth = (0 == used_buckets) ? 0 : (1.0 * total_depth) / used_buckets;
+    stats->average_hit_probes = (0 == ht->size) ? 0 : total_hit_probes / ht->size;
+    stats->average_miss_probes = total_miss_probes / ht->capacity;
 
-    /* Compute the size of the bucket */
-    return hash_table_count_bucket_elements_helper(ht, ht->buckets[bucket_index]);
+    /* Count the memory of the buckets and of the pairs */
+    stats->memory_size = sizeof(*ht);
+
+    if (HASH_ENGINE_RBK != ht->engine) {
+        stats->memory_size += ht->capacity * (sizeof(*ht->slots) + ht->entry_size) + ht->entry_size;
+    } else {
+        stats->memory_size += sizeof(*ht->nil) + (ht->capacity + ht->old_capacity) * sizeof(*ht->buckets);
+        stats->memory_size += ht->size * (sizeof(*ht->nil) + ht->entry_size);
+    }
+
+    if (NULL != ht->filter) {
+        stats->memory_size += sizeof(*ht->filter) + ht->filter->number_of_blocks * (DEFAULT_HASH_FILTER_BLOCK_BITS / 8);
+
+        if (NULL != ht->filter->next_blocks) {
+            stats->memory_size += ht->filter->next_number_of_blocks * (DEFAULT_HASH_FILTER_BLOCK_BITS / 8);
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
 }
 
 /**
@@ -1277,52 +3267,47 @@ static scl_error_t hash_table_delete_fix_node_up(const hash_table_t * const __re
 }
 
 /**
- * @brief Function to delete one pair {key, data} from current working
- * hash table if it exists, function will throw an error if pair does not
- * exists in the hash table.
+ * @brief Function to delete the pair having the key specified in input
+ * from an open addressing hash table. If data is not `NULL` the pair is
+ * deleted just if its data is the same as input data.
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param key pointer to a location of a value representing key of the hash
- * @param data pointer to a location of a value representing data of a node
+ * @param data pointer to a location of a value representing data of a node or `NULL`
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t hash_table_delete_key_data(hash_table_t * __restrict__ const ht, const void * const key, const void * const data) {
-    /* Check if hash table is allocated */
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
-
-    /* Check if hash table buckets are allocated */
-    if (NULL == ht->buckets) {
+static scl_error_t hash_table_flat_delete_key(hash_table_t * const __restrict__ ht, const void * const key, const void * const data) {
+    /* Check if open addressing slots are allocated */
+    if (NULL == ht->slots) {
         return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Check if key type pointer is valid */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
-    }
-
-    /* Check if data type pointer is valid */
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
+    /* Find slot to delete */
+    size_t slot = hash_table_flat_find_slot(ht, key, ht->hash(key));
 
-    /* Compute the bucket index to insert pair */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
-
-    /* Check if there exists at least data to search */
-    if (ht->nil == ht->buckets[bucket_index]) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    /* Pair is not in the hash table */
+    if ((SIZE_MAX == slot) || ((NULL != data) && (0 != ht->cmp_dt(hash_table_flat_data(ht, slot), data)))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
     }
 
-    /* Find node to delete */
-    hash_table_node_t *delete_node = hash_table_find_node(ht, key);
+    /* Remove the pair from its slot */
+    hash_table_flat_delete_slot(ht, slot);
 
-    /* Delete node is not in the current working bucket */
-    if ((ht->nil == delete_node) || (0 != ht->cmp_dt(delete_node->data, data))) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
+    /* All good */
+    return SCL_OK;
+}
 
+/**
+ * @brief Function to remove one node from its red black bucket and to
+ * fix the bucket after removal. The other nodes of the bucket are relinked,
+ * never copied, so pointers to them stay valid and keep their inorder order.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param bucket_index index of the red black tree(bucket) containing the node
+ * @param delete_node pointer to the hash table node to remove
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t hash_table_delete_node(hash_table_t * const __restrict__ ht, size_t bucket_index, hash_table_node_t *delete_node) {
     /* Node has two children swap with it's inorder successor and delete successor */
     if ((ht->nil != delete_node->left) && (ht->nil != delete_node->right)) {
 
@@ -1443,6 +3428,75 @@ scl_error_t hash_table_delete_key_data(hash_table_t * __restrict__ const ht, con
     return SCL_OK;
 }
 
+/**
+ * @brief Function to delete one pair {key, data} from current working
+ * hash table if it exists, function will throw an error if pair does not
+ * exists in the hash table.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param key pointer to a location of a value representing key of the hash
+ * @param data pointer to a location of a value representing data of a node
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_delete_key_data(hash_table_t * __restrict__ const ht, const void * const key, const void * const data) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if key type pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Check if data type pointer is valid */
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Pairs are stored inline for open addressing engines */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        scl_error_t err = hash_table_flat_delete_key(ht, key, data);
+
+        /* Shrink the hash table if it fell under the low-water mark */
+        hash_table_shrink(ht);
+
+        return err;
+    }
+
+    /* Check if hash table buckets are allocated */
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Move the old bucket of the key if an incremental rehashing is in progress */
+    hash_table_rehash_advance(ht, key);
+
+    /* Compute the bucket index to insert pair */
+    size_t bucket_index = hash_table_bucket_index(ht, key);
+
+    /* Check if there exists at least data to search */
+    if (ht->nil == ht->buckets[bucket_index]) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    /* Find node to delete */
+    hash_table_node_t *delete_node = hash_table_find_node(ht, key);
+
+    /* Delete node is not in the current working bucket */
+    if ((ht->nil == delete_node) || (0 != ht->cmp_dt(delete_node->data, data))) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* Remove the node from its bucket */
+    scl_error_t err = hash_table_delete_node(ht, bucket_index, delete_node);
+
+    /* Shrink the hash table if it fell under the low-water mark */
+    hash_table_shrink(ht);
+
+    return err;
+}
+
 /**
  * @brief Function to delete one bucket from hash table
  * correspondent to hash function of the key data type value.
@@ -1458,7 +3512,7 @@ scl_error_t hash_table_delete_hash(hash_table_t * __restrict__ const ht, const v
     }
 
     /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
         return SCL_NULL_HASH_ROOTS;
     }
 
@@ -1467,8 +3521,21 @@ scl_error_t hash_table_delete_hash(hash_table_t * __restrict__ const ht, const v
         return SCL_INVALID_KEY;
     }
 
+    /* Move the old bucket of the key if an incremental rehashing is in progress */
+    hash_table_rehash_advance(ht, key);
+
     /* Compute bucket index of the key data value */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    size_t bucket_index = hash_table_bucket_index(ht, key);
+
+    /* Delete all pairs having the bucket as home slot */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        scl_error_t err = hash_table_flat_delete_home(ht, bucket_index);
+
+        /* Shrink the hash table if it fell under the low-water mark */
+        hash_table_shrink(ht);
+
+        return err;
+    }
 
     /* Check if we can delete at least one data from bucket */
     if (ht->nil == ht->buckets[bucket_index]) {
@@ -1489,6 +3556,9 @@ scl_error_t hash_table_delete_hash(hash_table_t * __restrict__ const ht, const v
     /* Free entire bucket from memory */
     free_hash_table_helper(ht, &ht->buckets[bucket_index]);
 
+    /* Shrink the hash table if it fell under the low-water mark */
+    hash_table_shrink(ht);
+
     /* All good */
     return SCL_OK;
 }
@@ -1508,18 +3578,31 @@ scl_error_t hash_table_delete_key(hash_table_t * __restrict__ const ht, const vo
         return SCL_NULL_HASH_TABLE;
     }
 
+    /* Check if data type value pointer is valid */
+    if (NULL == key) {
+        return SCL_INVALID_KEY;
+    }
+
+    /* Pairs are stored inline for open addressing engines */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        scl_error_t err = hash_table_flat_delete_key(ht, key, NULL);
+
+        /* Shrink the hash table if it fell under the low-water mark */
+        hash_table_shrink(ht);
+
+        return err;
+    }
+
     /* Check if has table buckets are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
     }
 
-    /* Check if data type value pointer is valid */
-    if (NULL == key) {
-        return SCL_INVALID_KEY;
-    }
+    /* Move the old bucket of the key if an incremental rehashing is in progress */
+    hash_table_rehash_advance(ht, key);
 
     /* Set delete node and bucket index ad default values */
-    size_t bucket_index = ht->hash(key) % ht->capacity;
+    size_t bucket_index = hash_table_bucket_index(ht, key);
     hash_table_node_t *delete_node = hash_table_find_node(ht, key);
 
     /* Delete node is not in the current working bucket */
@@ -1527,122 +3610,243 @@ scl_error_t hash_table_delete_key(hash_table_t * __restrict__ const ht, const vo
         return SCL_DATA_NOT_FOUND_FOR_DELETE;
     }
 
-    /* Node has two children swap with it's inorder successor and delete successor */
-    if ((ht->nil != delete_node->left) && (ht->nil != delete_node->right)) {
+    /* Remove the node from its bucket */
+    scl_error_t err = hash_table_delete_node(ht, bucket_index, delete_node);
 
-        /* Find a replacement for selected node */
-        hash_table_node_t *delete_succecessor = hash_table_root_min_node(ht, delete_node->right);
-                
-        /* Replace the selected red-black node and remove the dublicate */
-        scl_error_t err = hash_table_swap_nodes(ht, bucket_index, delete_node, delete_succecessor);
+    /* Shrink the hash table if it fell under the low-water mark */
+    hash_table_shrink(ht);
 
-        if (SCL_OK != err) {
-            return err;
+    return err;
+}
+
+/**
+ * @brief Function to find the inorder successor of one node inside
+ * its red black bucket, using the parent links.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param node pointer to a hash table node from one bucket
+ * @return hash_table_node_t* pointer to the inorder successor or nil if node is the last one
+ */
+static hash_table_node_t* hash_table_node_successor(const hash_table_t * const __restrict__ ht, hash_table_node_t *node) {
+    /* Successor is the minimum node of the right subtree */
+    if (ht->nil != node->right) {
+        return hash_table_root_min_node(ht, node->right);
+    }
+
+    /* Otherwise climb until node is a left child */
+    hash_table_node_t *parent_node = node->parent;
+
+    while ((ht->nil != parent_node) && (parent_node->right == node)) {
+        node = parent_node;
+        parent_node = parent_node->parent;
+    }
+
+    return parent_node;
+}
+
+/**
+ * @brief Function to start an iteration over all the pairs of a hash table.
+ * The iterator is placed before the first pair, call hash_table_iter_next to
+ * move to it. If an incremental rehashing is in progress it is finished first,
+ * walking all the pairs costs more than moving the remaining buckets. No pair
+ * must be inserted while iterating, pairs can be removed just with
+ * hash_table_iter_erase.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param iter pointer to an iterator object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_iter_begin(hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if iterator is valid */
+    if (NULL == iter) {
+        return SCL_NULL_HASH_TABLE_ITER;
+    }
+
+    /* Check if hash table roots are allocated */
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    /* Iterate just one buckets array */
+    hash_table_rehash_finish(ht);
+
+    iter->key = NULL;
+    iter->data = NULL;
+    iter->node = NULL;
+    iter->index = 0;
+    iter->steps = 0;
+    iter->erased = 0;
+
+    /*
+     * Open addressing clusters never cross an empty slot, so start
+     * from one, every pair moved back by a deletion will come from
+     * a slot that was not visited yet
+     */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        while ((iter->index < ht->capacity) && (0 != ht->slots[iter->index].dist)) {
+            ++(iter->index);
         }
     }
 
-    /* Variable to check if fixing is needed */
-    uint8_t need_fixing_tree = 1;
+    /* All good */
+    return SCL_OK;
+}
 
-    /* Set the child of the deleted node */
-    hash_table_node_t *delete_node_child = ht->nil;
+/**
+ * @brief Function to move the iterator to the next pair of the hash table.
+ * The buckets (or slots) are visited in the order they are stored in memory.
+ * On success iter->key and iter->data point to the pair, the data can be
+ * modified, the key must not be modified.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param iter pointer to an iterator object started by hash_table_iter_begin
+ * @return uint8_t 1 if iterator was moved to a pair, 0 if there are no more pairs
+ */
+uint8_t hash_table_iter_next(const hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter) {
+    /* Check if input data is valid */
+    if ((NULL == ht) || (NULL == iter)) {
+        return 0;
+    }
 
-    /* Delete node has only one child */
-    if (ht->nil != delete_node->left) {
-        delete_node_child = delete_node->left;
+    if (HASH_ENGINE_RBK != ht->engine) {
+        if (NULL == ht->slots) {
+            return 0;
+        }
 
-        /* Check if deletion will not make a double black exception */
-        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
-            need_fixing_tree = 0;
+        /* An erased slot is checked again because the next pair may be moved into it */
+        if (0 == iter->erased) {
+            iter->index = (iter->index + 1) % ht->capacity;
+            ++(iter->steps);
+        }
 
-            /* Recolor red node into a red one */
-            delete_node_child->color = HASH_BLACK;
+        iter->erased = 0;
+
+        /* Skip the empty slots */
+        while ((iter->steps < ht->capacity) && (0 == ht->slots[iter->index].dist)) {
+            iter->index = (iter->index + 1) % ht->capacity;
+            ++(iter->steps);
         }
 
-        /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+        /* All slots were visited */
+        if (iter->steps >= ht->capacity) {
+            iter->steps = ht->capacity;
+            return 0;
+        }
 
-        /* Update grandparent with it's grandchild */
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
-            } else {
-                delete_node->parent->left = delete_node_child;
-            }
-        } else {
+        iter->key = hash_table_flat_key(ht, iter->index);
+        iter->data = hash_table_flat_data(ht, iter->index);
 
-            /*
-             * Selected node was root
-             * Update a new root
-             */            
-            ht->buckets[bucket_index] = delete_node_child;
+        return 1;
+    }
+
+    if (NULL == ht->buckets) {
+        return 0;
+    }
+
+    /* Move to the inorder successor, the successor of an erased node is already known */
+    if ((NULL != iter->node) && (0 == iter->erased)) {
+        hash_table_node_t *next_node = hash_table_node_successor(ht, iter->node);
+
+        if (ht->nil != next_node) {
+            iter->node = next_node;
+        } else {
+            iter->node = NULL;
+            ++(iter->index);
         }
-    } else if (ht->nil != delete_node->right) {
-        delete_node_child = delete_node->right;
+    }
 
-        /* Check if deletion will not make a double black exception */
-        if ((HASH_RED == delete_node_child->color) && (HASH_BLACK == delete_node->color)) {
-            need_fixing_tree = 0;
+    iter->erased = 0;
+
+    /* Find the next bucket that is not empty */
+    if (NULL == iter->node) {
+        while ((iter->index < ht->capacity) && (ht->nil == ht->buckets[iter->index])) {
+            ++(iter->index);
+        }
 
-            /* Recolor red node into a red one */
-            delete_node_child->color = HASH_BLACK;
+        /* All buckets were visited */
+        if (iter->index >= ht->capacity) {
+            iter->index = ht->capacity;
+            return 0;
         }
 
-        /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+        iter->node = hash_table_root_min_node(ht, ht->buckets[iter->index]);
+    }
 
-        /* Update grandparent with it's grandchild */
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
-            } else {
-                delete_node->parent->left = delete_node_child;
-            }
-        } else {
+    iter->key = iter->node->key;
+    iter->data = iter->node->data;
 
-            /*
-             * Selected node was root
-             * Update a new root
-             */
-            ht->buckets[bucket_index] = delete_node_child;
+    return 1;
+}
+
+/**
+ * @brief Function to remove the current pair of the iterator from the hash
+ * table. The next call of hash_table_iter_next will move the iterator to the
+ * pair following the removed one, so every other pair is still visited once.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param iter pointer to an iterator object placed on a pair by hash_table_iter_next
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_iter_erase(hash_table_t * const __restrict__ ht, hash_table_iter_t * const __restrict__ iter) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if iterator is valid */
+    if (NULL == iter) {
+        return SCL_NULL_HASH_TABLE_ITER;
+    }
+
+    if (HASH_ENGINE_RBK != ht->engine) {
+        if (NULL == ht->slots) {
+            return SCL_NULL_HASH_ROOTS;
         }
-    } else {
 
-        /* Check if deletion will not make a double black exception */ 
-        if (HASH_RED == delete_node->color) {
-            need_fixing_tree = 0;
+        /* Check if iterator is placed on a pair */
+        if ((0 != iter->erased) || (0 == iter->steps) || (iter->steps >= ht->capacity) || (0 == ht->slots[iter->index].dist)) {
+            return SCL_DATA_NOT_FOUND_FOR_DELETE;
         }
 
-        // Update parent's links to nil node
-        if (ht->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = ht->nil;
-            } else {
-                delete_node->parent->left = ht->nil;
-            }
-        } else {
+        /* Pairs after the slot are moved back, so the slot will be checked again */
+        hash_table_flat_delete_slot(ht, iter->index);
+    } else {
+        if (NULL == ht->buckets) {
+            return SCL_NULL_HASH_ROOTS;
+        }
 
-            /*
-             * Selected node was root
-             * Update a new root
-             */
-            ht->buckets[bucket_index] = ht->nil;
+        /* Check if iterator is placed on a node */
+        if ((0 != iter->erased) || (NULL == iter->node)) {
+            return SCL_DATA_NOT_FOUND_FOR_DELETE;
         }
-    }
 
-    hash_table_node_t *parent_delete_node = delete_node->parent;
+        /* Nodes are relinked by deletion, so the successor stays valid */
+        hash_table_node_t *next_node = hash_table_node_successor(ht, iter->node);
 
-    /* Free node from hash table */
-    free_hash_table_node(ht, &delete_node);
+        scl_error_t err = hash_table_delete_node(ht, iter->index, iter->node);
 
-    /* Deacrease tree size  */
-    --(ht->size);
+        if (ht->nil != next_node) {
+            iter->node = next_node;
+        } else {
+            iter->node = NULL;
+            ++(iter->index);
+        }
 
-    /* Check if fixing is needed */
-    if (0 != need_fixing_tree) {
-        return hash_table_delete_fix_node_up(ht, bucket_index, delete_node_child, parent_delete_node);
+        /* Fixing a bucket having just the root returns an error after the node was removed */
+        if ((SCL_OK != err) && (SCL_FIXING_NULL_TREE_NODE != err)) {
+            return err;
+        }
     }
 
+    iter->key = NULL;
+    iter->data = NULL;
+    iter->erased = 1;
+
     /* All good */
     return SCL_OK;
 }
@@ -1654,22 +3858,25 @@ scl_error_t hash_table_delete_key(hash_table_t * __restrict__ const ht, const vo
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param bucket_index index of the traversed bucket from the buckets array
  * @param action a pointer function to perform an action on one hash table node object
  */
-static void hash_table_bucket_traverse_inorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+static void hash_table_bucket_traverse_inorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, size_t bucket_index, action_func action) {
     /* Check if current working hash table node is not nil */
     if (ht->nil == bucket) {
         return;
     }
 
     /* Traverse in the left sub-tree */
-    hash_table_bucket_traverse_inorder_helper(ht, bucket->left, action);
+    hash_table_bucket_traverse_inorder_helper(ht, bucket->left, bucket_index, action);
     
-    /* Call action function */
-    action(bucket->data);
+    /* Call action function (old buckets hold nodes of other buckets too) */
+    if ((NULL == ht->old_buckets) || (bucket_index == hash_table_bucket_index(ht, bucket->key))) {
+        action(bucket->data);
+    }
 
     /* Traverse in the right sub-tree */
-    hash_table_bucket_traverse_inorder_helper(ht, bucket->right, action);
+    hash_table_bucket_traverse_inorder_helper(ht, bucket->right, bucket_index, action);
 }
 
 /**
@@ -1695,6 +3902,11 @@ scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __rest
         return SCL_NULL_ACTION_FUNC;
     }
 
+    /* Every slot of open addressing engines holds at most one pair */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_bucket_traverse(ht, bucket_index, action);
+    }
+
     /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
@@ -1705,7 +3917,10 @@ scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __rest
 
     printf("(%ld): ", bucket_index);
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    /* Old bucket of the selected bucket if an incremental rehashing is in progress */
+    const hash_table_node_t * const old_bucket = (NULL != ht->old_buckets) ? ht->old_buckets[bucket_index % ht->old_capacity] : ht->nil;
+
+    if ((ht->nil == ht->buckets[bucket_index]) && (ht->nil == old_bucket)) {
 
         /* Tree(Bucket) is empty no node to traverse */
         printf("(Null)");
@@ -1713,7 +3928,8 @@ scl_error_t hash_table_bucket_traverse_inorder(const hash_table_t * const __rest
     else {
 
         /* Call helper function and traverse all nodes */
-        hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[bucket_index], action);
+        hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[bucket_index], bucket_index, action);
+        hash_table_bucket_traverse_inorder_helper(ht, old_bucket, bucket_index, action);
     }
 
     /* All good */
@@ -1743,7 +3959,7 @@ scl_error_t hash_table_traverse_inorder(const hash_table_t * const __restrict__
     }
 
     /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
         return SCL_NULL_HASH_ROOTS;
     }
 
@@ -1772,22 +3988,25 @@ scl_error_t hash_table_traverse_inorder(const hash_table_t * const __restrict__
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param bucket_index index of the traversed bucket from the buckets array
  * @param action a pointer function to perform an action on one hash table node object
  */
-static void hash_table_bucket_traverse_preorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+static void hash_table_bucket_traverse_preorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, size_t bucket_index, action_func action) {
     /* Check if current working hash table node is not nil */
     if (ht->nil == bucket) {
         return;
     }
 
-    /* Call action function */
-    action(bucket->data);
+    /* Call action function (old buckets hold nodes of other buckets too) */
+    if ((NULL == ht->old_buckets) || (bucket_index == hash_table_bucket_index(ht, bucket->key))) {
+        action(bucket->data);
+    }
 
     /* Traverse in the left sub-tree */
-    hash_table_bucket_traverse_preorder_helper(ht, bucket->left, action);
+    hash_table_bucket_traverse_preorder_helper(ht, bucket->left, bucket_index, action);
 
     /* Traverse in the right sub-tree */
-    hash_table_bucket_traverse_preorder_helper(ht, bucket->right, action);
+    hash_table_bucket_traverse_preorder_helper(ht, bucket->right, bucket_index, action);
 }
 
 /**
@@ -1813,6 +4032,11 @@ scl_error_t hash_table_bucket_traverse_preorder(const hash_table_t * const __res
         return SCL_NULL_ACTION_FUNC;
     }
 
+    /* Every slot of open addressing engines holds at most one pair */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_bucket_traverse(ht, bucket_index, action);
+    }
+
     /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
@@ -1823,7 +4047,10 @@ scl_error_t hash_table_bucket_traverse_preorder(const hash_table_t * const __res
 
     printf("(%ld): ", bucket_index);
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    /* Old bucket of the selected bucket if an incremental rehashing is in progress */
+    const hash_table_node_t * const old_bucket = (NULL != ht->old_buckets) ? ht->old_buckets[bucket_index % ht->old_capacity] : ht->nil;
+
+    if ((ht->nil == ht->buckets[bucket_index]) && (ht->nil == old_bucket)) {
 
         /* Tree(Bucket) is empty no node to traverse */
         printf("(Null)");
@@ -1831,7 +4058,8 @@ scl_error_t hash_table_bucket_traverse_preorder(const hash_table_t * const __res
     else {
 
         /* Call helper function and traverse all nodes */
-        hash_table_bucket_traverse_preorder_helper(ht, ht->buckets[bucket_index], action);
+        hash_table_bucket_traverse_preorder_helper(ht, ht->buckets[bucket_index], bucket_index, action);
+        hash_table_bucket_traverse_preorder_helper(ht, old_bucket, bucket_index, action);
     }
 
     /* All good */
@@ -1861,7 +4089,7 @@ scl_error_t hash_table_traverse_preorder(const hash_table_t * const __restrict__
     }
 
     /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
         return SCL_NULL_HASH_ROOTS;
     }
 
@@ -1890,22 +4118,25 @@ scl_error_t hash_table_traverse_preorder(const hash_table_t * const __restrict__
  * 
  * @param ht pointer to an allocated hash table memory location
  * @param bucket starting point of the red-black tree(bucket) traversal
+ * @param bucket_index index of the traversed bucket from the buckets array
  * @param action a pointer function to perform an action on one hash table node object
  */
-static void hash_table_bucket_traverse_postorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, action_func action) {
+static void hash_table_bucket_traverse_postorder_helper(const hash_table_t * const __restrict__ ht, const hash_table_node_t * const __restrict__ bucket, size_t bucket_index, action_func action) {
     /* Check if current working hash table node is not nil */
     if (ht->nil == bucket) {
         return;
     }
 
     /* Traverse in the left sub-tree */
-    hash_table_bucket_traverse_postorder_helper(ht, bucket->left, action);
+    hash_table_bucket_traverse_postorder_helper(ht, bucket->left, bucket_index, action);
 
     /* Traverse in the right sub-tree */
-    hash_table_bucket_traverse_postorder_helper(ht, bucket->right, action);
+    hash_table_bucket_traverse_postorder_helper(ht, bucket->right, bucket_index, action);
 
-    /* Call action function */
-    action(bucket->data);
+    /* Call action function (old buckets hold nodes of other buckets too) */
+    if ((NULL == ht->old_buckets) || (bucket_index == hash_table_bucket_index(ht, bucket->key))) {
+        action(bucket->data);
+    }
 }
 
 /**
@@ -1931,6 +4162,11 @@ scl_error_t hash_table_bucket_traverse_postorder(const hash_table_t * const __re
         return SCL_NULL_ACTION_FUNC;
     }
 
+    /* Every slot of open addressing engines holds at most one pair */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_bucket_traverse(ht, bucket_index, action);
+    }
+
     /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
@@ -1941,7 +4177,10 @@ scl_error_t hash_table_bucket_traverse_postorder(const hash_table_t * const __re
 
     printf("(%ld): ", bucket_index);
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    /* Old bucket of the selected bucket if an incremental rehashing is in progress */
+    const hash_table_node_t * const old_bucket = (NULL != ht->old_buckets) ? ht->old_buckets[bucket_index % ht->old_capacity] : ht->nil;
+
+    if ((ht->nil == ht->buckets[bucket_index]) && (ht->nil == old_bucket)) {
 
         /* Tree(Bucket) is empty no node to traverse */
         printf("(Null)");
@@ -1949,7 +4188,8 @@ scl_error_t hash_table_bucket_traverse_postorder(const hash_table_t * const __re
     else {
 
         /* Call helper function and traverse all nodes */
-        hash_table_bucket_traverse_postorder_helper(ht, ht->buckets[bucket_index], action);
+        hash_table_bucket_traverse_postorder_helper(ht, ht->buckets[bucket_index], bucket_index, action);
+        hash_table_bucket_traverse_postorder_helper(ht, old_bucket, bucket_index, action);
     }
 
     /* All good */
@@ -1979,7 +4219,7 @@ scl_error_t hash_table_traverse_postorder(const hash_table_t * const __restrict_
     }
 
     /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
         return SCL_NULL_HASH_ROOTS;
     }
 
@@ -2025,6 +4265,11 @@ scl_error_t hash_table_bucket_traverse_level(const hash_table_t * const __restri
         return SCL_NULL_ACTION_FUNC;
     }
 
+    /* Every slot of open addressing engines holds at most one pair */
+    if (HASH_ENGINE_RBK != ht->engine) {
+        return hash_table_flat_bucket_traverse(ht, bucket_index, action);
+    }
+
     /* Check if hash table roots are allocated */
     if (NULL == ht->buckets) {
         return SCL_NULL_HASH_ROOTS;
@@ -2035,7 +4280,10 @@ scl_error_t hash_table_bucket_traverse_level(const hash_table_t * const __restri
 
     printf("(%ld): ", bucket_index);
 
-    if (ht->nil == ht->buckets[bucket_index]) {
+    /* Old bucket of the selected bucket if an incremental rehashing is in progress */
+    hash_table_node_t * const old_bucket = (NULL != ht->old_buckets) ? ht->old_buckets[bucket_index % ht->old_capacity] : ht->nil;
+
+    if ((ht->nil == ht->buckets[bucket_index]) && (ht->nil == old_bucket)) {
 
         /* Tree(Bucket) is empty no node to traverse */
         printf("(Null)");
@@ -2051,10 +4299,21 @@ scl_error_t hash_table_bucket_traverse_level(const hash_table_t * const __restri
             scl_error_t err = SCL_OK;
 
             /* Push pointer to root node into qeuue */
-            err = queue_push(level_queue, &ht->buckets[bucket_index]);
+            if (ht->nil != ht->buckets[bucket_index]) {
+                err = queue_push(level_queue, &ht->buckets[bucket_index]);
 
-            if (SCL_OK != err) {
-                return err;
+                if (SCL_OK != err) {
+                    return err;
+                }
+            }
+
+            /* Push pointer to old root node into queue */
+            if (ht->nil != old_bucket) {
+                err = queue_push(level_queue, &old_bucket);
+
+                if (SCL_OK != err) {
+                    return err;
+                }
             }
 
             /* Traverse all nodes */
@@ -2070,8 +4329,10 @@ scl_error_t hash_table_bucket_traverse_level(const hash_table_t * const __restri
                     return err;
                 }
 
-                /* Call action function on front node */
-                action(front_node->data);
+                /* Call action function on front node (old buckets hold nodes of other buckets too) */
+                if ((NULL == ht->old_buckets) || (bucket_index == hash_table_bucket_index(ht, front_node->key))) {
+                    action(front_node->data);
+                }
 
                 /* Push on queue front left child if it exists */
                 if (ht->nil != front_node->left) {
@@ -2126,7 +4387,7 @@ scl_error_t hash_table_traverse_level(const hash_table_t * const __restrict__ ht
     }
 
     /* Check if hash table roots are allocated */
-    if (NULL == ht->buckets) {
+    if ((NULL == ht->buckets) && (NULL == ht->slots)) {
         return SCL_NULL_HASH_ROOTS;
     }
 
@@ -2147,3 +4408,360 @@ scl_error_t hash_table_traverse_level(const hash_table_t * const __restrict__ ht
     /* All good */
     return SCL_OK;
 }
+
+/**
+ * @brief Function to round up an offset inside one snapshot file, so
+ * the arrays start on a cache line of the mapped pages.
+ * 
+ * @param offset offset in bytes from the beginning of the file
+ * @return uint64_t aligned offset
+ */
+static uint64_t hash_table_snapshot_align(uint64_t offset) {
+    return (offset + DEFAULT_HASH_SNAPSHOT_ALIGN - 1) & ~((uint64_t)DEFAULT_HASH_SNAPSHOT_ALIGN - 1);
+}
+
+/**
+ * @brief Function to write a snapshot of the hash table into a file. The
+ * pairs are placed into a power of two robin hood table and its slots and
+ * inline pairs are written as they are, after a fixed size header, so the
+ * file can be mapped and searched without rebuilding anything. Just the
+ * bytes of the keys and of the data are written, so the pairs must not
+ * point to other memory (the free functions of the hash table must be `NULL`,
+ * otherwise SCL_INVALID_INPUT is returned and no file is written).
+ * The hash function must give the same value for a key in every process.
+ * 
+ * @param ht pointer to an allocated hash table memory location
+ * @param path path of the file to create or to overwrite
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_save_snapshot(hash_table_t * const __restrict__ ht, const char * const __restrict__ path) {
+    /* Check if hash table is allocated */
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    /* Check if path is valid */
+    if (NULL == path) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Pairs owning other memory cannot be written as bytes */
+    if ((NULL != ht->frd_key) || (NULL != ht->frd_dt)) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Place the pairs into a robin hood table of the snapshot layout */
+    hash_table_t *snapshot_table = create_hash_table_with_engine(0, ht->hash, ht->cmp_key, ht->cmp_dt, NULL, NULL, ht->key_size, ht->data_size, HASH_ENGINE_ROBIN_HOOD);
+
+    if (NULL == snapshot_table) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    scl_error_t err = hash_table_set_pow2_capacity(snapshot_table, 1);
+
+    if (SCL_OK == err) {
+        err = hash_table_reserve(snapshot_table, ht->size);
+    }
+
+    hash_table_iter_t iter;
+
+    if (SCL_OK == err) {
+        err = hash_table_iter_begin(ht, &iter);
+    }
+
+    while ((SCL_OK == err) && (1 == hash_table_iter_next(ht, &iter))) {
+        err = hash_table_insert(snapshot_table, iter.key, iter.data);
+    }
+
+    if (SCL_OK != err) {
+        free_hash_table(snapshot_table);
+        return err;
+    }
+
+    /* Clear the bytes of the empty slots, they are written too */
+    for (size_t iter_slot = 0; iter_slot < snapshot_table->capacity; ++iter_slot) {
+        if (0 == snapshot_table->slots[iter_slot].dist) {
+            memset(hash_table_flat_key(snapshot_table, iter_slot), 0, snapshot_table->entry_size);
+        }
+    }
+
+    /* Compute the layout of the file */
+    hash_table_snapshot_header_t header;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "SCLHTSNP", sizeof(header.magic));
+
+    header.version = DEFAULT_HASH_SNAPSHOT_VERSION;
+    header.byte_order = DEFAULT_HASH_SNAPSHOT_BYTE_ORDER;
+    header.hash_bits = (uint32_t)(sizeof(size_t) * 8);
+    header.key_size = snapshot_table->key_size;
+    header.data_size = snapshot_table->data_size;
+    header.data_offset = snapshot_table->data_offset;
+    header.entry_size = snapshot_table->entry_size;
+    header.capacity = snapshot_table->capacity;
+    header.size = snapshot_table->size;
+    header.slots_offset = hash_table_snapshot_align(sizeof(header));
+    header.entries_offset = hash_table_snapshot_align(header.slots_offset + header.capacity * sizeof(*snapshot_table->slots));
+    header.file_size = header.entries_offset + header.capacity * header.entry_size;
+
+    /* Write the header, the slots and the pairs with zero padding between them */
+    static const uint8_t padding[DEFAULT_HASH_SNAPSHOT_ALIGN] = { 0 };
+    FILE *file = fopen(path, "wb");
+
+    err = SCL_SNAPSHOT_WRITE_FAILED;
+
+    if (NULL != file) {
+        if ((1 == fwrite(&header, sizeof(header), 1, file)) &&
+            (header.slots_offset - sizeof(header) == fwrite(padding, 1, header.slots_offset - sizeof(header), file)) &&
+            (snapshot_table->capacity == fwrite(snapshot_table->slots, sizeof(*snapshot_table->slots), snapshot_table->capacity, file)) &&
+            (header.entries_offset - header.slots_offset - header.capacity * sizeof(*snapshot_table->slots) ==
+                fwrite(padding, 1, header.entries_offset - header.slots_offset - header.capacity * sizeof(*snapshot_table->slots), file)) &&
+            (snapshot_table->capacity == fwrite(snapshot_table->entries, snapshot_table->entry_size, snapshot_table->capacity, file))) {
+            err = SCL_OK;
+        }
+
+        if (0 != fclose(file)) {
+            err = SCL_SNAPSHOT_WRITE_FAILED;
+        }
+    }
+
+    free_hash_table(snapshot_table);
+
+    return err;
+}
+
+/**
+ * @brief Function to check the header and the slots metadata of one
+ * mapped snapshot file before any lookup reads the arrays of the file.
+ * A pair cannot be further from its home slot than the number of pairs,
+ * so no lookup of a valid snapshot walks around the whole table.
+ * 
+ * @param header pointer to the header at the beginning of the mapped file
+ * @param map_size length in bytes of the mapped file
+ * @param key_size length in bytes of the key data type expected by the caller
+ * @param data_size length in bytes of the data data type expected by the caller
+ * @return uint8_t 1 if the snapshot is valid, 0 otherwise
+ */
+static uint8_t hash_table_snapshot_is_valid(const hash_table_snapshot_header_t * const __restrict__ header, size_t map_size, size_t key_size, size_t data_size) {
+    /* Check that the file was written by this format on a compatible system */
+    if ((0 != memcmp(header->magic, "SCLHTSNP", sizeof(header->magic))) || (DEFAULT_HASH_SNAPSHOT_VERSION != header->version) ||
+        (DEFAULT_HASH_SNAPSHOT_BYTE_ORDER != header->byte_order) || (sizeof(size_t) * 8 != header->hash_bits)) {
+        return 0;
+    }
+
+    /* Check that the pairs have the expected types */
+    if ((0 == key_size) || (0 == data_size) || (key_size != header->key_size) || (data_size != header->data_size)) {
+        return 0;
+    }
+
+    /* Check that the pairs have the aligned layout of the writer */
+    size_t data_offset = 0;
+    size_t entry_size = 0;
+
+    hash_table_entry_layout(key_size, data_size, &data_offset, &entry_size);
+
+    if ((data_offset != header->data_offset) || (entry_size != header->entry_size)) {
+        return 0;
+    }
+
+    /* Check that the capacity is a power of two and the table is not full */
+    if ((0 == header->capacity) || (0 != (header->capacity & (header->capacity - 1))) || (header->size >= header->capacity)) {
+        return 0;
+    }
+
+    /* Check that both arrays are inside the file */
+    if ((map_size != header->file_size) || (header->slots_offset < sizeof(*header)) ||
+        (header->slots_offset > map_size) || (header->capacity > (map_size - header->slots_offset) / sizeof(hash_table_slot_t)) ||
+        (header->entries_offset > map_size) || (header->capacity > (map_size - header->entries_offset) / header->entry_size) ||
+        (0 != header->slots_offset % DEFAULT_HASH_SNAPSHOT_ALIGN) || (0 != header->entries_offset % DEFAULT_HASH_SNAPSHOT_ALIGN)) {
+        return 0;
+    }
+
+    /* Check the probe distance of every pair and the number of pairs */
+    const hash_table_slot_t * const slots = (const hash_table_slot_t *)((const uint8_t *)header + header->slots_offset);
+    uint64_t number_of_pairs = 0;
+
+    for (uint64_t iter = 0; iter < header->capacity; ++iter) {
+        if (0 != slots[iter].dist) {
+            if (header->size < slots[iter].dist) {
+                return 0;
+            }
+
+            ++number_of_pairs;
+        }
+    }
+
+    return (header->size == number_of_pairs) ? 1 : 0;
+}
+
+/**
+ * @brief Function to open a snapshot file written by hash_table_save_snapshot.
+ * The file is mapped read only and the lookups search the mapped pages, so
+ * no pair is read or rebuilt when the snapshot is opened (just the slots
+ * metadata is checked once) and the pages of the pairs are loaded by the
+ * system when they are first used (and shared between all the processes
+ * mapping the same file). The hash and compare functions must be
+ * the same as the functions of the saved hash table. Function may fail if
+ * the file cannot be mapped or it is not a valid snapshot of the same types.
+ * 
+ * @param path path of the snapshot file
+ * @param hash pointer to a function to hash the key into a size_t type
+ * @param cmp_key pointer to a function to compare two sets of key
+ * @param key_size length in bytes of the key data type
+ * @param data_size length in bytes of the data data type
+ * @return hash_table_snapshot_t* a new opened snapshot object or `NULL` (if function fails)
+ */
+hash_table_snapshot_t* open_hash_table_snapshot(const char * const __restrict__ path, hash_func hash, compare_func cmp_key, size_t key_size, size_t data_size) {
+    /* Check if hash function and compare function are valid */
+    if ((NULL == path) || (NULL == hash) || (NULL == cmp_key)) {
+        errno = EINVAL;
+        perror("Path, compare or hash functions undefined in hash table snapshot");
+        return NULL;
+    }
+
+    /* Map the whole file, the descriptor is not needed after mapping */
+    int fd = open(path, O_RDONLY);
+
+    if (-1 == fd) {
+        perror("Hash table snapshot cannot be opened");
+        return NULL;
+    }
+
+    struct stat file_stat;
+
+    if ((0 != fstat(fd, &file_stat)) || ((size_t)file_stat.st_size < sizeof(hash_table_snapshot_header_t))) {
+        close(fd);
+
+        errno = EINVAL;
+        perror("Hash table snapshot is too short");
+
+        return NULL;
+    }
+
+    size_t map_size = (size_t)file_stat.st_size;
+    void *map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (MAP_FAILED == map) {
+        perror("Hash table snapshot cannot be mapped");
+        return NULL;
+    }
+
+    const hash_table_snapshot_header_t * const header = map;
+
+    if (0 == hash_table_snapshot_is_valid(header, map_size, key_size, data_size)) {
+        munmap(map, map_size);
+
+        errno = EINVAL;
+        perror("Hash table snapshot is not valid");
+
+        return NULL;
+    }
+
+    /* Allocate a new snapshot object on heap */
+    hash_table_snapshot_t *new_snapshot = calloc(1, sizeof(*new_snapshot));
+
+    if (NULL == new_snapshot) {
+        munmap(map, map_size);
+
+        errno = ENOMEM;
+        perror("Not enough memory for hash table snapshot allocation");
+
+        return NULL;
+    }
+
+    new_snapshot->map = map;
+    new_snapshot->map_size = map_size;
+
+    /* The arrays of the view point into the mapped pages and are never written */
+    hash_table_t * const table = &new_snapshot->table;
+
+    table->hash = hash;
+    table->cmp_key = cmp_key;
+    table->key_size = key_size;
+    table->data_size = data_size;
+    table->data_offset = (size_t)header->data_offset;
+    table->entry_size = (size_t)header->entry_size;
+    table->capacity = (size_t)header->capacity;
+    table->size = (size_t)header->size;
+    table->engine = HASH_ENGINE_ROBIN_HOOD;
+    table->pow2_capacity = 1;
+    table->slots = (hash_table_slot_t *)((uint8_t *)map + header->slots_offset);
+    table->entries = (uint8_t *)map + header->entries_offset;
+
+    return new_snapshot;
+}
+
+/**
+ * @brief Function to unmap one snapshot file and to free the snapshot
+ * object. The pointers returned by the lookups are no longer valid.
+ * Function will not automatically move snapshot pointer to `NULL`.
+ * 
+ * @param snapshot pointer to an opened hash table snapshot
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t close_hash_table_snapshot(hash_table_snapshot_t * const __restrict__ snapshot) {
+    /* Check if snapshot is opened */
+    if (NULL == snapshot) {
+        return SCL_NULL_HASH_TABLE_SNAPSHOT;
+    }
+
+    munmap(snapshot->map, snapshot->map_size);
+    free(snapshot);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to find the data of one key from a snapshot. The
+ * returned pointer points into the mapped file and it is valid until
+ * the snapshot is closed.
+ * 
+ * @param snapshot pointer to an opened hash table snapshot
+ * @param key pointer to a location of a value representing key of the hash
+ * @return const void* pointer to the data of the key or `NULL` if key is not in the snapshot
+ */
+const void* hash_table_snapshot_find_data(const hash_table_snapshot_t * const __restrict__ snapshot, const void * const __restrict__ key) {
+    /* Check if input data is valid */
+    if ((NULL == snapshot) || (NULL == key)) {
+        return NULL;
+    }
+
+    return hash_table_find_data(&snapshot->table, key);
+}
+
+/**
+ * @brief Function to find the data of many keys from a snapshot, the slots
+ * of a group of keys are prefetched before they are searched, as for
+ * hash_table_find_batch.
+ * 
+ * @param snapshot pointer to an opened hash table snapshot
+ * @param keys pointer to an array of keys stored one after another
+ * @param number_of_keys number of keys from the keys array
+ * @param data array of number_of_keys pointers to write the data of every key (or `NULL`)
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t hash_table_snapshot_find_batch(const hash_table_snapshot_t * const __restrict__ snapshot, const void * const keys, size_t number_of_keys, const void ** const data) {
+    /* Check if snapshot is opened */
+    if (NULL == snapshot) {
+        return SCL_NULL_HASH_TABLE_SNAPSHOT;
+    }
+
+    return hash_table_find_batch(&snapshot->table, keys, number_of_keys, data);
+}
+
+/**
+ * @brief Function to get the number of pairs of a snapshot.
+ * 
+ * @param snapshot pointer to an opened hash table snapshot
+ * @return size_t number of pairs or `SIZE_MAX` if snapshot is not opened
+ */
+size_t get_hash_table_snapshot_size(const hash_table_snapshot_t * const __restrict__ snapshot) {
+    if (NULL == snapshot) {
+        return SIZE_MAX;
+    }
+
+    return snapshot->table.size;
+}
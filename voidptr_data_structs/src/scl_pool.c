@@ -0,0 +1,276 @@
+/**
+ * @file scl_pool.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "./include/scl_pool.h"
+
+#define DEFAULT_POOL_ALIGN 16
+
+/**
+ * @brief Create a pool object. No chunk is allocated until the first
+ * object is requested. Every object is aligned for any fundamental data
+ * type. Allocation may fail if there is not enough memory on heap or
+ * the sizes are not valid.
+ * 
+ * @param object_size length in bytes of one object
+ * @param objects_per_chunk number of objects allocated at once in one chunk
+ * @return pool_t* a new allocated pool object or `NULL` (if function fails)
+ */
+pool_t* create_pool(size_t object_size, size_t objects_per_chunk) {
+    /* Check if sizes are valid */
+    if ((0 == object_size) || (0 == objects_per_chunk)) {
+        errno = EINVAL;
+        perror("Object size or number of objects per chunk are zero");
+        return NULL;
+    }
+
+    /* Check if one chunk fits in memory, an aligned object is less than object_size + DEFAULT_POOL_ALIGN */
+    if ((object_size > SIZE_MAX - DEFAULT_POOL_ALIGN) ||
+        (objects_per_chunk > (SIZE_MAX - sizeof(pool_chunk_t)) / (object_size + DEFAULT_POOL_ALIGN))) {
+        errno = EINVAL;
+        perror("Object size or number of objects per chunk are too big");
+        return NULL;
+    }
+
+    /* Allocate a new pool object on heap */
+    pool_t *new_pool = malloc(sizeof(*new_pool));
+
+    /* Check if pool was allocated successfully */
+    if (NULL == new_pool) {
+        errno = ENOMEM;
+        perror("Not enough memory for pool allocation");
+
+        return NULL;
+    }
+
+    /* A released object must hold the link of the free list */
+    if (sizeof(void *) > object_size) {
+        object_size = sizeof(void *);
+    }
+
+    new_pool->object_size = (object_size + DEFAULT_POOL_ALIGN - 1) & ~((size_t)DEFAULT_POOL_ALIGN - 1);
+    new_pool->objects_per_chunk = objects_per_chunk;
+
+    /* Set the default values of the pool */
+    new_pool->chunks = NULL;
+    new_pool->free_object = NULL;
+    new_pool->chunk_capacity = 0;
+    new_pool->carved_objects = 0;
+    new_pool->number_of_chunks = 0;
+    new_pool->used_objects = 0;
+
+    return new_pool;
+}
+
+/**
+ * @brief Function to free all the chunks of a pool, every object of
+ * the pool is released at once, whether it was released before or not.
+ * Function will not automatically move pool pointer to `NULL`.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_pool(pool_t * const __restrict__ pool) {
+    /* Check if pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_POOL;
+    }
+
+    /* Free the chunks one by one */
+    while (NULL != pool->chunks) {
+        pool_chunk_t * const next_chunk = pool->chunks->next;
+
+        free(pool->chunks);
+        pool->chunks = next_chunk;
+    }
+
+    /* Free memory of the pool */
+    free(pool);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to allocate a new chunk and to make it the newest
+ * chunk of the pool, the objects left in the previous chunk are
+ * never carved. Function fails if the size of the chunk overflows.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @param number_of_objects number of objects of the new chunk
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t pool_add_chunk(pool_t * const __restrict__ pool, size_t number_of_objects) {
+    /* Check if the size of the chunk overflows */
+    if (number_of_objects > (SIZE_MAX - sizeof(pool_chunk_t)) / pool->object_size) {
+        return SCL_INVALID_INPUT;
+    }
+
+    pool_chunk_t *new_chunk = malloc(sizeof(*new_chunk) + pool->object_size * number_of_objects);
+
+    if (NULL == new_chunk) {
+        errno = ENOMEM;
+        perror("Not enough memory for pool chunk allocation");
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    new_chunk->next = pool->chunks;
+    pool->chunks = new_chunk;
+    pool->chunk_capacity = number_of_objects;
+    pool->carved_objects = 0;
+    ++(pool->number_of_chunks);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get one object from the pool. A released object is
+ * reused first, otherwise the object is carved from the newest chunk and
+ * a new chunk is allocated just when the newest one is full.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @return void* pointer to an uninitialized object or `NULL` (if function fails)
+ */
+void* pool_alloc(pool_t * const __restrict__ pool) {
+    /* Check if pool is allocated */
+    if (NULL == pool) {
+        return NULL;
+    }
+
+    void *object = pool->free_object;
+
+    if (NULL != object) {
+
+        /* Take the first released object */
+        memcpy(&pool->free_object, object, sizeof(pool->free_object));
+    } else {
+
+        /* Allocate a new chunk if the newest one is full */
+        if ((pool->chunk_capacity == pool->carved_objects) && (SCL_OK != pool_add_chunk(pool, pool->objects_per_chunk))) {
+            return NULL;
+        }
+
+        /* Carve the next object of the newest chunk */
+        object = pool->chunks->objects + pool->carved_objects * pool->object_size;
+        ++(pool->carved_objects);
+    }
+
+    ++(pool->used_objects);
+
+    return object;
+}
+
+/**
+ * @brief Function to release one object into the pool, the object
+ * will be reused by the next call of pool_alloc. The object must
+ * have been allocated by the same pool.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @param object pointer to an object of the pool
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pool_free(pool_t * const __restrict__ pool, void * const __restrict__ object) {
+    /* Check if pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_POOL;
+    }
+
+    /* Check if object is valid */
+    if (NULL == object) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Link the object at the beginning of the free list */
+    memcpy(object, &pool->free_object, sizeof(pool->free_object));
+    pool->free_object = object;
+
+    --(pool->used_objects);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to make sure that the next objects carved from the pool
+ * are contiguous. If the newest chunk has not enough objects left, a new
+ * chunk holding at least number_of_objects objects is allocated. The
+ * released objects are still reused first by pool_alloc. Function fails
+ * if number_of_objects objects do not fit in one chunk.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @param number_of_objects number of objects to carve one after another
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t pool_reserve(pool_t * const __restrict__ pool, size_t number_of_objects) {
+    /* Check if pool is allocated */
+    if (NULL == pool) {
+        return SCL_NULL_POOL;
+    }
+
+    /* Check if the objects fit in one chunk */
+    if (number_of_objects > (SIZE_MAX - sizeof(pool_chunk_t)) / pool->object_size) {
+        return SCL_INVALID_INPUT;
+    }
+
+    /* Newest chunk has enough objects left */
+    if (pool->chunk_capacity - pool->carved_objects >= number_of_objects) {
+        return SCL_OK;
+    }
+
+    if (pool->objects_per_chunk > number_of_objects) {
+        number_of_objects = pool->objects_per_chunk;
+    }
+
+    return pool_add_chunk(pool, number_of_objects);
+}
+
+/**
+ * @brief Function to get the number of objects handed out by
+ * the pool and not released yet.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @return size_t number of used objects or `SIZE_MAX` if pool is not allocated
+ */
+size_t get_pool_used_objects(const pool_t * const __restrict__ pool) {
+    if (NULL == pool) {
+        return SIZE_MAX;
+    }
+
+    return pool->used_objects;
+}
+
+/**
+ * @brief Function to get the number of chunks allocated by the pool.
+ * 
+ * @param pool pointer to an allocated pool memory location
+ * @return size_t number of chunks or `SIZE_MAX` if pool is not allocated
+ */
+size_t get_pool_number_of_chunks(const pool_t * const __restrict__ pool) {
+    if (NULL == pool) {
+        return SIZE_MAX;
+    }
+
+    return pool->number_of_chunks;
+}
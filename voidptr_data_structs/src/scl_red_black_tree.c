@@ -23,7 +23,204 @@
  */
 
 #include "./include/scl_red_black_tree.h"
-#include "./include/scl_queue.h"
+#include "./include/scl_sort_algo.h"
+
+/* Offset of the data inside one pooled object, the data follows its node */
+#define RBK_POOL_DATA_OFFSET ((sizeof(rbk_tree_node_t) + 15) & ~((size_t)15))
+
+/* Number of searches walked in lockstep by rbk_find_batch */
+#define DEFAULT_RBK_BATCH_SIZE 16
+
+#if defined(__GNUC__)
+#define RBK_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+#define RBK_PREFETCH(addr) ((void)(addr))
+#endif
+
+#if defined(SCL_RBK_PACKED_NODES)
+
+/* Lowest bit of the parent link of a packed node, set for black nodes */
+#define RBK_PACKED_COLOR_MASK ((uintptr_t)1)
+
+/**
+ * @brief Function to get the parent of a red-black tree node,
+ * the color bit is cleared from the packed parent link.
+ * 
+ * @param node a red-black tree node object
+ * @return rbk_tree_node_t* parent of the node
+ */
+static rbk_tree_node_t* rbk_get_node_parent(const rbk_tree_node_t * const __restrict__ node) {
+    return (rbk_tree_node_t *)(node->parent_color & ~RBK_PACKED_COLOR_MASK);
+}
+
+/**
+ * @brief Function to set the parent of a red-black tree node
+ * keeping the color bit of the packed parent link.
+ * 
+ * @param node a red-black tree node object
+ * @param parent new parent of the node
+ */
+static void rbk_set_node_parent(rbk_tree_node_t * const node, rbk_tree_node_t * const parent) {
+    node->parent_color = (uintptr_t)parent | (node->parent_color & RBK_PACKED_COLOR_MASK);
+}
+
+/**
+ * @brief Function to get the color of a red-black tree node
+ * from the lowest bit of the packed parent link.
+ * 
+ * @param node a red-black tree node object
+ * @return rbk_tree_node_color_t color of the node
+ */
+static rbk_tree_node_color_t rbk_get_node_color(const rbk_tree_node_t * const __restrict__ node) {
+    return (0 != (node->parent_color & RBK_PACKED_COLOR_MASK)) ? BLACK : RED;
+}
+
+/**
+ * @brief Function to set the color of a red-black tree node
+ * into the lowest bit of the packed parent link.
+ * 
+ * @param node a red-black tree node object
+ * @param color new color of the node
+ */
+static void rbk_set_node_color(rbk_tree_node_t * const __restrict__ node, rbk_tree_node_color_t color) {
+    node->parent_color = (node->parent_color & ~RBK_PACKED_COLOR_MASK) | ((BLACK == color) ? RBK_PACKED_COLOR_MASK : 0);
+}
+
+/**
+ * @brief Packed nodes keep no duplicates counter,
+ * every node holds its data once.
+ * 
+ * @param node a red-black tree node object
+ * @return uint32_t always 1
+ */
+static uint32_t rbk_get_node_count(const rbk_tree_node_t * const __restrict__ node) {
+    return 1;
+}
+
+/**
+ * @brief Packed nodes keep no duplicates counter,
+ * inserting data already in the tree changes nothing.
+ * 
+ * @param node a red-black tree node object
+ * @param count ignored count
+ */
+static void rbk_set_node_count(rbk_tree_node_t * const __restrict__ node, uint32_t count) {
+    /* Nothing to store */
+}
+
+#else
+
+/**
+ * @brief Function to get the parent of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @return rbk_tree_node_t* parent of the node
+ */
+static rbk_tree_node_t* rbk_get_node_parent(const rbk_tree_node_t * const __restrict__ node) {
+    return node->parent;
+}
+
+/**
+ * @brief Function to set the parent of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @param parent new parent of the node
+ */
+static void rbk_set_node_parent(rbk_tree_node_t * const node, rbk_tree_node_t * const parent) {
+    node->parent = parent;
+}
+
+/**
+ * @brief Function to get the color of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @return rbk_tree_node_color_t color of the node
+ */
+static rbk_tree_node_color_t rbk_get_node_color(const rbk_tree_node_t * const __restrict__ node) {
+    return node->color;
+}
+
+/**
+ * @brief Function to set the color of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @param color new color of the node
+ */
+static void rbk_set_node_color(rbk_tree_node_t * const __restrict__ node, rbk_tree_node_color_t color) {
+    node->color = color;
+}
+
+/**
+ * @brief Function to get the number of insertions
+ * of the data of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @return uint32_t count of the node
+ */
+static uint32_t rbk_get_node_count(const rbk_tree_node_t * const __restrict__ node) {
+    return node->count;
+}
+
+/**
+ * @brief Function to set the number of insertions
+ * of the data of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @param count new count of the node
+ */
+static void rbk_set_node_count(rbk_tree_node_t * const __restrict__ node, uint32_t count) {
+    node->count = count;
+}
+
+#endif /* SCL_RBK_PACKED_NODES */
+
+#if defined(SCL_TREE_ORDER_STATISTICS) && !defined(SCL_RBK_PACKED_NODES)
+
+/**
+ * @brief Function to get the weight of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @return size_t weight of the node
+ */
+static size_t rbk_get_node_weight(const rbk_tree_node_t * const __restrict__ node) {
+    return node->weight;
+}
+
+/**
+ * @brief Function to set the weight of a red-black tree node.
+ * 
+ * @param node a red-black tree node object
+ * @param weight new weight of the node
+ */
+static void rbk_set_node_weight(rbk_tree_node_t * const __restrict__ node, size_t weight) {
+    node->weight = weight;
+}
+
+#else
+
+/**
+ * @brief Nodes keep no weight without SCL_TREE_ORDER_STATISTICS
+ * or with packed nodes, order statistics cannot be enabled.
+ * 
+ * @param node a red-black tree node object
+ * @return size_t always 0
+ */
+static size_t rbk_get_node_weight(const rbk_tree_node_t * const __restrict__ node) {
+    return 0;
+}
+
+/**
+ * @brief Nodes keep no weight without SCL_TREE_ORDER_STATISTICS
+ * or with packed nodes, order statistics cannot be enabled.
+ * 
+ * @param node a red-black tree node object
+ * @param weight ignored weight
+ */
+static void rbk_set_node_weight(rbk_tree_node_t * const __restrict__ node, size_t weight) {
+    /* Nothing to store */
+}
+
+#endif /* SCL_TREE_ORDER_STATISTICS */
 
 /**
  * @brief Create a red-black tree object. Allocation may fail if there
@@ -33,9 +230,10 @@
  * @param cmp pointer to a function to compare two sets of data
  * @param frd pointer to a function to free content of one data
  * @param data_size length in bytes of the data data type
+ * @param nodes_per_chunk number of nodes allocated at once by the pool of the tree (0 for no pool)
  * @return rbk_tree_t* a new allocated red-black tree object or `NULL` (if function failed)
  */
-rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
+rbk_tree_t* create_rbk_with_pool(compare_func cmp, free_func frd, size_t data_size, size_t nodes_per_chunk) {
     /* Check if compareData function is valid */
     if (NULL == cmp) {
         errno = EINVAL;
@@ -66,10 +264,11 @@ rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
         /* Set default values for a `nil` cell*/
         if (NULL != new_tree->nil) {
             new_tree->nil->data = NULL;
-            new_tree->nil->color = BLACK;
-            new_tree->nil->count = 1;
+            rbk_set_node_color(new_tree->nil, BLACK);
+            rbk_set_node_count(new_tree->nil, 1);
+            rbk_set_node_weight(new_tree->nil, 0);
             new_tree->nil->left = new_tree->nil->right = new_tree->nil;
-            new_tree->nil->parent = new_tree->nil;
+            rbk_set_node_parent(new_tree->nil, new_tree->nil);
         } else {
             errno = ENOMEM;
             perror("Not enough memory for nil red-black allocation");
@@ -79,6 +278,23 @@ rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
         new_tree->root = new_tree->nil;
         new_tree->data_size = data_size;
         new_tree->size = 0;
+
+        /* Weights of the nodes are kept just if order statistics are requested */
+        new_tree->order_statistics = 0;
+
+        /* Nodes and data are carved from chunks just if a pool is requested */
+        new_tree->pool = NULL;
+
+        if (0 != nodes_per_chunk) {
+            new_tree->pool = create_pool(RBK_POOL_DATA_OFFSET + data_size, nodes_per_chunk);
+
+            /* Pool was not allocated wipe tree's memory */
+            if (NULL == new_tree->pool) {
+                free(new_tree->nil);
+                free(new_tree);
+                new_tree = NULL;
+            }
+        }
     } else {
         errno = ENOMEM;
         perror("Not enough memory for red-black allocation");
@@ -88,6 +304,19 @@ rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
     return new_tree;
 }
 
+/**
+ * @brief Create a red-black tree object allocating every node and its data
+ * alone, as create_rbk_with_pool without a pool.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @return rbk_tree_t* a new allocated red-black tree or `NULL` (if function failed)
+ */
+rbk_tree_t* create_rbk(compare_func cmp, free_func frd, size_t data_size) {
+    return create_rbk_with_pool(cmp, frd, data_size, 0);
+}
+
 /**
  * @brief Create an red-black node object. Allocation of a new node
  * may fail if address of data is not valid or if not enough memory
@@ -104,20 +333,21 @@ static rbk_tree_node_t* create_rbk_node(const rbk_tree_t * const __restrict__ tr
         return tree->nil;
     }
 
-    /* Allocate a new node on the heap */
-    rbk_tree_node_t *new_node = malloc(sizeof(*new_node));
+    /* Allocate a new node on the heap (or take one from the pool) */
+    rbk_tree_node_t *new_node = (NULL != tree->pool) ? pool_alloc(tree->pool) : malloc(sizeof(*new_node));
 
     /* Check if allocation went successfully */
     if (NULL != new_node) {
 
         /* Set default node data */
         new_node->right = new_node->left = tree->nil;
-        new_node->parent = tree->nil;
-        new_node->count = 1;
-        new_node->color = RED;
+        rbk_set_node_parent(new_node, tree->nil);
+        rbk_set_node_count(new_node, 1);
+        rbk_set_node_color(new_node, RED);
+        rbk_set_node_weight(new_node, 1);
 
-        /* Allocate heap memory for data */
-        new_node->data = malloc(tree->data_size);
+        /* Allocate heap memory for data, a pooled node keeps its data just after it */
+        new_node->data = (NULL != tree->pool) ? (uint8_t *)new_node + RBK_POOL_DATA_OFFSET : malloc(tree->data_size);
 
         /* Check if memory allocation went right */
         if (NULL != new_node->data) {
@@ -146,41 +376,51 @@ static rbk_tree_node_t* create_rbk_node(const rbk_tree_t * const __restrict__ tr
 
 /**
  * @brief A helper function for free_rbk function.
- * Function will iterate through all nodes recursively
- * by Left-Right-Root principle.
+ * Function will iterate through all nodes by Left-Right-Root
+ * principle without recursion, a leaf is freed and unlinked
+ * from its parent, so the parent may become a leaf.
  * 
  * @param tree an allocated red-black tree object
  * @param root pointer to pointer of current red-black node object
  */
 static void free_rbk_helper(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t ** const __restrict__ root) {
-    /* Check if current node is valid */
-    if (tree->nil == *root) {
-        return;
-    }
+    rbk_tree_node_t *iterator = *root;
 
-    /* Recursive calls */
-    free_rbk_helper(tree, &(*root)->left);
-    free_rbk_helper(tree, &(*root)->right);
+    while (tree->nil != iterator) {
 
-    /* Free content of the data pointer */
-    if ((NULL != tree->frd) && (NULL != (*root)->data)) {
-        tree->frd((*root)->data);
-    }
+        /* Go down until a leaf */
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+            rbk_tree_node_t * const parent_iterator = (*root != iterator) ? rbk_get_node_parent(iterator) : tree->nil;
 
-    /* Free data pointer */
-    if (NULL != (*root)->data) {
-        free((*root)->data);
-    }
+            /* Unlink the leaf from its parent */
+            if (tree->nil != parent_iterator) {
+                if (parent_iterator->left == iterator) {
+                    parent_iterator->left = tree->nil;
+                } else {
+                    parent_iterator->right = tree->nil;
+                }
+            }
 
-    /* Set data pointer as `NULL` */
-    (*root)->data = NULL;
+            /* Free content of the data pointer */
+            if ((NULL != tree->frd) && (NULL != iterator->data)) {
+                tree->frd(iterator->data);
+            }
 
-    /* Free red-black node pointer */
-    if (tree->nil != *root) {
-        free(*root);
+            /* Free data pointer and node, pooled nodes are released with the pool */
+            if (NULL == tree->pool) {
+                free(iterator->data);
+                free(iterator);
+            }
 
-        *root = tree->nil;
+            iterator = parent_iterator;
+        }
     }
+
+    *root = tree->nil;
 }
 
 /**
@@ -198,8 +438,16 @@ scl_error_t free_rbk(rbk_tree_t * const __restrict__ tree) {
     /* Check if tree needs to be freed */
     if (NULL != tree) {
 
-        /* Free every node from red-black tree */
-        free_rbk_helper(tree, &tree->root);
+        /* Free every node, pooled nodes are visited just to free the content of their data */
+        if ((NULL == tree->pool) || (NULL != tree->frd)) {
+            free_rbk_helper(tree, &tree->root);
+        }
+
+        /* Release all pooled nodes at once */
+        if (NULL != tree->pool) {
+            free_pool(tree->pool);
+            tree->pool = NULL;
+        }
         
         /* Free `nil` cell*/
         free(tree->nil);
@@ -215,6 +463,363 @@ scl_error_t free_rbk(rbk_tree_t * const __restrict__ tree) {
     return SCL_NULL_RBK;
 }
 
+/**
+ * @brief Function to compute the number of bits needed to write a number,
+ * it is the height of a balanced tree holding that number of nodes.
+ * 
+ * @param number number to measure
+ * @return size_t number of bits of the number (0 for 0)
+ */
+static size_t rbk_bulk_bit_length(size_t number) {
+    size_t bits = 0;
+
+    while (0 != number) {
+        number >>= 1;
+        ++bits;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Function to prepare the input of a bulk load. The input array is
+ * used as it is if it is sorted and has no duplicates, otherwise a sorted
+ * copy of it is made and every run of equal elements is merged into one
+ * element having a count, as repeated insertions do.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to the input array
+ * @param number_of_data number of elements of the input array
+ * @param work pointer to write the array of distinct elements (the input or an allocated copy)
+ * @param counts pointer to write the counts of the distinct elements (`NULL` if every count is one)
+ * @param number_of_nodes pointer to write the number of distinct elements
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t rbk_bulk_prepare(const rbk_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, uint8_t ** const work, uint32_t ** const counts, size_t * const number_of_nodes) {
+    const uint8_t * const input = data;
+    uint8_t is_sorted_set = 1;
+
+    *work = (uint8_t *)input;
+    *counts = NULL;
+    *number_of_nodes = number_of_data;
+
+    /* Check if the input is strictly increasing */
+    for (size_t iter = 1; iter < number_of_data; ++iter) {
+        if (tree->cmp(input + (iter - 1) * tree->data_size, input + iter * tree->data_size) >= 0) {
+            is_sorted_set = 0;
+            break;
+        }
+    }
+
+    if (1 == is_sorted_set) {
+        return SCL_OK;
+    }
+
+    /* Sort a copy of the input, the input is never modified */
+    uint8_t *sorted_data = malloc(number_of_data * tree->data_size);
+    uint32_t *sorted_counts = malloc(number_of_data * sizeof(*sorted_counts));
+
+    if ((NULL == sorted_data) || (NULL == sorted_counts)) {
+        free(sorted_data);
+        free(sorted_counts);
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    memcpy(sorted_data, input, number_of_data * tree->data_size);
+
+    scl_error_t err = merge_sort(sorted_data, number_of_data, tree->data_size, tree->cmp);
+
+    if (SCL_OK != err) {
+        free(sorted_data);
+        free(sorted_counts);
+
+        return err;
+    }
+
+    /* Merge the runs of equal elements */
+    size_t distinct_data = 0;
+
+    for (size_t iter = 0; iter < number_of_data; ++iter) {
+        const uint8_t * const current_data = sorted_data + iter * tree->data_size;
+
+        if ((0 != distinct_data) && (0 == tree->cmp(current_data, sorted_data + (distinct_data - 1) * tree->data_size))) {
+            ++sorted_counts[distinct_data - 1];
+        } else {
+            if (iter != distinct_data) {
+                memcpy(sorted_data + distinct_data * tree->data_size, current_data, tree->data_size);
+            }
+
+            sorted_counts[distinct_data++] = 1;
+        }
+    }
+
+    *work = sorted_data;
+    *counts = sorted_counts;
+    *number_of_nodes = distinct_data;
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to create the node of the middle element of a range of
+ * distinct elements, the left half of the range goes into its left subtree
+ * and the right half into its right subtree.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param work array of distinct elements
+ * @param counts counts of the distinct elements (`NULL` if every count is one)
+ * @param lo index of the first element of the range
+ * @param hi index after the last element of the range
+ * @param depth depth of the new node (0 for root)
+ * @param height height of the whole tree
+ * @return rbk_tree_node_t* a new node or `nil` if allocation failed
+ */
+static rbk_tree_node_t* rbk_bulk_node(const rbk_tree_t * const __restrict__ tree, const uint8_t * const work, const uint32_t * const counts, size_t lo, size_t hi, size_t depth, size_t height) {
+    size_t middle = lo + (hi - lo - 1) / 2;
+    rbk_tree_node_t *new_node = create_rbk_node(tree, work + middle * tree->data_size);
+
+    if (tree->nil != new_node) {
+        rbk_set_node_count(new_node, (NULL != counts) ? counts[middle] : 1);
+        rbk_set_node_weight(new_node, rbk_get_node_count(new_node));
+
+        /* Just the nodes of the last level are red, the root is always black */
+        rbk_set_node_color(new_node, ((0 != depth) && (depth + 1 == height)) ? RED : BLACK);
+    }
+
+    return new_node;
+}
+
+/**
+ * @brief Function to create the nodes of one level of a bulk loaded tree.
+ * The function goes down from the node of a range until the level above
+ * the new one and creates the children from left to right, so the nodes
+ * are allocated in breadth first order.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param node node of the range [lo, hi)
+ * @param work array of distinct elements
+ * @param counts counts of the distinct elements (`NULL` if every count is one)
+ * @param lo index of the first element of the range
+ * @param hi index after the last element of the range
+ * @param depth depth of the node
+ * @param level depth of the nodes to create
+ * @param height height of the whole tree
+ * @return scl_error_t enum object for handling errors
+ */
+static scl_error_t rbk_bulk_build_level(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const node, const uint8_t * const work, const uint32_t * const counts, size_t lo, size_t hi, size_t depth, size_t level, size_t height) {
+    size_t middle = lo + (hi - lo - 1) / 2;
+
+    /* Go down until the parents of the new level */
+    if (depth + 1 < level) {
+        scl_error_t err = SCL_OK;
+
+        if (tree->nil != node->left) {
+            err = rbk_bulk_build_level(tree, node->left, work, counts, lo, middle, depth + 1, level, height);
+        }
+
+        if ((SCL_OK == err) && (tree->nil != node->right)) {
+            err = rbk_bulk_build_level(tree, node->right, work, counts, middle + 1, hi, depth + 1, level, height);
+        }
+
+        return err;
+    }
+
+    /* Create the children of the node */
+    if (lo < middle) {
+        node->left = rbk_bulk_node(tree, work, counts, lo, middle, level, height);
+
+        if (tree->nil == node->left) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        rbk_set_node_parent(node->left, node);
+        ++(tree->size);
+    }
+
+    if (middle + 1 < hi) {
+        node->right = rbk_bulk_node(tree, work, counts, middle + 1, hi, level, height);
+
+        if (tree->nil == node->right) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        }
+
+        rbk_set_node_parent(node->right, node);
+        ++(tree->size);
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Create a red-black tree object from an array of elements in O(N) for
+ * sorted input, without comparing or rotating anything. The middle element
+ * of every range becomes the root of its subtree, so the tree is perfectly
+ * balanced. All the levels
+ * but the last one are full, so the nodes of the last level are red and
+ * all the other nodes are black. The nodes are allocated in breadth first order, if
+ * the tree has a pool all of them are carved from one chunk. Unsorted input
+ * is sorted first (in a copy) and equal elements are counted as repeated
+ * insertions do. The content of the data is owned by the tree as for
+ * insertion.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param frd pointer to a function to free content of one data
+ * @param data_size length in bytes of the data data type
+ * @param data pointer to an array of number_of_data elements
+ * @param number_of_data number of elements of the array
+ * @param nodes_per_chunk number of nodes allocated at once by the pool of the tree (0 for no pool)
+ * @return rbk_tree_t* a new allocated red-black tree or `NULL` (if function failed)
+ */
+rbk_tree_t* create_rbk_from_sorted(compare_func cmp, free_func frd, size_t data_size, const void * const data, size_t number_of_data, size_t nodes_per_chunk) {
+    /* Check if the input array is valid */
+    if ((NULL == data) && (0 != number_of_data)) {
+        errno = EINVAL;
+        perror("Input array undefined for red-black tree");
+        return NULL;
+    }
+
+    rbk_tree_t *new_tree = create_rbk_with_pool(cmp, frd, data_size, nodes_per_chunk);
+
+    /* Check if the tree was created and if there is something to load */
+    if ((NULL == new_tree) || (NULL == new_tree->nil) || (0 == number_of_data)) {
+        return new_tree;
+    }
+
+    uint8_t *work = NULL;
+    uint32_t *counts = NULL;
+    size_t number_of_nodes = 0;
+
+    scl_error_t err = rbk_bulk_prepare(new_tree, data, number_of_data, &work, &counts, &number_of_nodes);
+
+    /* Carve all the nodes one after another */
+    if ((SCL_OK == err) && (NULL != new_tree->pool)) {
+        err = pool_reserve(new_tree->pool, number_of_nodes);
+    }
+
+    if (SCL_OK == err) {
+        size_t height = rbk_bulk_bit_length(number_of_nodes);
+
+        new_tree->root = rbk_bulk_node(new_tree, work, counts, 0, number_of_nodes, 0, height);
+
+        if (new_tree->nil == new_tree->root) {
+            err = SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+        } else {
+            new_tree->size = 1;
+        }
+
+        /* Create the tree level by level */
+        for (size_t level = 1; (SCL_OK == err) && (level < height); ++level) {
+            err = rbk_bulk_build_level(new_tree, new_tree->root, work, counts, 0, number_of_nodes, 0, level, height);
+        }
+    }
+
+    /* Free the sorted copy of the input */
+    if ((const void *)work != data) {
+        free(work);
+    }
+
+    free(counts);
+
+    if (SCL_OK != err) {
+        free_rbk(new_tree);
+
+        errno = ENOMEM;
+        perror("Not enough memory for red-black tree bulk load");
+
+        return NULL;
+    }
+
+    return new_tree;
+}
+
+/**
+ * @brief Helper function to compute the weights of all the
+ * nodes from a subtree by Left-Right-Root principle.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param root current red-black node object
+ * @return size_t weight of the root node
+ */
+static size_t rbk_weight_helper(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ root) {
+    /* `nil` has no weight */
+    if (tree->nil == root) {
+        return 0;
+    }
+
+    rbk_set_node_weight(root, rbk_weight_helper(tree, root->left) + rbk_weight_helper(tree, root->right) + rbk_get_node_count(root));
+
+    return rbk_get_node_weight(root);
+}
+
+/**
+ * @brief Function to enable or disable the order statistics of a
+ * red-black tree. With order statistics every node keeps the sum of
+ * the counts from its subtree, which is updated by insertions, deletions
+ * and rotations, so rbk_select_data and rbk_rank run in O(log N).
+ * Enabling them on a tree with nodes computes all the weights in O(N).
+ * Order statistics can be enabled just with SCL_TREE_ORDER_STATISTICS
+ * and without SCL_RBK_PACKED_NODES.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param order_statistics 1 to keep the weights of the nodes, 0 otherwise
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_set_order_statistics(rbk_tree_t * const __restrict__ tree, uint8_t order_statistics) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+#if !defined(SCL_TREE_ORDER_STATISTICS) || defined(SCL_RBK_PACKED_NODES)
+
+    /* The nodes have no room for the weights */
+    if (0 != order_statistics) {
+        return SCL_INVALID_INPUT;
+    }
+#endif
+
+    /* The weights were not updated while order statistics were disabled */
+    if ((0 != order_statistics) && (0 == tree->order_statistics)) {
+        rbk_weight_helper(tree, tree->root);
+    }
+
+    tree->order_statistics = (0 != order_statistics);
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to update the weight of a node from its children
+ * if the red-black tree keeps order statistics.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param fix_node a red-black tree node object to update its weight
+ */
+static void rbk_update_node_weight(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ fix_node) {
+    if ((0 != tree->order_statistics) && (tree->nil != fix_node)) {
+        rbk_set_node_weight(fix_node, rbk_get_node_weight(fix_node->left) + rbk_get_node_weight(fix_node->right) + rbk_get_node_count(fix_node));
+    }
+}
+
+/**
+ * @brief Function to update the weights of a node and of all its
+ * ancestors after the subtree of the node has changed.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param fix_node the lowest red-black tree node object with a changed subtree
+ */
+static void rbk_update_weights_up(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * __restrict__ fix_node) {
+    if (0 != tree->order_statistics) {
+        for (; tree->nil != fix_node; fix_node = rbk_get_node_parent(fix_node)) {
+            rbk_update_node_weight(tree, fix_node);
+        }
+    }
+}
+
 /**
  * @brief Function to rotate to left a subtree starting 
  * from fix_node red-black tree node object. Function may fail
@@ -243,28 +848,32 @@ static void rbk_rotate_left(rbk_tree_t * const __restrict__ tree, rbk_tree_node_
 
     /* Update child parent to fix_node */
     if (tree->nil != rotate_node->left) {
-        rotate_node->left->parent = fix_node;
+        rbk_set_node_parent(rotate_node->left, fix_node);
     }
 
     /* Rotation to left */
     rotate_node->left = fix_node;
 
     /* Update new sub-root parent */
-    rotate_node->parent = fix_node->parent;
+    rbk_set_node_parent(rotate_node, rbk_get_node_parent(fix_node));
 
     /* Update fix_node parent to new sub-root */
-    fix_node->parent = rotate_node;
+    rbk_set_node_parent(fix_node, rotate_node);
 
     /* Update new sub-root links to the rest of tree */
-    if (tree->nil != rotate_node->parent) {
-        if (tree->cmp(rotate_node->data, rotate_node->parent->data) >= 1) {
-            rotate_node->parent->right = rotate_node;
+    if (tree->nil != rbk_get_node_parent(rotate_node)) {
+        if (tree->cmp(rotate_node->data, rbk_get_node_parent(rotate_node)->data) >= 1) {
+            rbk_get_node_parent(rotate_node)->right = rotate_node;
         } else {
-            rotate_node->parent->left = rotate_node;
+            rbk_get_node_parent(rotate_node)->left = rotate_node;
         }
     } else {
         tree->root = rotate_node;
     }
+
+    /* Update the weight of rotated red-black tree node objects */
+    rbk_update_node_weight(tree, fix_node);
+    rbk_update_node_weight(tree, rotate_node);
 }
 
 /**
@@ -295,28 +904,32 @@ static void rbk_rotate_right(rbk_tree_t * const __restrict__ tree, rbk_tree_node
 
     /* Update child parent to fix_node */
     if (tree->nil != rotate_node->right) {
-        rotate_node->right->parent = fix_node;
+        rbk_set_node_parent(rotate_node->right, fix_node);
     }
 
     /* Rotation to right */
     rotate_node->right = fix_node;
 
     /* Update new sub-root parent */
-    rotate_node->parent = fix_node->parent;
+    rbk_set_node_parent(rotate_node, rbk_get_node_parent(fix_node));
 
     /* Update fix_node parent to new sub-root */
-    fix_node->parent = rotate_node;
+    rbk_set_node_parent(fix_node, rotate_node);
 
     /* Update new sub-root links to the rest of tree */
-    if (tree->nil != rotate_node->parent) {
-        if (tree->cmp(rotate_node->data, rotate_node->parent->data) >= 1) {
-            rotate_node->parent->right = rotate_node;
+    if (tree->nil != rbk_get_node_parent(rotate_node)) {
+        if (tree->cmp(rotate_node->data, rbk_get_node_parent(rotate_node)->data) >= 1) {
+            rbk_get_node_parent(rotate_node)->right = rotate_node;
         } else {
-            rotate_node->parent->left = rotate_node;
+            rbk_get_node_parent(rotate_node)->left = rotate_node;
         }
     } else {
         tree->root = rotate_node;
     }
+
+    /* Update the weight of rotated red-black tree node objects */
+    rbk_update_node_weight(tree, fix_node);
+    rbk_update_node_weight(tree, rotate_node);
 }
 
 /**
@@ -343,37 +956,37 @@ static scl_error_t rbk_insert_fix_node_up(rbk_tree_t * const __restrict__ tree,
     rbk_tree_node_t *parent_fix_node = tree->nil;
 
     /* Fix up the red black tree */
-    while ((tree->root != fix_node) && (BLACK != fix_node->color) && (BLACK != fix_node->parent->color)) {
+    while ((tree->root != fix_node) && (BLACK != rbk_get_node_color(fix_node)) && (BLACK != rbk_get_node_color(rbk_get_node_parent(fix_node)))) {
 
         /* Selected node is not root so check brother color */
         
         /* Set initial data */
-        parent_fix_node = fix_node->parent;
+        parent_fix_node = rbk_get_node_parent(fix_node);
         rbk_tree_node_t *brother_node = tree->nil;
 
         /* Find brother node */
-        if (parent_fix_node->parent->left == parent_fix_node) {
-            brother_node = parent_fix_node->parent->right;
+        if (rbk_get_node_parent(parent_fix_node)->left == parent_fix_node) {
+            brother_node = rbk_get_node_parent(parent_fix_node)->right;
         } else {
-            brother_node = parent_fix_node->parent->left;
+            brother_node = rbk_get_node_parent(parent_fix_node)->left;
         }
 
         /* Fix tree according to brother's color */
-        if (BLACK == brother_node->color) {
+        if (BLACK == rbk_get_node_color(brother_node)) {
 
             /* Brother's color is black check what rotations we should make */
             
             if (parent_fix_node->left == fix_node) {
-                if (parent_fix_node->parent->left == parent_fix_node) {
+                if (rbk_get_node_parent(parent_fix_node)->left == parent_fix_node) {
 
                     /* Left-Left rotation case*/
 
                     /* Recolouring nodes */
-                    parent_fix_node->color = BLACK;
-                    parent_fix_node->parent->color = RED;
+                    rbk_set_node_color(parent_fix_node, BLACK);
+                    rbk_set_node_color(rbk_get_node_parent(parent_fix_node), RED);
                     
                     /* Rotation */
-                    rbk_rotate_right(tree, parent_fix_node->parent);
+                    rbk_rotate_right(tree, rbk_get_node_parent(parent_fix_node));
 
                     /* Repoint selected node*/
                     fix_node = parent_fix_node;
@@ -382,49 +995,49 @@ static scl_error_t rbk_insert_fix_node_up(rbk_tree_t * const __restrict__ tree,
                     /* Right-Left Rotation */
 
                     /* Recolouring nodes */
-                    fix_node->color = BLACK;
-                    parent_fix_node->parent->color = RED;
+                    rbk_set_node_color(fix_node, BLACK);
+                    rbk_set_node_color(rbk_get_node_parent(parent_fix_node), RED);
 
                     /* Rotation */
                     rbk_rotate_right(tree, parent_fix_node);
-                    rbk_rotate_left(tree, fix_node->parent);
+                    rbk_rotate_left(tree, rbk_get_node_parent(fix_node));
                 }
             } else {
-                if (parent_fix_node->parent->left == parent_fix_node) {
+                if (rbk_get_node_parent(parent_fix_node)->left == parent_fix_node) {
 
                     /* Left-Right Rotation */
 
                     /* Recolouring nodes */
-                    fix_node->color = BLACK;
-                    parent_fix_node->parent->color = RED;
+                    rbk_set_node_color(fix_node, BLACK);
+                    rbk_set_node_color(rbk_get_node_parent(parent_fix_node), RED);
                     
                     /* Rotation */
                     rbk_rotate_left(tree, parent_fix_node);
-                    rbk_rotate_right(tree, fix_node->parent);
+                    rbk_rotate_right(tree, rbk_get_node_parent(fix_node));
                 } else {
 
                     /* Right-Right Rotation */
 
                     /* Recolouring nodes */
-                    parent_fix_node->color = BLACK;
-                    parent_fix_node->parent->color = RED;
+                    rbk_set_node_color(parent_fix_node, BLACK);
+                    rbk_set_node_color(rbk_get_node_parent(parent_fix_node), RED);
                     
                     /* Rotation */
-                    rbk_rotate_left(tree, parent_fix_node->parent);
+                    rbk_rotate_left(tree, rbk_get_node_parent(parent_fix_node));
 
                     /* Repoint selected node */
                     fix_node = parent_fix_node;
                 }
             }
-        } else if (RED == brother_node->color) {
+        } else if (RED == rbk_get_node_color(brother_node)) {
 
             /* Brother's color is red so recolor the nodes */
-            parent_fix_node->parent->color = RED;
-            brother_node->color = BLACK;
-            parent_fix_node->color = BLACK;
+            rbk_set_node_color(rbk_get_node_parent(parent_fix_node), RED);
+            rbk_set_node_color(brother_node, BLACK);
+            rbk_set_node_color(parent_fix_node, BLACK);
 
             /* Repoint selected node */
-            fix_node = parent_fix_node->parent;
+            fix_node = rbk_get_node_parent(parent_fix_node);
         } else {
 
             /* Color is not RED or BLACK something went wrong */
@@ -433,7 +1046,7 @@ static scl_error_t rbk_insert_fix_node_up(rbk_tree_t * const __restrict__ tree,
     }
 
     /* Make sure root is black */
-    tree->root->color = BLACK;
+    rbk_set_node_color(tree->root, BLACK);
 
     return SCL_OK;
 }
@@ -477,7 +1090,11 @@ scl_error_t rbk_insert(rbk_tree_t * const __restrict__ tree, const void * __rest
              * Node already exists in current red-black tree
              * increment count value of node
              */
-            ++(iterator->count);
+            rbk_set_node_count(iterator, rbk_get_node_count(iterator) + 1);
+
+            /* The weights of all the ancestors grow with the count */
+            rbk_update_weights_up(tree, iterator);
+
             return 0;
         }
     }
@@ -495,7 +1112,7 @@ scl_error_t rbk_insert(rbk_tree_t * const __restrict__ tree, const void * __rest
     if (tree->nil != parent_iterator) {
 
         /* Update parent links */
-        new_node->parent = parent_iterator;
+        rbk_set_node_parent(new_node, parent_iterator);
 
         /* Update children links */
         if (tree->cmp(parent_iterator->data, new_node->data) >= 1) {
@@ -504,13 +1121,16 @@ scl_error_t rbk_insert(rbk_tree_t * const __restrict__ tree, const void * __rest
             parent_iterator->right = new_node;
         }
 
+        /* Count the new node in the weights of its ancestors */
+        rbk_update_weights_up(tree, parent_iterator);
+
         /* Fix the red black tree*/
         err = rbk_insert_fix_node_up(tree, new_node);
     } else {
 
         /* Created node is root node */
         tree->root = new_node;
-        new_node->color = BLACK;
+        rbk_set_node_color(new_node, BLACK);
     }
 
     /* Increase red-black tree size */
@@ -574,6 +1194,95 @@ const void* rbk_find_data(const rbk_tree_t * const __restrict__ tree, const void
     return rbk_find_node(tree, data)->data;
 }
 
+/**
+ * @brief Function to search many data values at once. The values are
+ * processed in groups of 16 and the searches of one group go down
+ * the tree in lockstep, one level at a time. Before a level is compared
+ * the data of all the current nodes is prefetched and after a step the
+ * next nodes are prefetched, so the cache misses of independent searches
+ * overlap instead of being paid one after another.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an array of values stored one after another (data_size bytes each)
+ * @param number_of_data number of values from the array
+ * @param found_data pointer to an array of number_of_data pointers, found_data[i] is set to
+ * the data of the node equal to the i-th value or to `NULL` if it is not in the tree
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_find_batch(const rbk_tree_t * const __restrict__ tree, const void * const data, size_t number_of_data, const void ** const found_data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (NULL == found_data) {
+        return SCL_INVALID_INPUT;
+    }
+
+    const uint8_t * const typed_data = data;
+    const rbk_tree_node_t *nodes[DEFAULT_RBK_BATCH_SIZE];
+    size_t lanes[DEFAULT_RBK_BATCH_SIZE];
+
+    for (size_t batch_start = 0; batch_start < number_of_data; batch_start += DEFAULT_RBK_BATCH_SIZE) {
+        size_t batch_size = number_of_data - batch_start;
+
+        if (DEFAULT_RBK_BATCH_SIZE < batch_size) {
+            batch_size = DEFAULT_RBK_BATCH_SIZE;
+        }
+
+        /* Every search of the group starts from the root */
+        for (size_t iter = 0; iter < batch_size; ++iter) {
+            nodes[iter] = tree->root;
+            lanes[iter] = iter;
+            found_data[batch_start + iter] = NULL;
+        }
+
+        size_t active_lanes = batch_size;
+
+        /* Go down one level in all the unfinished searches */
+        while (0 != active_lanes) {
+
+            /* Prefetch the data of the current nodes */
+            for (size_t iter = 0; iter < active_lanes; ++iter) {
+                RBK_PREFETCH(nodes[lanes[iter]]->data);
+            }
+
+            for (size_t iter = 0; iter < active_lanes;) {
+                const size_t lane = lanes[iter];
+                const rbk_tree_node_t * const iterator = nodes[lane];
+
+                /* Search ended on `nil`, the value is not in the tree */
+                if (tree->nil == iterator) {
+                    lanes[iter] = lanes[--active_lanes];
+                    continue;
+                }
+
+                const int32_t compare_result = tree->cmp(iterator->data, typed_data + (batch_start + lane) * tree->data_size);
+
+                if (0 == compare_result) {
+
+                    /* Value found, the lane is finished */
+                    found_data[batch_start + lane] = iterator->data;
+                    lanes[iter] = lanes[--active_lanes];
+                    continue;
+                }
+
+                nodes[lane] = (compare_result >= 1) ? iterator->left : iterator->right;
+                RBK_PREFETCH(nodes[lane]);
+
+                ++iter;
+            }
+        }
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
 /**
  * @brief Function to swap two nodes from a red black tree.
  * This function is a subroutine of the delete function to 
@@ -590,9 +1299,9 @@ static scl_error_t rbk_swap_nodes(rbk_tree_t * const __restrict__ tree, rbk_tree
     }
 
     /* Change color of nodes */
-    rbk_tree_node_color_t temp_color = dest_node->color;
-    dest_node->color = src_node->color;
-    src_node->color = temp_color;
+    rbk_tree_node_color_t temp_color = rbk_get_node_color(dest_node);
+    rbk_set_node_color(dest_node, rbk_get_node_color(src_node));
+    rbk_set_node_color(src_node, temp_color);
 
     /* Interchange the right child */
 
@@ -601,13 +1310,13 @@ static scl_error_t rbk_swap_nodes(rbk_tree_t * const __restrict__ tree, rbk_tree
     dest_node->right = src_node->right;
 
     if (tree->nil != dest_node->right) {
-        dest_node->right->parent = dest_node;
+        rbk_set_node_parent(dest_node->right, dest_node);
     }
 
     src_node->right = temp;
 
     if (tree->nil != src_node->right) {
-        src_node->right->parent = src_node;
+        rbk_set_node_parent(src_node->right, src_node);
     }
 
     /* Interchange the left child */
@@ -617,38 +1326,38 @@ static scl_error_t rbk_swap_nodes(rbk_tree_t * const __restrict__ tree, rbk_tree
     dest_node->left = src_node->left;
 
     if (tree->nil != dest_node->left) {
-        dest_node->left->parent = dest_node;
+        rbk_set_node_parent(dest_node->left, dest_node);
     }
 
     src_node->left = temp;
 
     if (tree->nil != src_node->left) {
-        src_node->left->parent = src_node;
+        rbk_set_node_parent(src_node->left, src_node);
     }
 
     /* Interchange parents of the two nodes */
 
-    temp = dest_node->parent;
+    temp = rbk_get_node_parent(dest_node);
 
-    dest_node->parent = src_node->parent;
+    rbk_set_node_parent(dest_node, rbk_get_node_parent(src_node));
 
-    if (tree->nil != dest_node->parent) {
-        if (dest_node->parent->left == src_node) {
-            dest_node->parent->left = dest_node;
+    if (tree->nil != rbk_get_node_parent(dest_node)) {
+        if (rbk_get_node_parent(dest_node)->left == src_node) {
+            rbk_get_node_parent(dest_node)->left = dest_node;
         } else {
-            dest_node->parent->right = dest_node;
+            rbk_get_node_parent(dest_node)->right = dest_node;
         }
     } else {
         tree->root = dest_node;
     }
 
-    src_node->parent = temp;
+    rbk_set_node_parent(src_node, temp);
 
-    if (tree->nil != src_node->parent) {
-        if (src_node->parent->left == dest_node) {
-            src_node->parent->left = src_node;
+    if (tree->nil != rbk_get_node_parent(src_node)) {
+        if (rbk_get_node_parent(src_node)->left == dest_node) {
+            rbk_get_node_parent(src_node)->left = src_node;
         } else {
-            src_node->parent->right = src_node;
+            rbk_get_node_parent(src_node)->right = src_node;
         }
     } else {
         tree->root = src_node;
@@ -678,7 +1387,7 @@ static int32_t rbk_node_level(const rbk_tree_t * const __restrict__ tree, const
 
     /* Compute level of input node */
     while (tree->nil != base_node) {
-        base_node = base_node->parent;
+        base_node = rbk_get_node_parent(base_node);
         ++level_count;
     }
 
@@ -826,6 +1535,95 @@ const void* rbk_min_data(const rbk_tree_t * const __restrict__ tree, const void
     return rbk_min_node(tree, rbk_find_node(tree, subroot_data))->data;
 }
 
+/**
+ * @brief Function to get the data with the specified index from
+ * the sorted order of the red-black tree, in O(log N). Repeated data
+ * is counted as many times as it was inserted, so every index from
+ * [count_before, count_before + count) selects the same data.
+ * Function may fail if the tree does not keep order statistics
+ * (see rbk_set_order_statistics) or if index is not less than
+ * the number of inserted elements.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param index position of the data in sorted order (0 for minimum)
+ * @return const void* pointer to the selected data or `NULL`
+ */
+const void* rbk_select_data(const rbk_tree_t * const __restrict__ tree, size_t index) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (0 == tree->order_statistics) || (index >= rbk_get_node_weight(tree->root))) {
+        return NULL;
+    }
+
+    const rbk_tree_node_t *iterator = tree->root;
+
+    /* Go down on the side of the index */
+    while (tree->nil != iterator) {
+        if (index < rbk_get_node_weight(iterator->left)) {
+            iterator = iterator->left;
+        } else if (index - rbk_get_node_weight(iterator->left) < rbk_get_node_count(iterator)) {
+            return iterator->data;
+        } else {
+            index -= rbk_get_node_weight(iterator->left) + rbk_get_node_count(iterator);
+            iterator = iterator->right;
+        }
+    }
+
+    /* Weights are broken */
+    return NULL;
+}
+
+/**
+ * @brief Helper function to count the elements of the red-black tree
+ * that are less than data (or less or equal if include_equal is 1)
+ * using the weights of the nodes.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @param include_equal 1 to count the elements equal to data too
+ * @return size_t number of elements before data
+ */
+static size_t rbk_rank_helper(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data, uint8_t include_equal) {
+    const rbk_tree_node_t *iterator = tree->root;
+    size_t rank = 0;
+
+    /* Add the left side of every node smaller than data */
+    while (tree->nil != iterator) {
+        int32_t compare_result = tree->cmp(iterator->data, data);
+
+        if (compare_result >= 1) {
+            iterator = iterator->left;
+        } else if (compare_result <= -1) {
+            rank += rbk_get_node_weight(iterator->left) + rbk_get_node_count(iterator);
+            iterator = iterator->right;
+        } else {
+            return rank + rbk_get_node_weight(iterator->left) + ((0 != include_equal) ? rbk_get_node_count(iterator) : 0);
+        }
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Function to count the elements of the red-black tree that
+ * are less than data, in O(log N). Repeated data is counted as
+ * many times as it was inserted and data does not have to be in
+ * the tree. Function may fail if the tree does not keep order
+ * statistics (see rbk_set_order_statistics).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return size_t number of elements less than data or `SIZE_MAX`
+ * if function failed
+ */
+size_t rbk_rank(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (0 == tree->order_statistics) || (NULL == data)) {
+        return SIZE_MAX;
+    }
+
+    return rbk_rank_helper(tree, data, 0);
+}
+
 /**
  * @brief Helper function to fix up the balance of a rbk_tree_t
  * after deletion of one node. Function may fail if current
@@ -850,7 +1648,7 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
     rbk_tree_node_t *brother_node = tree->nil;
 
     /* Fix the red-black tree */
-    while ((tree->root != fix_node) && (BLACK == fix_node->color)) {
+    while ((tree->root != fix_node) && (BLACK == rbk_get_node_color(fix_node))) {
         if (parent_fix_node->left == fix_node) {
 
             /* Double black node is a left child */
@@ -858,13 +1656,13 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
             /* Find the brother node */
             brother_node = parent_fix_node->right;
 
-            if (RED == brother_node->color) {
+            if (RED == rbk_get_node_color(brother_node)) {
 
                 /* Case 1: brother is a red node */
 
                 /* Recolor the nodes */
-                brother_node->color = BLACK;
-                parent_fix_node->color = RED;
+                rbk_set_node_color(brother_node, BLACK);
+                rbk_set_node_color(parent_fix_node, RED);
 
                 /* Rotate the parent to the left */
                 rbk_rotate_left(tree, parent_fix_node);
@@ -873,23 +1671,24 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
                 brother_node = parent_fix_node->right;
             }
 
-            if ((BLACK == brother_node->left->color) && (BLACK == brother_node->right->color)) {
+            if ((BLACK == rbk_get_node_color(brother_node->left)) && (BLACK == rbk_get_node_color(brother_node->right))) {
 
                 /* Case 2: brother is a black node and its children are black */
 
                 /* Recolor the brother node */
-                brother_node->color = RED;
+                rbk_set_node_color(brother_node, RED);
 
                 /* Propagate the double black problem in higher hierarchy */
                 fix_node = parent_fix_node;
+                parent_fix_node = rbk_get_node_parent(fix_node);
             } else {
-                if (BLACK == brother_node->right->color) {
+                if (BLACK == rbk_get_node_color(brother_node->right)) {
 
                     /* Case 3: brother node is black, left child is red and right is black */
 
                     /* Recolor nodes */
-                    brother_node->left->color = BLACK;
-                    brother_node->color = RED;
+                    rbk_set_node_color(brother_node->left, BLACK);
+                    rbk_set_node_color(brother_node, RED);
 
                     /* Rotate brother to the right */
                     rbk_rotate_right(tree, brother_node);
@@ -901,9 +1700,9 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
                 /* Case 4: brother node is black and right child is red */
 
                 /* Recolor the nodes */
-                brother_node->color = parent_fix_node->color;
-                parent_fix_node->color = BLACK;
-                brother_node->right->color = BLACK;
+                rbk_set_node_color(brother_node, rbk_get_node_color(parent_fix_node));
+                rbk_set_node_color(parent_fix_node, BLACK);
+                rbk_set_node_color(brother_node->right, BLACK);
 
                 /* Rotate parent node to left */
                 rbk_rotate_left(tree, parent_fix_node);
@@ -918,13 +1717,13 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
             /* Find the brother node */
             brother_node = parent_fix_node->left;
 
-            if (RED == brother_node->color) {
+            if (RED == rbk_get_node_color(brother_node)) {
 
                 /* Case 1: brother is a red node */
 
                 /* Recolor the nodes */
-                brother_node->color = BLACK;
-                parent_fix_node->color = RED;
+                rbk_set_node_color(brother_node, BLACK);
+                rbk_set_node_color(parent_fix_node, RED);
 
                 /* Rotate the parent to the right */
                 rbk_rotate_right(tree, parent_fix_node);
@@ -933,23 +1732,24 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
                 brother_node = parent_fix_node->left;
             }
 
-            if ((BLACK == brother_node->right->color) && (BLACK == brother_node->left->color)) {
+            if ((BLACK == rbk_get_node_color(brother_node->right)) && (BLACK == rbk_get_node_color(brother_node->left))) {
 
                 /* Case 2: brother is a black node and its children are black */
 
                 /* Recolor the brother node */
-                brother_node->color = RED;
+                rbk_set_node_color(brother_node, RED);
 
                 /* Propagate the double black problem in higher hierarchy */
                 fix_node = parent_fix_node;
+                parent_fix_node = rbk_get_node_parent(fix_node);
             } else {
-                if (BLACK == brother_node->left->color) {
+                if (BLACK == rbk_get_node_color(brother_node->left)) {
 
                     /* Case 3: brother node is black, right child is red and left is black */
 
                     /* Recolor nodes */
-                    brother_node->right->color = BLACK;
-                    brother_node->color = RED;
+                    rbk_set_node_color(brother_node->right, BLACK);
+                    rbk_set_node_color(brother_node, RED);
 
                     /* Rotate brother to the left */
                     rbk_rotate_left(tree, brother_node);
@@ -961,9 +1761,9 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
                 /* Case 4: brother node is black and right child is red */
 
                 /* Recolor the nodes */
-                brother_node->color = parent_fix_node->color;
-                parent_fix_node->color = BLACK;
-                brother_node->left->color = BLACK;
+                rbk_set_node_color(brother_node, rbk_get_node_color(parent_fix_node));
+                rbk_set_node_color(parent_fix_node, BLACK);
+                rbk_set_node_color(brother_node->left, BLACK);
 
                 /* Rotate parent node to right */
                 rbk_rotate_right(tree, parent_fix_node);
@@ -975,43 +1775,22 @@ static scl_error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree,
     }
 
     /* Recolor the root as BLACK */
-    fix_node->color = BLACK;
+    rbk_set_node_color(fix_node, BLACK);
 
     return SCL_OK;
 }
 
 /**
- * @brief Function to delete one generic data from a red-black.
- * Function may fail if input data is not valid or if
- * changing the data fails. You can delete one data at a time
- * and MUST specify a valid red-black tree and a valid data pointer
+ * @brief Function to delete one node from a red-black tree. The node
+ * is unlinked (swapped with its inorder successor if it has two
+ * children), its data is freed and the tree is fixed if needed.
+ * The other nodes keep their data, so pointers to them stay valid.
  * 
  * @param tree an allocated red-black tree object
- * @param data pointer to an address of a generic data to be deleted
+ * @param delete_node red-black tree node object to delete
  * @return scl_error_t enum object for handling errors
  */
-scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
-    /* Check if input data is valid */
-    if (NULL == tree) {
-        return SCL_NULL_RBK;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
-    }
-
-    if (NULL == data) {
-        return SCL_INVALID_DATA;
-    }
-
-    /* Find node to delete */
-    rbk_tree_node_t *delete_node = rbk_find_node(tree, data);
-
-    /* Delete node is not in the current working tree */
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static scl_error_t rbk_delete_node(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t *delete_node) {
     /* Node has two children swap with it's inorder successor and delete successor */
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
 
@@ -1037,22 +1816,22 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
         delete_node_child = delete_node->left;
 
         /* Check if deletion will not make a double black exception */
-        if ((RED == delete_node_child->color) && (BLACK == delete_node->color)) {
+        if ((RED == rbk_get_node_color(delete_node_child)) && (BLACK == rbk_get_node_color(delete_node))) {
             need_fixing_tree = 0;
 
             /* Recolor red node into a red one */
-            delete_node_child->color = BLACK;
+            rbk_set_node_color(delete_node_child, BLACK);
         }
 
         /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+        rbk_set_node_parent(delete_node_child, rbk_get_node_parent(delete_node));
 
         /* Update grandparent with it's grandchild */
-        if (tree->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
+        if (tree->nil != rbk_get_node_parent(delete_node)) {
+            if (rbk_get_node_parent(delete_node)->right == delete_node) {
+                rbk_get_node_parent(delete_node)->right = delete_node_child;
             } else {
-                delete_node->parent->left = delete_node_child;
+                rbk_get_node_parent(delete_node)->left = delete_node_child;
             }
         } else {
 
@@ -1066,22 +1845,22 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
         delete_node_child = delete_node->right;
 
         /* Check if deletion will not make a double black exception */
-        if ((RED == delete_node_child->color) && (BLACK == delete_node->color)) {
+        if ((RED == rbk_get_node_color(delete_node_child)) && (BLACK == rbk_get_node_color(delete_node))) {
             need_fixing_tree = 0;
 
             /* Recolor red node into a red one */
-            delete_node_child->color = BLACK;
+            rbk_set_node_color(delete_node_child, BLACK);
         }
 
         /* Update child with it's grandparent */
-        delete_node_child->parent = delete_node->parent;
+        rbk_set_node_parent(delete_node_child, rbk_get_node_parent(delete_node));
 
         /* Update grandparent with it's grandchild */
-        if (tree->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = delete_node_child;
+        if (tree->nil != rbk_get_node_parent(delete_node)) {
+            if (rbk_get_node_parent(delete_node)->right == delete_node) {
+                rbk_get_node_parent(delete_node)->right = delete_node_child;
             } else {
-                delete_node->parent->left = delete_node_child;
+                rbk_get_node_parent(delete_node)->left = delete_node_child;
             }
         } else {
 
@@ -1094,16 +1873,16 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
     } else {
 
         /* Check if deletion will not make a double black exception */ 
-        if (RED == delete_node->color) {
+        if (RED == rbk_get_node_color(delete_node)) {
             need_fixing_tree = 0;
         }
 
         // Update parent's links to nil node
-        if (tree->nil != delete_node->parent) {
-            if (delete_node->parent->right == delete_node) {
-                delete_node->parent->right = tree->nil;
+        if (tree->nil != rbk_get_node_parent(delete_node)) {
+            if (rbk_get_node_parent(delete_node)->right == delete_node) {
+                rbk_get_node_parent(delete_node)->right = tree->nil;
             } else {
-                delete_node->parent->left = tree->nil;
+                rbk_get_node_parent(delete_node)->left = tree->nil;
             }
         } else {
 
@@ -1115,15 +1894,15 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
         }
     }
 
-    rbk_tree_node_t *parent_delete_node = delete_node->parent;
+    rbk_tree_node_t *parent_delete_node = rbk_get_node_parent(delete_node);
 
     /* Free content of the data pointer */
     if ((NULL != tree->frd) && (NULL != delete_node->data)) {
         tree->frd(delete_node->data);
     }
 
-    /* Free data pointer of selected node */
-    if (NULL != delete_node->data) {
+    /* Free data pointer of selected node, pooled data is released with its node */
+    if ((NULL == tree->pool) && (NULL != delete_node->data)) {
         free(delete_node->data);
     }
 
@@ -1132,7 +1911,11 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
 
     /* Free selected red-black node pointer */
     if (tree->nil != delete_node) {
-        free(delete_node);
+        if (NULL != tree->pool) {
+            pool_free(tree->pool, delete_node);
+        } else {
+            free(delete_node);
+        }
     }
 
     /* Set selected red-black node as `NULL` */
@@ -1141,6 +1924,9 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
     /* Deacrease tree size  */
     --(tree->size);
 
+    /* Remove the node from the weights of its ancestors */
+    rbk_update_weights_up(tree, parent_delete_node);
+
     /* Check if fixing is needed */
     if ((0 != need_fixing_tree) && (tree->nil != parent_delete_node)) {
         return rbk_delete_fix_node_up(tree, delete_node_child, parent_delete_node);
@@ -1150,6 +1936,70 @@ scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const
     return SCL_OK;
 }
 
+/**
+ * @brief Function to delete one generic data from a red-black.
+ * Function may fail if input data is not valid or if
+ * changing the data fails. You can delete one data at a time
+ * and MUST specify a valid red-black tree and a valid data pointer
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an address of a generic data to be deleted
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_delete(rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    /* Find node to delete */
+    rbk_tree_node_t *delete_node = rbk_find_node(tree, data);
+
+    /* Delete node is not in the current working tree */
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    return rbk_delete_node(tree, delete_node);
+}
+
+/**
+ * @brief Function to get the inorder predecessor of a node
+ * walking just the links of the nodes, without comparing data.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param iterator red-black tree node object (not `nil`)
+ * @return rbk_tree_node_t* `nil` or inorder predecessor of the node
+ */
+static rbk_tree_node_t* rbk_prev_node(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * __restrict__ iterator) {
+    /*
+     * If node has a left child than
+     * find predecessor in left subtree
+     */
+    if (tree->nil != iterator->left) {
+        return rbk_max_node(tree, iterator->left);
+    }
+
+    /* Set parent iterator */
+    rbk_tree_node_t *parent_iterator = rbk_get_node_parent(iterator);
+
+    /* Find predecessor node */
+    while ((tree->nil != parent_iterator) && (parent_iterator->left == iterator)) {
+        iterator = parent_iterator;
+        parent_iterator = rbk_get_node_parent(parent_iterator);
+    }
+
+    return parent_iterator;
+}
+
 /**
  * @brief Function to search the inorder predecessor for
  * a specified data type value. Function may fail if
@@ -1176,24 +2026,36 @@ static rbk_tree_node_t* rbk_predecessor_node(const rbk_tree_t * const __restrict
         return tree->nil;
     }
 
+    /* Return predecessor node of the data value node */
+    return rbk_prev_node(tree, iterator);
+}
+
+/**
+ * @brief Function to get the inorder successor of a node
+ * walking just the links of the nodes, without comparing data.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param iterator red-black tree node object (not `nil`)
+ * @return rbk_tree_node_t* `nil` or inorder successor of the node
+ */
+static rbk_tree_node_t* rbk_next_node(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * __restrict__ iterator) {
     /*
-     * If node has a left child than
-     * find predecessor in left subtree
+     * If node has a right child than
+     * find successor in right subtree
      */
-    if (tree->nil != iterator->left) {
-        return rbk_max_node(tree, iterator->left);
+    if (tree->nil != iterator->right) {
+        return rbk_min_node(tree, iterator->right);
     }
 
     /* Set parent iterator */
-    rbk_tree_node_t *parent_iterator = iterator->parent;
+    rbk_tree_node_t *parent_iterator = rbk_get_node_parent(iterator);
 
-    /* Find predecessor node */
-    while ((tree->nil != parent_iterator) && (parent_iterator->left == iterator)) {
+    /* Find successor node */
+    while ((tree->nil != parent_iterator) && (parent_iterator->right == iterator)) {
         iterator = parent_iterator;
-        parent_iterator = parent_iterator->parent;
+        parent_iterator = rbk_get_node_parent(parent_iterator);
     }
 
-    /* Return predecessor node of the data value node */
     return parent_iterator;
 }
 
@@ -1223,25 +2085,8 @@ static rbk_tree_node_t* rbk_successor_node(const rbk_tree_t * const __restrict__
         return tree->nil;
     }
 
-    /*
-     * If node has a right child than
-     * find successor in right subtree
-     */
-    if (tree->nil != iterator->right) {
-        return rbk_min_node(tree, iterator->right);
-    }
-
-    /* Set parent iterator */
-    rbk_tree_node_t *parent_iterator = iterator->parent;
-
-    /* Find successor node */
-    while ((tree->nil != parent_iterator) && (parent_iterator->right == iterator)) {
-        iterator = parent_iterator;
-        parent_iterator = parent_iterator->parent;
-    }
-
     /* Return successor node of the data value node */
-    return parent_iterator;
+    return rbk_next_node(tree, iterator);
 }
 
 /**
@@ -1357,10 +2202,302 @@ const void* rbk_lowest_common_ancestor_data(const rbk_tree_t * const __restrict_
     return rbk_lowest_common_ancestor_node(tree, data1, data2)->data;
 }
 
+/**
+ * @brief Function to find the first node with data greater
+ * or equal to a specified data, in O(log N).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param data pointer to an address of a generic data type
+ * @return rbk_tree_node_t* `nil` or the first node not less than data
+ */
+static rbk_tree_node_t* rbk_lower_bound_node(const rbk_tree_t * const __restrict__ tree, const void * const __restrict__ data) {
+    rbk_tree_node_t *iterator = tree->root;
+    rbk_tree_node_t *lower_bound = tree->nil;
+
+    /* Remember the last node not less than data */
+    while (tree->nil != iterator) {
+        if (tree->cmp(iterator->data, data) >= 0) {
+            lower_bound = iterator;
+            iterator = iterator->left;
+        } else {
+            iterator = iterator->right;
+        }
+    }
+
+    return lower_bound;
+}
+
+/**
+ * @brief Function to traverse in sorted order just the nodes with
+ * data from the range [lo, hi] and to perform an action on them.
+ * The first node is searched once and then the function follows
+ * the links of the nodes, so it runs in O(log N + K) where K is
+ * the number of nodes from the range. The action MUST NOT change
+ * the order of the data.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @param action a pointer to a function that will perform an action
+ * on every red-black node object from the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_range_traverse(const rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi, action_func action) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    if (NULL == action) {
+        return SCL_NULL_ACTION_FUNC;
+    }
+
+    /* Walk from the first node of the range until the data is greater than hi */
+    for (rbk_tree_node_t *iterator = rbk_lower_bound_node(tree, lo);
+        (tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0);
+        iterator = rbk_next_node(tree, iterator)) {
+
+        action(iterator->data);
+    }
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to count the elements of the red-black tree with
+ * data from the range [lo, hi] in O(log N + K). Repeated data is
+ * counted as many times as it was inserted. If the tree keeps
+ * order statistics the weights of the nodes are used and the
+ * function runs in O(log N).
+ * 
+ * @param tree an allocated red-black tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @return size_t number of elements from the range or `SIZE_MAX`
+ * if function failed
+ */
+size_t rbk_range_count(const rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi) {
+    /* Check if input data is valid */
+    if ((NULL == tree) || (NULL == lo) || (NULL == hi)) {
+        return SIZE_MAX;
+    }
+
+    /* Empty range */
+    if (tree->cmp(lo, hi) >= 1) {
+        return 0;
+    }
+
+    /* Count the elements using the weights */
+    if (0 != tree->order_statistics) {
+        return rbk_rank_helper(tree, hi, 1) - rbk_rank_helper(tree, lo, 0);
+    }
+
+    size_t count = 0;
+
+    /* Walk from the first node of the range until the data is greater than hi */
+    for (rbk_tree_node_t *iterator = rbk_lower_bound_node(tree, lo);
+        (tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0);
+        iterator = rbk_next_node(tree, iterator)) {
+
+        count += rbk_get_node_count(iterator);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Function to delete all the nodes with data from the
+ * range [lo, hi]. The first node is searched once, the next node
+ * is taken before deleting the current one and every deletion
+ * just fixes the tree, so no node is searched again.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param lo pointer to the lowest data of the range
+ * @param hi pointer to the highest data of the range
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_range_delete(rbk_tree_t * const __restrict__ tree, const void * const lo, const void * const hi) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if ((NULL == lo) || (NULL == hi)) {
+        return SCL_INVALID_DATA;
+    }
+
+    rbk_tree_node_t *iterator = rbk_lower_bound_node(tree, lo);
+
+    /* Delete the nodes one by one until the data is greater than hi */
+    while ((tree->nil != iterator) && (tree->cmp(iterator->data, hi) <= 0)) {
+        rbk_tree_node_t *next_iterator = rbk_next_node(tree, iterator);
+
+        scl_error_t err = rbk_delete_node(tree, iterator);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        iterator = next_iterator;
+    }
+
+    /* All good */
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the smallest element of
+ * the red-black tree. The cursor is past the end if the tree is empty.
+ * A cursor stays valid while other elements are inserted or
+ * deleted, deleting the element under the cursor invalidates it.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_cursor_first(const rbk_tree_t * const __restrict__ tree, rbk_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    cursor->tree = tree;
+    cursor->node = (tree->nil != tree->root) ? rbk_min_node(tree, tree->root) : tree->nil;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the greatest element of
+ * the red-black tree. The cursor is past the end if the tree is empty.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_cursor_last(const rbk_tree_t * const __restrict__ tree, rbk_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    cursor->tree = tree;
+    cursor->node = (tree->nil != tree->root) ? rbk_max_node(tree, tree->root) : tree->nil;
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to place a cursor on the first element greater
+ * or equal to a specified data, in O(log N). The cursor is past
+ * the end if every element is less than data.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param cursor pointer to a cursor object to initialize
+ * @param data pointer to an address of a generic data type
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t rbk_cursor_seek(const rbk_tree_t * const __restrict__ tree, rbk_cursor_t * const __restrict__ cursor, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == cursor) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == data) {
+        return SCL_INVALID_DATA;
+    }
+
+    cursor->tree = tree;
+    cursor->node = rbk_lower_bound_node(tree, data);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to get the element under a cursor.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the current data or `NULL`
+ * if the cursor is past the end
+ */
+const void* rbk_cursor_data(const rbk_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    /* Data of `nil` is `NULL` */
+    return cursor->node->data;
+}
+
+/**
+ * @brief Function to move a cursor to the next element in sorted
+ * order, following the links of the nodes in amortized O(1). A
+ * cursor past the end moves to the smallest element.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the next data or `NULL` if the
+ * cursor moved past the end
+ */
+const void* rbk_cursor_next(rbk_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    if (cursor->tree->nil != cursor->node) {
+        cursor->node = rbk_next_node(cursor->tree, cursor->node);
+    } else if (cursor->tree->nil != cursor->tree->root) {
+        cursor->node = rbk_min_node(cursor->tree, cursor->tree->root);
+    }
+
+    return cursor->node->data;
+}
+
+/**
+ * @brief Function to move a cursor to the previous element in sorted
+ * order, following the links of the nodes in amortized O(1). A
+ * cursor past the end moves to the greatest element.
+ * 
+ * @param cursor pointer to a cursor object placed by first, last or seek
+ * @return const void* pointer to the previous data or `NULL` if the
+ * cursor moved past the beginning
+ */
+const void* rbk_cursor_prev(rbk_cursor_t * const __restrict__ cursor) {
+    /* Check if input data is valid */
+    if ((NULL == cursor) || (NULL == cursor->tree)) {
+        return NULL;
+    }
+
+    if (cursor->tree->nil != cursor->node) {
+        cursor->node = rbk_prev_node(cursor->tree, cursor->node);
+    } else if (cursor->tree->nil != cursor->tree->root) {
+        cursor->node = rbk_max_node(cursor->tree, cursor->tree->root);
+    }
+
+    return cursor->node->data;
+}
+
 /**
  * @brief Helper function for rbk_traverse_inorder function.
- * This method will recursively iterate through all nodes by
- * Left-Root-Right principle.
+ * This method will iterate through all nodes without recursion by
+ * Left-Root-Right principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated red-black tree object
  * @param root starting point of the red-black tree traversal
@@ -1372,14 +2509,40 @@ static void rbk_traverse_inorder_helper(const rbk_tree_t * const __restrict__ tr
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    rbk_traverse_inorder_helper(tree, root->left, action);
-    
-    /* Call action function */
-    action(root->data);
+    /* Start from the minimum node of the sub-tree */
+    const rbk_tree_node_t *iterator = root;
+
+    while (tree->nil != iterator->left) {
+        iterator = iterator->left;
+    }
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->right) {
+
+            /* Next node is the minimum of the right sub-tree */
+            iterator = iterator->right;
 
-    /* Traverse in the right sub-tree */
-    rbk_traverse_inorder_helper(tree, root->right, action);
+            while (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            }
+        } else {
+
+            /* Go up until the node is a left child */
+            while ((root != iterator) && (rbk_get_node_parent(iterator)->right == iterator)) {
+                iterator = rbk_get_node_parent(iterator);
+            }
+
+            if (root == iterator) {
+                return;
+            }
+
+            iterator = rbk_get_node_parent(iterator);
+        }
+    }
 }
 
 /**
@@ -1421,8 +2584,8 @@ scl_error_t rbk_traverse_inorder(const rbk_tree_t * const __restrict__ tree, act
 
 /**
  * @brief Helper function for rbk_traverse_preorder function.
- * This method will recursively iterate through all nodes by
- * Root-Left-Right principle.
+ * This method will iterate through all nodes without recursion by
+ * Root-Left-Right principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated red-black tree object
  * @param root starting point of the red-black tree traversal
@@ -1434,14 +2597,31 @@ static void rbk_traverse_preorder_helper(const rbk_tree_t * const __restrict__ t
         return;
     }
 
-    /* Call action function */
-    action(root->data);
+    const rbk_tree_node_t *iterator = root;
+
+    while (1) {
+
+        /* Call action function */
+        action(iterator->data);
+
+        if (tree->nil != iterator->left) {
+            iterator = iterator->left;
+        } else if (tree->nil != iterator->right) {
+            iterator = iterator->right;
+        } else {
+
+            /* Go up until a left child with a right brother */
+            while ((root != iterator) && ((rbk_get_node_parent(iterator)->right == iterator) || (tree->nil == rbk_get_node_parent(iterator)->right))) {
+                iterator = rbk_get_node_parent(iterator);
+            }
 
-    /* Traverse in the left sub-tree */
-    rbk_traverse_preorder_helper(tree, root->left, action);
+            if (root == iterator) {
+                return;
+            }
 
-    /* Traverse in the right sub-tree */
-    rbk_traverse_preorder_helper(tree, root->right, action);
+            iterator = rbk_get_node_parent(iterator)->right;
+        }
+    }
 }
 
 /**
@@ -1482,8 +2662,8 @@ scl_error_t rbk_traverse_preorder(const rbk_tree_t * const __restrict__ tree, ac
 
 /**
  * @brief Helper function for rbk_traverse_postorder function.
- * This method will recursively iterate through all nodes by
- * Left-Right-Root principle.
+ * This method will iterate through all nodes without recursion by
+ * Left-Right-Root principle, following the parent links with O(1) memory.
  * 
  * @param tree an allocated red-black tree object
  * @param root starting point of the red-black tree traversal
@@ -1495,14 +2675,37 @@ static void rbk_traverse_postorder_helper(const rbk_tree_t * const __restrict__
         return;
     }
 
-    /* Traverse in the left sub-tree */
-    rbk_traverse_postorder_helper(tree, root->left, action);
+    const rbk_tree_node_t *iterator = root;
+    uint8_t go_down = 1;
+
+    while (1) {
+
+        /* Go down to the first leaf of the sub-tree */
+        while (0 != go_down) {
+            if (tree->nil != iterator->left) {
+                iterator = iterator->left;
+            } else if (tree->nil != iterator->right) {
+                iterator = iterator->right;
+            } else {
+                go_down = 0;
+            }
+        }
+
+        /* Call action function */
+        action(iterator->data);
 
-    /* Traverse in the right sub-tree */
-    rbk_traverse_postorder_helper(tree, root->right, action);
+        if (root == iterator) {
+            return;
+        }
 
-    /* Call action function */
-    action(root->data);
+        /* After a left child comes the right brother's sub-tree, otherwise the parent */
+        if ((rbk_get_node_parent(iterator)->left == iterator) && (tree->nil != rbk_get_node_parent(iterator)->right)) {
+            iterator = rbk_get_node_parent(iterator)->right;
+            go_down = 1;
+        } else {
+            iterator = rbk_get_node_parent(iterator);
+        }
+    }
 }
 
 /**
@@ -1568,62 +2771,40 @@ scl_error_t rbk_traverse_level(const rbk_tree_t * const __restrict__ tree, actio
 
         /* Tree is empty no node to traverse */
         printf("(Null)\n");
-    } else {
-
-        /* Create a queue for bfs tree traversal */
-        queue_t * const level_queue = create_queue(NULL, sizeof(tree->root));
 
-        /* Check if queue was created successfully */
-        if (NULL != level_queue) {
-
-            scl_error_t err = SCL_OK;
-
-            /* Push pointer to root node into qeuue */
-            err = queue_push(level_queue, &tree->root);
-
-            if (SCL_OK != err) {
-                return err;
-            }
-
-            /* Traverse all nodes */
-            while (!is_queue_empty(level_queue)) {
+        return SCL_OK;
+    }
 
-                /* Get front node from queue */
-                const rbk_tree_node_t * const front_node = *(const rbk_tree_node_t ** const)queue_front(level_queue);
+    /* Every node is queued once, so one array of size nodes is the whole queue */
+    const rbk_tree_node_t **level_nodes = malloc(tree->size * sizeof(*level_nodes));
 
-                /* Remove front node from queue */
-                err = queue_pop(level_queue);
+    if (NULL == level_nodes) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
 
-                if (SCL_OK != err) {
-                    return err;
-                }
+    size_t front = 0;
+    size_t back = 0;
 
-                /* Call action function on front node */
-                action(front_node->data);
+    level_nodes[back++] = tree->root;
 
-                /* Push on queue front left child if it exists */
-                if (tree->nil != front_node->left) {
-                    err = queue_push(level_queue, &front_node->left);
+    /* Traverse all nodes */
+    while (front < back) {
+        const rbk_tree_node_t * const front_node = level_nodes[front++];
 
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-                
-                /* Push on queue front right child if it exists */
-                if (tree->nil != front_node->right) {
-                    err = queue_push(level_queue, &front_node->right);
+        /* Call action function on front node */
+        action(front_node->data);
 
-                    if (SCL_OK != err) {
-                        return err;
-                    }
-                }
-            }
+        /* Queue the children of the front node */
+        if (tree->nil != front_node->left) {
+            level_nodes[back++] = front_node->left;
+        }
 
-            /* Free queue object from heap */
-            return free_queue(level_queue);
+        if (tree->nil != front_node->right) {
+            level_nodes[back++] = front_node->right;
         }
     }
 
-    return SCL_NULL_QUEUE;
+    free(level_nodes);
+
+    return SCL_OK;
 }
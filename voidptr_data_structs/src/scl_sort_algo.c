@@ -175,8 +175,9 @@ scl_error_t quick_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, c
  * @param arr_right pointer to the most right element from an array
  * @param arr_elem_size size of one element from selected array
  * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
  */
-static void merge(void *arr_left, void *arr_middle, void *arr_right, size_t arr_elem_size, compare_func cmp) {
+static scl_error_t merge(void *arr_left, void *arr_middle, void *arr_right, size_t arr_elem_size, compare_func cmp) {
     /* Compute sizes of first and second subarray */
     size_t left_subarray_size = ((uint8_t *)arr_middle - (uint8_t *)arr_left) + arr_elem_size;
     size_t right_subarray_size = ((uint8_t *)arr_right - (uint8_t *)arr_middle);
@@ -185,6 +186,8 @@ static void merge(void *arr_left, void *arr_middle, void *arr_right, size_t arr_
     uint8_t *left_subarray = malloc(left_subarray_size);
     uint8_t *right_subarray = malloc(right_subarray_size);
 
+    scl_error_t err = SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+
     /* Check if subarrays were allocated successfully */
     if (NULL != left_subarray) {
         uint8_t *temp_left_subarray = left_subarray;
@@ -258,11 +261,17 @@ static void merge(void *arr_left, void *arr_middle, void *arr_right, size_t arr_
 
             /* Free right subarray from memory */
             free(temp_right_subarray); 
+
+            err = SCL_OK;
         }
 
         /* Free left subarray from memory */
         free(temp_left_subarray);
+    } else {
+        free(right_subarray);
     }
+
+    return err;
 }
 
 /**
@@ -273,12 +282,15 @@ static void merge(void *arr_left, void *arr_middle, void *arr_right, size_t arr_
  * @param arr_right pointer to the most right element from an array
  * @param arr_elem_size size of one element from selected array
  * @param cmp pointer to a function to compare two sets of data from array
+ * @return scl_error_t enum object for handling errors
  */
-static void merge_sort_helper(void *arr_left, void *arr_right, size_t arr_elem_size, compare_func cmp) {
+static scl_error_t merge_sort_helper(void *arr_left, void *arr_right, size_t arr_elem_size, compare_func cmp) {
     /* Set left and right pointers */
     uint8_t *left_ptr = arr_left;
     uint8_t *right_ptr = arr_right;
 
+    scl_error_t err = SCL_OK;
+
     /* Check if sorting may happen */
     if (left_ptr < right_ptr) {
 
@@ -286,16 +298,20 @@ static void merge_sort_helper(void *arr_left, void *arr_right, size_t arr_elem_s
         uint8_t *middle_ptr = left_ptr + arr_elem_size * ((right_ptr - left_ptr) / (2 * arr_elem_size));
 
         /* Sort left subarray */
-        merge_sort_helper(left_ptr, middle_ptr, arr_elem_size, cmp);
+        err = merge_sort_helper(left_ptr, middle_ptr, arr_elem_size, cmp);
 
         /* Sort right subarray */
-        if (middle_ptr < right_ptr) {
-            merge_sort_helper(middle_ptr + arr_elem_size, right_ptr, arr_elem_size, cmp);
+        if ((SCL_OK == err) && (middle_ptr < right_ptr)) {
+            err = merge_sort_helper(middle_ptr + arr_elem_size, right_ptr, arr_elem_size, cmp);
         }
 
         /* Merge all subarrays recursively until get while array */
-        merge(left_ptr, middle_ptr, right_ptr, arr_elem_size, cmp);
+        if (SCL_OK == err) {
+            err = merge(left_ptr, middle_ptr, right_ptr, arr_elem_size, cmp);
+        }
     }
+
+    return err;
 }
 
 /**
@@ -330,11 +346,8 @@ scl_error_t merge_sort(void *arr, size_t number_of_elem, size_t arr_elem_size, c
         return SCL_SIMPLE_ARRAY_COMPAR_FUNC_NULL;
     }
 
-    /* Call helper function */
-    merge_sort_helper(arr, (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size, arr_elem_size, cmp);
-
-    /* All good */
-    return SCL_OK;
+    /* Call helper function, merging fails if there is not enough memory */
+    return merge_sort_helper(arr, (uint8_t *)arr + (number_of_elem - 1) * arr_elem_size, arr_elem_size, cmp);
 }
 
 /**
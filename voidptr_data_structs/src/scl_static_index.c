@@ -0,0 +1,514 @@
+/**
+ * @file scl_static_index.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-06-21
+ *
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of C-language-Data-Structures.
+ *
+ * C-language-Data-Structures is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C-language-Data-Structures is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with C-language-Data-Structures.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "./include/scl_static_index.h"
+#include "./include/scl_sort_algo.h"
+
+/* Length in bytes of one cache line, the array of data starts on one */
+#define DEFAULT_STATIC_INDEX_LINE_BYTES 64
+
+/* Minimum number of data of one block of the blocked layout */
+#define DEFAULT_STATIC_INDEX_MIN_BLOCK 2
+
+/* Number of levels prefetched ahead by the eytzinger search (16 nodes in a row) */
+#define DEFAULT_STATIC_INDEX_PREFETCH_LEVELS 4
+
+#if defined(__GNUC__)
+#define STATIC_INDEX_PREFETCH(addr) __builtin_prefetch((addr))
+#else
+#define STATIC_INDEX_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * @brief Function to fill the eytzinger layout. The implicit tree is walked in
+ * order and every node takes the next sorted data, so the node k has its
+ * children at 2k and 2k + 1 and the position 0 is never used.
+ * 
+ * @param index an allocated static index object
+ * @param sorted_data array of sorted data
+ * @param position position of the next sorted data to place
+ * @param node position of the current node of the implicit tree
+ * @return size_t position of the next sorted data after filling the subtree
+ */
+static size_t static_index_fill_eytzinger(static_index_t * const __restrict__ index, const uint8_t * const __restrict__ sorted_data, size_t position, size_t node) {
+    if (node <= index->size) {
+        position = static_index_fill_eytzinger(index, sorted_data, position, 2 * node);
+
+        memcpy(index->data + node * index->data_size, sorted_data + position * index->data_size, index->data_size);
+        ++position;
+
+        position = static_index_fill_eytzinger(index, sorted_data, position, 2 * node + 1);
+    }
+
+    return position;
+}
+
+/**
+ * @brief Function to fill the blocked layout. Every block keeps block_size
+ * data and has block_size + 1 children, the block b has its children at
+ * b * (block_size + 1) + 1 ... b * (block_size + 1) + block_size + 1. The
+ * blocks are walked in order and the slots after the last sorted data take
+ * copies of the greatest data, so the searches need no bounds.
+ * 
+ * @param index an allocated static index object
+ * @param sorted_data array of sorted data
+ * @param position position of the next sorted data to place
+ * @param block position of the current block of the implicit tree
+ * @return size_t position of the next sorted data after filling the subtree
+ */
+static size_t static_index_fill_blocked(static_index_t * const __restrict__ index, const uint8_t * const __restrict__ sorted_data, size_t position, size_t block) {
+    if (block < index->number_of_blocks) {
+        for (size_t iter = 0; iter <= index->block_size; ++iter) {
+            position = static_index_fill_blocked(index, sorted_data, position, block * (index->block_size + 1) + iter + 1);
+
+            if (iter < index->block_size) {
+                size_t source = (position < index->size) ? position : index->size - 1;
+
+                memcpy(index->data + (block * index->block_size + iter) * index->data_size, sorted_data + source * index->data_size, index->data_size);
+                ++position;
+            }
+        }
+    }
+
+    return position;
+}
+
+/**
+ * @brief Create a static index object from an array of data. The data is
+ * copied into one array aligned to a cache line, in eytzinger order (the
+ * breadth first order of a binary search tree) or in blocks of one cache
+ * line (the breadth first order of a B-tree), so a search reads the array
+ * from the top to the bottom without following any pointer. Unsorted input
+ * is sorted first (in a copy), equal elements are kept. The index copies
+ * the bytes of the data and never frees their content.
+ * Allocation may fail if heap memory is full or the arguments are
+ * not valid, in this case an exception will be thrown.
+ * 
+ * @param cmp pointer to a function to compare two sets of data
+ * @param data_size length in bytes of the data data type
+ * @param data pointer to an array of number_of_data elements
+ * @param number_of_data number of elements of the array
+ * @param layout order of the data inside the index
+ * @return static_index_t* a new allocated static index or `NULL` (if function failed)
+ */
+static_index_t* create_static_index(compare_func cmp, size_t data_size, const void * const data, size_t number_of_data, static_index_layout_t layout) {
+    /* Check if compare function is valid */
+    if (NULL == cmp) {
+        errno = EINVAL;
+        perror("Compare function undefined for static index");
+        return NULL;
+    }
+
+    /* Check if size of the data is valid */
+    if (0 == data_size) {
+        errno = EINVAL;
+        perror("Data size at creation is zero");
+        return NULL;
+    }
+
+    /* Check if the input array is valid */
+    if ((NULL == data) && (0 != number_of_data)) {
+        errno = EINVAL;
+        perror("Input array undefined for static index");
+        return NULL;
+    }
+
+    /* Check if the layout is valid */
+    if ((STATIC_INDEX_EYTZINGER != layout) && (STATIC_INDEX_BLOCKED != layout)) {
+        errno = EINVAL;
+        perror("Layout undefined for static index");
+        return NULL;
+    }
+
+    /* Allocate a new static index object on heap */
+    static_index_t *new_index = malloc(sizeof(*new_index));
+
+    /* Check if static index object was allocated */
+    if (NULL == new_index) {
+        errno = ENOMEM;
+        perror("Not enough memory for static index allocation");
+        return NULL;
+    }
+
+    new_index->data = NULL;
+    new_index->cmp = cmp;
+    new_index->data_size = data_size;
+    new_index->size = number_of_data;
+    new_index->layout = layout;
+    new_index->block_size = 0;
+    new_index->number_of_blocks = 0;
+
+    if (0 == number_of_data) {
+        return new_index;
+    }
+
+    /* Number of slots of the array, position 0 of the eytzinger layout is not used */
+    size_t number_of_slots = number_of_data + 1;
+
+    if (STATIC_INDEX_BLOCKED == layout) {
+        new_index->block_size = DEFAULT_STATIC_INDEX_LINE_BYTES / data_size;
+
+        if (DEFAULT_STATIC_INDEX_MIN_BLOCK > new_index->block_size) {
+            new_index->block_size = DEFAULT_STATIC_INDEX_MIN_BLOCK;
+        }
+
+        new_index->number_of_blocks = (number_of_data + new_index->block_size - 1) / new_index->block_size;
+        number_of_slots = new_index->number_of_blocks * new_index->block_size;
+    }
+
+    /* Round the array up to whole cache lines, as aligned_alloc wants */
+    size_t length = 0;
+
+    if (number_of_slots <= (SIZE_MAX - DEFAULT_STATIC_INDEX_LINE_BYTES) / data_size) {
+        length = (number_of_slots * data_size + DEFAULT_STATIC_INDEX_LINE_BYTES - 1) & ~((size_t)DEFAULT_STATIC_INDEX_LINE_BYTES - 1);
+        new_index->data = aligned_alloc(DEFAULT_STATIC_INDEX_LINE_BYTES, length);
+    }
+
+    const uint8_t *sorted_data = data;
+    uint8_t *work = NULL;
+
+    /* Check if the input is sorted, otherwise sort a copy of it */
+    for (size_t iter = 1; (NULL != new_index->data) && (iter < number_of_data); ++iter) {
+        if (0 < cmp(sorted_data + (iter - 1) * data_size, sorted_data + iter * data_size)) {
+            work = malloc(number_of_data * data_size);
+
+            if (NULL != work) {
+                memcpy(work, data, number_of_data * data_size);
+            }
+
+            if ((NULL == work) || (SCL_OK != merge_sort(work, number_of_data, data_size, cmp))) {
+                free(new_index->data);
+                new_index->data = NULL;
+            }
+
+            sorted_data = work;
+            break;
+        }
+    }
+
+    if (NULL == new_index->data) {
+        free(work);
+        free(new_index);
+
+        errno = ENOMEM;
+        perror("Not enough memory for static index allocation");
+        return NULL;
+    }
+
+    if (STATIC_INDEX_EYTZINGER == layout) {
+        static_index_fill_eytzinger(new_index, sorted_data, 0, 1);
+    } else {
+        static_index_fill_blocked(new_index, sorted_data, 0, 0);
+    }
+
+    /* Free the sorted copy of the input */
+    free(work);
+
+    /* Return a new allocated static index object */
+    return new_index;
+}
+
+/**
+ * @brief Create a static index object from the data of an avl tree, in sorted
+ * order. Every element is placed once, whatever its count is. The tree is not
+ * changed and can be freed after the index is created.
+ * 
+ * @param tree an allocated avl tree object
+ * @param layout order of the data inside the index
+ * @return static_index_t* a new allocated static index or `NULL` (if function failed)
+ */
+static_index_t* create_static_index_from_avl(const avl_tree_t * const __restrict__ tree, static_index_layout_t layout) {
+    /* Check if tree is valid */
+    if (NULL == tree) {
+        errno = EINVAL;
+        perror("Avl tree undefined for static index");
+        return NULL;
+    }
+
+    uint8_t *sorted_data = NULL;
+
+    /* Copy the data of the tree in sorted order */
+    if (0 != tree->size) {
+        sorted_data = malloc(tree->size * tree->data_size);
+
+        if (NULL == sorted_data) {
+            errno = ENOMEM;
+            perror("Not enough memory for static index allocation");
+            return NULL;
+        }
+
+        avl_cursor_t cursor;
+        size_t position = 0;
+
+        avl_cursor_first(tree, &cursor);
+
+        for (const void *iter = avl_cursor_data(&cursor); NULL != iter; iter = avl_cursor_next(&cursor)) {
+            memcpy(sorted_data + (position++) * tree->data_size, iter, tree->data_size);
+        }
+    }
+
+    static_index_t *new_index = create_static_index(tree->cmp, tree->data_size, sorted_data, tree->size, layout);
+
+    free(sorted_data);
+
+    return new_index;
+}
+
+/**
+ * @brief Create a static index object from the data of a red-black tree, in
+ * sorted order. Every element is placed once, whatever its count is. The tree
+ * is not changed and can be freed after the index is created.
+ * 
+ * @param tree an allocated red-black tree object
+ * @param layout order of the data inside the index
+ * @return static_index_t* a new allocated static index or `NULL` (if function failed)
+ */
+static_index_t* create_static_index_from_rbk(const rbk_tree_t * const __restrict__ tree, static_index_layout_t layout) {
+    /* Check if tree is valid */
+    if (NULL == tree) {
+        errno = EINVAL;
+        perror("Red-black tree undefined for static index");
+        return NULL;
+    }
+
+    uint8_t *sorted_data = NULL;
+
+    /* Copy the data of the tree in sorted order */
+    if (0 != tree->size) {
+        sorted_data = malloc(tree->size * tree->data_size);
+
+        if (NULL == sorted_data) {
+            errno = ENOMEM;
+            perror("Not enough memory for static index allocation");
+            return NULL;
+        }
+
+        rbk_cursor_t cursor;
+        size_t position = 0;
+
+        rbk_cursor_first(tree, &cursor);
+
+        for (const void *iter = rbk_cursor_data(&cursor); NULL != iter; iter = rbk_cursor_next(&cursor)) {
+            memcpy(sorted_data + (position++) * tree->data_size, iter, tree->data_size);
+        }
+    }
+
+    static_index_t *new_index = create_static_index(tree->cmp, tree->data_size, sorted_data, tree->size, layout);
+
+    free(sorted_data);
+
+    return new_index;
+}
+
+/**
+ * @brief Function to free the static index object. The content of the
+ * data is not freed, the index keeps just copies of its bytes.
+ * 
+ * @param index an allocated static index object
+ * @return scl_error_t enum object for handling errors
+ */
+scl_error_t free_static_index(static_index_t * const __restrict__ index) {
+    /* Check if index is valid */
+    if (NULL == index) {
+        return SCL_NULL_STATIC_INDEX;
+    }
+
+    free(index->data);
+    free(index);
+
+    return SCL_OK;
+}
+
+/**
+ * @brief Function to search the first data of the eytzinger layout that is
+ * not less than data (or greater than data if include_equal is 1). The loop
+ * has no branch depending on the comparisons, every step goes from k to
+ * 2k or 2k + 1 and the node four levels below is prefetched, so the 16
+ * nodes read after it come from one cache line. After the last level the
+ * answer is the last node where the search went left, found by dropping
+ * the trailing right steps from k.
+ * 
+ * @param index an allocated static index object
+ * @param data pointer to an address of a generic data type
+ * @param include_equal 1 to skip the data equal to data too
+ * @return const void* pointer to the found data or `NULL` if no data is bigger
+ */
+static const void* static_index_search_eytzinger(const static_index_t * const __restrict__ index, const void * const __restrict__ data, uint8_t include_equal) {
+    const int32_t limit = (0 != include_equal) ? 0 : -1;
+    size_t node = 1;
+
+    while (node <= index->size) {
+        const size_t ahead = node << DEFAULT_STATIC_INDEX_PREFETCH_LEVELS;
+
+        if (ahead <= index->size) {
+            STATIC_INDEX_PREFETCH(index->data + ahead * index->data_size);
+        }
+
+        node = 2 * node + (size_t)(index->cmp(index->data + node * index->data_size, data) <= limit);
+    }
+
+    /* Drop the right steps and the last left step */
+#if defined(__GNUC__)
+    node >>= __builtin_ctzll(~(unsigned long long)node) + 1;
+#else
+    while (0 != (node & 1)) {
+        node >>= 1;
+    }
+
+    node >>= 1;
+#endif
+
+    if (0 == node) {
+        return NULL;
+    }
+
+    return index->data + node * index->data_size;
+}
+
+/**
+ * @brief Function to search the first data of the blocked layout that is
+ * not less than data (or greater than data if include_equal is 1). One block
+ * fills one cache line, all its data is compared without branches and the
+ * number of smaller data is the child to go down to.
+ * 
+ * @param index an allocated static index object
+ * @param data pointer to an address of a generic data type
+ * @param include_equal 1 to skip the data equal to data too
+ * @return const void* pointer to the found data or `NULL` if no data is bigger
+ */
+static const void* static_index_search_blocked(const static_index_t * const __restrict__ index, const void * const __restrict__ data, uint8_t include_equal) {
+    const int32_t limit = (0 != include_equal) ? 0 : -1;
+    const uint8_t *found_data = NULL;
+    size_t block = 0;
+
+    while (block < index->number_of_blocks) {
+        const uint8_t * const block_data = index->data + block * index->block_size * index->data_size;
+        size_t position = 0;
+
+        for (size_t iter = 0; iter < index->block_size; ++iter) {
+            position += (size_t)(index->cmp(block_data + iter * index->data_size, data) <= limit);
+        }
+
+        if (position < index->block_size) {
+            found_data = block_data + position * index->data_size;
+        }
+
+        block = block * (index->block_size + 1) + position + 1;
+    }
+
+    return found_data;
+}
+
+/**
+ * @brief Function to search the first data of the static index that
+ * is greater or equal to a specified data in O(log N).
+ * 
+ * @param index an allocated static index object
+ * @param data pointer to an address of a generic data type
+ * @return const void* pointer to the found data or `NULL` if all
+ * the data of the index is less than data
+ */
+const void* static_index_lower_bound(const static_index_t * const __restrict__ index, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == index) || (NULL == data) || (0 == index->size)) {
+        return NULL;
+    }
+
+    if (STATIC_INDEX_EYTZINGER == index->layout) {
+        return static_index_search_eytzinger(index, data, 0);
+    }
+
+    return static_index_search_blocked(index, data, 0);
+}
+
+/**
+ * @brief Function to search the first data of the static index that
+ * is strictly greater than a specified data in O(log N).
+ * 
+ * @param index an allocated static index object
+ * @param data pointer to an address of a generic data type
+ * @return const void* pointer to the found data or `NULL` if all
+ * the data of the index is less or equal to data
+ */
+const void* static_index_upper_bound(const static_index_t * const __restrict__ index, const void * const __restrict__ data) {
+    /* Check if input data is valid */
+    if ((NULL == index) || (NULL == data) || (0 == index->size)) {
+        return NULL;
+    }
+
+    if (STATIC_INDEX_EYTZINGER == index->layout) {
+        return static_index_search_eytzinger(index, data, 1);
+    }
+
+    return static_index_search_blocked(index, data, 1);
+}
+
+/**
+ * @brief Function to search data in static index in O(log N).
+ * 
+ * @param index an allocated static index object
+ * @param data pointer to an address of a generic data type
+ * @return const void* pointer to location of data found in
+ * the index or `NULL` if data was not found
+ */
+const void* static_index_find_data(const static_index_t * const __restrict__ index, const void * const __restrict__ data) {
+    const void * const found_data = static_index_lower_bound(index, data);
+
+    /* The first data not less than data must be equal to it */
+    if ((NULL == found_data) || (0 != index->cmp(found_data, data))) {
+        return NULL;
+    }
+
+    return found_data;
+}
+
+/**
+ * @brief Function to check if a static index object
+ * is empty or not.
+ * 
+ * @param index an allocated static index object
+ * @return uint8_t 1 if index is empty or not allocated, 0 otherwise
+ */
+uint8_t is_static_index_empty(const static_index_t * const __restrict__ index) {
+    if ((NULL == index) || (0 == index->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Function to get the number of data of the static index.
+ * 
+ * @param index an allocated static index object
+ * @return size_t size of the static index or `SIZE_MAX` if index is not allocated
+ */
+size_t get_static_index_size(const static_index_t * const __restrict__ index) {
+    if (NULL == index) {
+        return SIZE_MAX;
+    }
+
+    return index->size;
+}